@@ -132,8 +132,8 @@ auto main (int argc, char* argv[]) -> int
     preset(os);
 
     // Scroll to the focused child element
-    finalcut::FFocusEvent cfi (finalcut::Event::ChildFocusIn);
-    app.queueEvent(&checkButtonGroup, &cfi);
+    app.queueEvent<finalcut::FFocusEvent>( &checkButtonGroup
+                                         , finalcut::Event::ChildFocusIn );
 
     // Create a OK button
     finalcut::FButton ok("&OK", &dgl);
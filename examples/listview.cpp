@@ -197,6 +197,10 @@ void Listview::onClose (finalcut::FCloseEvent* ev)
 void Listview::cb_showInMessagebox()
 {
   const auto& item = listview.getCurrentItem();
+
+  if ( ! item )
+    return;
+
   finalcut::FMessageBox info ( "Weather in " + item->getText(1)
                              , "  Condition: " + item->getText(2) + "\n"
                                "Temperature: " + item->getText(3) + "\n"
@@ -20,6 +20,12 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <iostream>
@@ -27,8 +33,10 @@
 #include <ostream>
 #include <string>
 #include <thread>
+#include <utility>
 
 #include "final/dialog/fmessagebox.h"
+#include "final/eventloop/pipedata.h"
 #include "final/fapplication.h"
 #include "final/fevent.h"
 #include "final/fstartoptions.h"
@@ -39,8 +47,12 @@
 #include "final/output/tty/ftermdata.h"
 #include "final/output/tty/ftermios.h"
 #include "final/output/tty/ftermxterminal.h"
+#include "final/util/fframeprofiler.h"
 #include "final/util/flogger.h"
 #include "final/util/flog.h"
+#include "final/util/fsessionrecorder.h"
+#include "final/util/fsystem.h"
+#include "final/util/ftaskexecutor.h"
 #include "final/widget/fstatusbar.h"
 #include "final/widget/fwindow.h"
 
@@ -81,6 +93,167 @@ void setSend (FEvent&, bool = true);
 void setQueued (FEvent&, bool = true);
 
 
+//----------------------------------------------------------------------
+// class FApplication::PostedEventQueue
+//----------------------------------------------------------------------
+
+class FApplication::PostedEventQueue
+{
+  public:
+    // Posted event or callback
+    struct Entry
+    {
+      FObject*   receiver{nullptr};
+      FEventPtr  event{};
+      FCallback  callback{};
+      Entry*     next{nullptr};
+    };
+
+    // Using-declaration
+    using EntryPtr = std::unique_ptr<Entry>;
+
+    // Constructor
+    PostedEventQueue()
+    {
+      static const auto& fsystem = FSystem::getInstance();
+
+      // Without a pipe, the posted entries are only
+      // noticed at the end of the next wait interval
+      if ( fsystem->pipe(wakeup_pipe) != 0 )
+      {
+        wakeup_pipe = PipeData{-1, -1};
+        return;
+      }
+
+      for (const auto fd : {wakeup_pipe.getReadFd(), wakeup_pipe.getWriteFd()})
+      {
+        ::fcntl (fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        ::fcntl (fd, F_SETFD, FD_CLOEXEC);
+      }
+    }
+
+    // Disable copy constructor
+    PostedEventQueue (const PostedEventQueue&) = delete;
+
+    // Destructor
+    ~PostedEventQueue() noexcept
+    {
+      auto entry = head.exchange(nullptr, std::memory_order_acquire);
+
+      while ( entry )
+      {
+        const EntryPtr owner{entry};
+        entry = entry->next;
+      }
+
+      if ( wakeup_pipe.getReadFd() < 0 )
+        return;
+
+      static const auto& fsystem = FSystem::getInstance();
+      (void)fsystem->close(wakeup_pipe.getReadFd());
+      (void)fsystem->close(wakeup_pipe.getWriteFd());
+    }
+
+    // Disable copy assignment operator (=)
+    auto operator = (const PostedEventQueue&) -> PostedEventQueue& = delete;
+
+    // Accessor
+    auto getWakeupFileDescriptor() const noexcept -> int
+    {
+      return wakeup_pipe.getReadFd();
+    }
+
+    // Inquiry
+    auto isEmpty() const noexcept -> bool
+    {
+      return pending.empty()
+          && head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    // Methods
+    void push (EntryPtr&& ptr) noexcept
+    {
+      // Lock-free push onto a singly linked stack (any thread)
+      auto entry = ptr.release();
+      entry->next = head.load(std::memory_order_relaxed);
+
+      while ( ! head.compare_exchange_weak ( entry->next, entry
+                                           , std::memory_order_release
+                                           , std::memory_order_relaxed ) )
+        continue;
+
+      // Only the first entry of a batch has to wake up the event loop
+      if ( ! entry->next && wakeup_pipe.getWriteFd() >= 0 )
+      {
+        const char byte{1};
+        (void)::write (wakeup_pipe.getWriteFd(), &byte, sizeof(byte));
+      }
+    }
+
+    auto pop() -> EntryPtr
+    {
+      // Takes the oldest entry (main thread only)
+      if ( pending.empty() )
+        collect();
+
+      if ( pending.empty() )
+        return {};
+
+      auto entry = std::move(pending.front());
+      pending.pop_front();
+      return entry;
+    }
+
+    auto remove (const FObject* receiver) -> bool
+    {
+      // Discards all events for the receiver (main thread only)
+      collect();
+      const auto size = pending.size();
+      pending.erase ( std::remove_if ( pending.begin(), pending.end()
+                                     , [receiver] (const EntryPtr& entry)
+                                       { return entry->receiver == receiver; } )
+                    , pending.end() );
+      return pending.size() != size;
+    }
+
+  private:
+    // Method
+    void collect()
+    {
+      // Moves the whole stack in one step into the FIFO list
+      drainPipe();
+      auto entry = head.exchange(nullptr, std::memory_order_acquire);
+      const auto first = pending.size();
+
+      while ( entry )
+      {
+        auto next = entry->next;
+        pending.emplace_back(entry);
+        entry = next;
+      }
+
+      // The stack delivers the entries from newest to oldest
+      std::reverse (pending.begin() + std::ptrdiff_t(first), pending.end());
+    }
+
+    void drainPipe() const
+    {
+      if ( wakeup_pipe.getReadFd() < 0 )
+        return;
+
+      std::array<char, 64> buffer{};
+
+      while ( ::read(wakeup_pipe.getReadFd(), buffer.data(), buffer.size()) > 0 )
+        continue;
+    }
+
+    // Data members
+    std::atomic<Entry*>   head{nullptr};
+    std::deque<EntryPtr>  pending{};
+    PipeData              wakeup_pipe{};
+};
+
+
 //----------------------------------------------------------------------
 // class FApplication
 //----------------------------------------------------------------------
@@ -111,11 +284,17 @@ FApplication::FApplication (const int& arg_c, char* arg_v[])
 //----------------------------------------------------------------------
 FApplication::~FApplication()  // destructor
 {
+  task_executor.reset();  // Waits for the running background tasks
   internal::var::app_object = nullptr;
 
   if ( eventInQueue() )
     event_queue.clear();
 
+  event_arena.clear();
+
+  if ( posted_events )
+    FKeyboard::getInstance().setWakeupFileDescriptor(-1);
+
   destroyLog();
 }
 
@@ -235,8 +414,10 @@ auto FApplication::sendEvent (FObject* receiver, FEvent* event ) -> bool
     return false;
 
   // Sends the event event directly to receiver
+  static auto& profiler = FFrameProfiler::getInstance();
   const auto& ret = receiver->event(event);
   setSend(*event);
+  profiler.addEvents(1);
   return ret;
 }
 
@@ -254,6 +435,9 @@ void FApplication::queueEvent (FObject* receiver, FEvent* event)
 //----------------------------------------------------------------------
 void FApplication::sendQueuedEvents()
 {
+  sendPostedEvents();
+  queue_send_level++;
+
   while ( eventInQueue() )
   {
     const auto& event_pair = event_queue.front();
@@ -261,6 +445,14 @@ void FApplication::sendQueuedEvents()
     sendEvent(event_pair.first, event_pair.second);
     event_queue.pop_front();
   }
+
+  queue_send_level--;
+
+  // Releases all delivered arena events in one step. A nested call
+  // (e.g. from a modal dialog) must not destroy the event of the
+  // outer call that is still being processed.
+  if ( queue_send_level == 0 && ! eventInQueue() )
+    event_arena.clear();
 }
 
 //----------------------------------------------------------------------
@@ -275,13 +467,15 @@ auto FApplication::eventInQueue() const -> bool
 //----------------------------------------------------------------------
 auto FApplication::removeQueuedEvent (const FObject* receiver) -> bool
 {
-  if ( ! eventInQueue() )
-    return false;
-
   if ( ! receiver )
     return false;
 
-  bool retval{false};
+  cancelAsyncTasks(receiver);
+  bool retval{posted_events && posted_events->remove(receiver)};
+
+  if ( ! eventInQueue() )
+    return retval;
+
   auto iter = event_queue.cbegin();
 
   while ( iter != event_queue.cend() )
@@ -298,6 +492,71 @@ auto FApplication::removeQueuedEvent (const FObject* receiver) -> bool
   return retval;
 }
 
+//----------------------------------------------------------------------
+void FApplication::postEvent (FObject* receiver, FEventPtr&& event)
+{
+  // Can be called from any thread. The event is delivered in the
+  // main loop. The receiver must stay alive until then or be
+  // destroyed in the main thread (this removes its posted events).
+
+  if ( ! (posted_events && receiver && event) )
+    return;
+
+  auto entry = std::make_unique<PostedEventQueue::Entry>();
+  entry->receiver = receiver;
+  entry->event = std::move(event);
+  setQueued(*entry->event);
+  posted_events->push(std::move(entry));
+}
+
+//----------------------------------------------------------------------
+void FApplication::postCallback (FCallback&& callback)
+{
+  // Can be called from any thread.
+  // The callback is executed in the main loop.
+
+  if ( ! (posted_events && callback) )
+    return;
+
+  auto entry = std::make_unique<PostedEventQueue::Entry>();
+  entry->callback = std::move(callback);
+  posted_events->push(std::move(entry));
+}
+
+//----------------------------------------------------------------------
+void FApplication::runAsync ( FObject* requester
+                            , FTask&& task, FCallback&& on_done )
+{
+  // Runs the task in a background thread. The on_done callback is
+  // then called in the main loop. If the requester is destroyed
+  // before, the task does not start and on_done is not called.
+
+  if ( ! task )
+    return;
+
+  if ( ! task_executor )  // The worker threads start at the first use
+    task_executor = std::make_unique<FTaskExecutor>();
+
+  auto cancelled = std::make_shared<std::atomic<bool>>(false);
+
+  if ( requester )
+    async_tasks.emplace_back(requester, cancelled);
+
+  task_executor->submit ( [this, cancelled
+                          , task = std::move(task)
+                          , on_done = std::move(on_done)] () mutable
+                          {
+                            if ( ! *cancelled )
+                              task();
+
+                            postCallback ( [this, cancelled
+                                           , on_done = std::move(on_done)] ()
+                                           {
+                                             finishAsyncTask (cancelled, on_done);
+                                           } );
+                          } );
+}
+
 //----------------------------------------------------------------------
 void FApplication::registerMouseHandler (const FMouseHandler& fn)
 {
@@ -307,8 +566,13 @@ void FApplication::registerMouseHandler (const FMouseHandler& fn)
 //----------------------------------------------------------------------
 void FApplication::initTerminal()
 {
-  if ( ! isQuit() )
-    FWidget::initTerminal();
+  if ( isQuit() )
+    return;
+
+  FWidget::initTerminal();
+  // A session recording starts with the initial terminal size
+  static auto& recorder = FSessionRecorder::getInstance();
+  recorder.recordResize (getDesktopWidth(), getDesktopHeight());
 }
 
 //----------------------------------------------------------------------
@@ -414,6 +678,9 @@ void FApplication::init()
   // Initialize the last event time
   time_last_event = TimeValue{};
 
+  // Events from other threads wake up the waiting for input
+  posted_events = std::make_unique<PostedEventQueue>();
+
   // Initialize keyboard
   static auto& keyboard = FKeyboard::getInstance();
   auto cmd1 = [this] () { this->keyPressed(); };
@@ -430,6 +697,7 @@ void FApplication::init()
   keyboard.setMouseTrackingCommand (key_cmd4);
   // Set the keyboard keypress timeout
   keyboard.setKeypressTimeout (key_timeout);
+  keyboard.setWakeupFileDescriptor (posted_events->getWakeupFileDescriptor());
 
   // Initialize mouse control
   static auto& mouse = FMouseControl::getInstance();
@@ -481,6 +749,18 @@ void FApplication::setTerminalEncoding (const FString& enc_str)
   }
 }
 
+//----------------------------------------------------------------------
+void FApplication::setSessionRecordFile (const FString& filename)
+{
+  static auto& recorder = FSessionRecorder::getInstance();
+
+  if ( ! recorder.start(filename.toString()) )
+  {
+    setExitMessage ("Could not open session file \"" + filename + "\"");
+    exit(EXIT_FAILURE);
+  }
+}
+
 //----------------------------------------------------------------------
 inline auto FApplication::getLongOptions() -> const std::vector<CmdOption>&
 {
@@ -488,6 +768,7 @@ inline auto FApplication::getLongOptions() -> const std::vector<CmdOption>&
   {
     {"encoding",                 required_argument, nullptr,  'e' },
     {"log-file",                 required_argument, nullptr,  'l' },
+    {"record-session",           required_argument, nullptr,  'R' },
     {"no-mouse",                 no_argument,       nullptr,  'm' },
     {"no-optimized-cursor",      no_argument,       nullptr,  'o' },
     {"no-terminal-detection",    no_argument,       nullptr,  'd' },
@@ -495,6 +776,7 @@ inline auto FApplication::getLongOptions() -> const std::vector<CmdOption>&
     {"no-terminal-focus-events", no_argument,       nullptr,  'f' },
     {"no-color-change",          no_argument,       nullptr,  'c' },
     {"no-sgr-optimizer",         no_argument,       nullptr,  's' },
+    {"no-kitty-keyboard",        no_argument,       nullptr,  'k' },
     {"vgafont",                  no_argument,       nullptr,  'v' },
     {"newfont",                  no_argument,       nullptr,  'n' },
     {"dark-theme",               no_argument,       nullptr,  't' },
@@ -516,12 +798,15 @@ inline void FApplication::setCmdOptionsMap (CmdMap& cmd_map)
 {
   auto enc = [] (const auto& s) { FApplication::setTerminalEncoding(s); };
   auto log = [] (const auto& s) { FApplication::setLogFile(s); };
+  auto rec = [] (const auto& s) { FApplication::setSessionRecordFile(s); };
   auto opt = &FApplication::getStartOptions;
 
   // --encoding
   cmd_map['e'] = [enc] (const auto& arg) { enc(FString(arg)); };
   // --log-file
   cmd_map['l'] = [log] (const auto& arg) { log(FString(arg)); };
+  // --record-session
+  cmd_map['R'] = [rec] (const auto& arg) { rec(FString(arg)); };
   // --no-mouse
   cmd_map['m'] = [opt] (const auto&) { opt().mouse_support = false; };
   // --no-optimized-cursor
@@ -536,6 +821,8 @@ inline void FApplication::setCmdOptionsMap (CmdMap& cmd_map)
   cmd_map['c'] = [opt] (const auto&) { opt().color_change = false; };
   // --no-sgr-optimizer
   cmd_map['s'] = [opt] (const auto&) { opt().sgr_optimizer = false; };
+  // --no-kitty-keyboard
+  cmd_map['k'] = [opt] (const auto&) { opt().kitty_keyboard = false; };
   // --vgafont
   cmd_map['v'] = [opt] (const auto&) { opt().vgafont = true; };
   // --newfont
@@ -614,6 +901,8 @@ void FApplication::showParameterUsage()
     << "    {utf8, vt100, pc, ascii}\n"
     << "  --log-file=<FILE>         "
     << "    Writes log output to FILE\n"
+    << "  --record-session=<FILE>   "
+    << "    Records the terminal input and output to FILE\n"
     << "  --no-mouse                "
     << "    Disable mouse support\n"
     << "  --no-optimized-cursor     "
@@ -628,6 +917,8 @@ void FApplication::showParameterUsage()
     << "    Do not redefine the color palette\n"
     << "  --no-sgr-optimizer        "
     << "    Do not optimize SGR sequences\n"
+    << "  --no-kitty-keyboard       "
+    << "    Do not use the kitty keyboard protocol\n"
     << "  --vgafont                 "
     << "    Set the standard vga 8x16 font\n"
     << "  --newfont                 "
@@ -735,6 +1026,10 @@ inline void FApplication::performKeyboardAction()
   {
     processTerminalFocus (keyboard.getKey());  // Term focus-in/focus-out
   }
+  else if ( keyboard.getKey() == FKey::Term_Paste )
+  {
+    sendPasteEvent();
+  }
   else
   {
     const bool acceptKeyDown = sendKeyDownEvent (keyboard_widget);
@@ -786,6 +1081,32 @@ inline void FApplication::sendEscapeKeyPressEvent() const
   sendEvent (keyboard_widget, &k_press_ev);
 }
 
+//----------------------------------------------------------------------
+inline void FApplication::sendPasteEvent() const
+{
+  // Send the pasted text as a whole. Widgets without paste support
+  // receive the text as single key down and key press events.
+
+  static const auto& keyboard = FKeyboard::getInstance();
+  FPasteEvent paste_ev (Event::Paste, FString{keyboard.getPasteText()});
+  sendEvent (keyboard_widget, &paste_ev);
+
+  if ( paste_ev.isAccepted() )
+    return;
+
+  for (const auto& ch : paste_ev.getText())
+  {
+    const auto key = FKey(uInt32(ch));
+    FKeyEvent k_down_ev (Event::KeyDown, key);
+    sendEvent (keyboard_widget, &k_down_ev);
+    FKeyEvent k_press_ev (Event::KeyPress, key);
+    sendEvent (keyboard_widget, &k_press_ev);
+
+    if ( isQuit() )
+      return;
+  }
+}
+
 //----------------------------------------------------------------------
 inline auto FApplication::sendKeyDownEvent (FWidget* widget) const -> bool
 {
@@ -852,6 +1173,65 @@ inline auto FApplication::hasDataInQueue() const -> bool
   return ( keyboard.hasDataInQueue() || mouse.hasDataInQueue() );
 }
 
+//----------------------------------------------------------------------
+inline auto FApplication::hasPostedEvents() const -> bool
+{
+  return posted_events && ! posted_events->isEmpty();
+}
+
+//----------------------------------------------------------------------
+void FApplication::sendPostedEvents()
+{
+  // Delivers the events and callbacks of other threads
+  // in the order in which they were posted
+
+  if ( ! posted_events )
+    return;
+
+  while ( auto entry = posted_events->pop() )
+  {
+    if ( entry->callback )
+      entry->callback();
+    else
+    {
+      setQueued(*entry->event, false);
+      sendEvent(entry->receiver, entry->event.get());
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void FApplication::cancelAsyncTasks (const FObject* requester)
+{
+  auto iter = async_tasks.begin();
+
+  while ( iter != async_tasks.end() )
+  {
+    if ( iter->first == requester )
+    {
+      *iter->second = true;
+      iter = async_tasks.erase(iter);
+    }
+    else
+      ++iter;
+  }
+}
+
+//----------------------------------------------------------------------
+void FApplication::finishAsyncTask ( const FCancelFlag& cancelled
+                                   , const FCallback& on_done )
+{
+  auto iter = std::find_if ( async_tasks.begin(), async_tasks.end()
+                           , [&cancelled] (const auto& entry)
+                             { return entry.second == cancelled; } );
+
+  if ( iter != async_tasks.end() )
+    async_tasks.erase(iter);
+
+  if ( ! *cancelled && on_done )
+    on_done();
+}
+
 //----------------------------------------------------------------------
 void FApplication::queuingKeyboardInput() const
 {
@@ -859,6 +1239,7 @@ void FApplication::queuingKeyboardInput() const
   static auto& keyboard = FKeyboard::getInstance();
   keyboard.escapeKeyHandling();  // special case: Esc key
   keyboard.clearKeyBufferOnTimeout();
+  keyboard.pasteTimeoutHandling();
 
   if ( isKeyPressed() )
     keyboard.fetchKeyCode();
@@ -1278,12 +1659,15 @@ void FApplication::processResizeEvent()
 
   auto foutput_ptr = FVTerm::getFOutput();
   foutput_ptr->detectTerminalSize();  // Detect and save the current terminal size
+  static auto& recorder = FSessionRecorder::getInstance();
+  recorder.recordResize (getDesktopWidth(), getDesktopHeight());
   static auto& mouse = FMouseControl::getInstance();
   mouse.setMaxWidth (uInt16(getDesktopWidth()));
   mouse.setMaxHeight (uInt16(getDesktopHeight()));
   FResizeEvent r_ev(Event::Resize);
   sendEvent(internal::var::app_object, &r_ev);
   has_terminal_resized = false;
+  pending_term_size = FSize{};  // The next signal starts a new resize
 
   if ( r_ev.isAccepted() )
     foutput_ptr->commitTerminalResize();
@@ -1333,18 +1717,34 @@ auto FApplication::processNextEvent() -> bool
 {
   uInt num_events{0};
 
-  if ( hasDataInQueue() || hasTerminalResized() || isNextEventTimeout() )
+  if ( hasDataInQueue() || hasPostedEvents()
+    || hasTerminalResized() || isNextEventTimeout() )
   {
+    static auto& profiler = FFrameProfiler::getInstance();
+    static auto& recorder = FSessionRecorder::getInstance();
+    using Phase = FFrameProfiler::Phase;
     time_last_event = FObjectTimer::getCurrentTime();
+    profiler.beginFrame();
     num_events += processTimerEvent();
+    profiler.endPhase (Phase::Timer);
     processInput();
+    profiler.endPhase (Phase::Input);
     processResizeEvent();  // when the terminal size has changed
+    profiler.endPhase (Phase::Resize);
     processCloseWidget();
+    profiler.endPhase (Phase::Close);
     sendQueuedEvents();
+    profiler.endPhase (Phase::QueuedEvents);
     processDialogResizeMove();
+    profiler.endPhase (Phase::DialogMove);
     processTerminalUpdate();  // for changed areas on the terminal
+    profiler.endPhase (Phase::TerminalUpdate);
     flush();  // Flush output buffer (via an instance of FOutput)
+    profiler.endPhase (Phase::Flush);
     processLogger();
+    profiler.endPhase (Phase::Logger);
+    profiler.endFrame();
+    recorder.recordFrame();
   }
   else if ( isKeyPressed(next_event_wait) )
   {
@@ -1365,10 +1765,34 @@ void FApplication::performTimerAction (FObject* receiver, FEvent* event)
 inline auto FApplication::hasTerminalResized() -> bool
 {
   auto foutput_ptr = FVTerm::getFOutput();
-  has_terminal_resized = foutput_ptr->hasTerminalResized();
+  has_terminal_resized = foutput_ptr->hasTerminalResized()
+                      && isTerminalSizeSettled();
   return has_terminal_resized;
 }
 
+//----------------------------------------------------------------------
+auto FApplication::isTerminalSizeSettled() -> bool
+{
+  // While the terminal is being resized, many SIGWINCH signals arrive
+  // in quick succession. They are coalesced into a single resize event
+  // that is processed when the size has not changed for
+  // resize_settle_time. Until then, the terminal is not updated.
+
+  auto foutput_ptr = FVTerm::getFOutput();
+  foutput_ptr->detectTerminalSize();
+  const FSize term_size{ foutput_ptr->getColumnNumber()
+                       , foutput_ptr->getLineNumber() };
+
+  if ( term_size != pending_term_size )
+  {
+    pending_term_size = term_size;
+    time_term_resized = FObjectTimer::getCurrentTime();
+    return false;
+  }
+
+  return FObjectTimer::isTimeout (time_term_resized, resize_settle_time);
+}
+
 //----------------------------------------------------------------------
 auto FApplication::isEventProcessable ( FObject* receiver
                                       , const FEvent* event ) -> bool
@@ -1389,11 +1813,12 @@ auto FApplication::isEventProcessable ( FObject* receiver
       && ! window->getFlags().visibility.modal
       && ! window->isMenuWidget() )
     {
-      constexpr std::array<const Event, 13> blocked_events
+      constexpr std::array<const Event, 14> blocked_events
       {{
         Event::KeyPress,
         Event::KeyUp,
         Event::KeyDown,
+        Event::Paste,
         Event::MouseDown,
         Event::MouseUp,
         Event::MouseDoubleClick,
@@ -60,13 +60,16 @@
 #endif
 
 #include <getopt.h>
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "final/feventarena.h"
 #include "final/ftypes.h"
 #include "final/fwidget.h"
 
@@ -83,6 +86,7 @@ class FLog;
 class FMouseData;
 class FMouseEvent;
 class FStartOptions;
+class FTaskExecutor;
 class FTimerEvent;
 class FWheelEvent;
 class FMouseControl;
@@ -100,6 +104,9 @@ class FApplication : public FWidget
     using FLogPtr = std::shared_ptr<FLog>;
     using Args = std::vector<std::string>;
     using FMouseHandler = std::function<void(FMouseData)>;
+    using FEventPtr = std::unique_ptr<FEvent>;
+    using FCallback = std::function<void()>;
+    using FTask = std::function<void()>;
 
     // Constructor
     FApplication (const int&, char*[]);
@@ -143,9 +150,14 @@ class FApplication : public FWidget
     void         quit() const;
     static auto  sendEvent (FObject*, FEvent*) -> bool;
     void         queueEvent (FObject*, FEvent*);
+    template <typename EventT, typename... EventArgs>
+    auto         queueEvent (FObject*, EventArgs&&...) -> EventT*;
     void         sendQueuedEvents();
     auto         eventInQueue() const -> bool;
     auto         removeQueuedEvent (const FObject*) -> bool;
+    void         postEvent (FObject*, FEventPtr&&);  // thread-safe
+    void         postCallback (FCallback&&);         // thread-safe
+    void         runAsync (FObject*, FTask&&, FCallback&& = nullptr);
     void         registerMouseHandler (const FMouseHandler&);
     void         initTerminal() override;
     static void  setDefaultTheme();
@@ -161,16 +173,24 @@ class FApplication : public FWidget
     virtual void processExternalUserEvent();
 
   private:
+    // Forward declaration
+    class PostedEventQueue;
+
     // Using-declaration
     using CmdOption = struct option;
     using EventPair = std::pair<FObject*, FEvent*>;
     using FEventQueue = std::deque<EventPair>;
     using FMouseHandlerList = std::vector<FMouseHandler>;
+    using PostedQueuePtr = std::unique_ptr<PostedEventQueue>;
+    using FTaskExecutorPtr = std::unique_ptr<FTaskExecutor>;
+    using FCancelFlag = std::shared_ptr<std::atomic<bool>>;
+    using AsyncTaskList = std::vector<std::pair<const FObject*, FCancelFlag>>;
     using CmdMap = std::unordered_map<int, std::function<void(char*)>>;
 
     // Methods
     void         init();
     static void  setTerminalEncoding (const FString&);
+    static void  setSessionRecordFile (const FString&);
     static auto  getLongOptions() -> const std::vector<struct option>&;
     static void  setCmdOptionsMap (CmdMap&);
     static void  cmdOptions (const Args&);
@@ -187,11 +207,16 @@ class FApplication : public FWidget
     void         performMouseAction() const;
     void         mouseEvent (const FMouseData&) const;
     void         sendEscapeKeyPressEvent() const;
+    void         sendPasteEvent() const;
     auto         sendKeyDownEvent (FWidget*) const -> bool;
     auto         sendKeyPressEvent (FWidget*) const -> bool;
     auto         sendKeyUpEvent (FWidget*) const -> bool;
     void         sendKeyboardAccelerator();
     auto         hasDataInQueue() const -> bool;
+    auto         hasPostedEvents() const -> bool;
+    void         sendPostedEvents();
+    void         cancelAsyncTasks (const FObject*);
+    void         finishAsyncTask (const FCancelFlag&, const FCallback&);
     void         queuingKeyboardInput() const;
     void         queuingMouseInput() const;
     void         processKeyboardEvent() const;
@@ -231,6 +256,7 @@ class FApplication : public FWidget
     auto         processNextEvent() -> bool;
     void         performTimerAction (FObject*, FEvent*) override;
     auto         hasTerminalResized() -> bool;
+    auto         isTerminalSizeSettled() -> bool;
     static auto  isEventProcessable (FObject*, const FEvent*) -> bool;
     static auto  isNextEventTimeout() -> bool;
 
@@ -238,8 +264,16 @@ class FApplication : public FWidget
     Args              app_args{};
     uInt64            key_timeout{100'000};        // 100 ms
     uInt64            dblclick_interval{500'000};  // 500 ms
+    uInt64            resize_settle_time{40'000};  // 40 ms
+    TimeValue         time_term_resized{};
+    FSize             pending_term_size{};
     std::streambuf*   default_clog_rdbuf{std::clog.rdbuf()};
     FEventQueue       event_queue{};
+    FEventArena       event_arena{};
+    int               queue_send_level{0};
+    PostedQueuePtr    posted_events{};
+    FTaskExecutorPtr  task_executor{};
+    AsyncTaskList     async_tasks{};
     FMouseHandlerList mouse_handler_list{};
     bool              has_terminal_resized{false};
     static uInt64     next_event_wait;
@@ -266,6 +300,21 @@ inline auto FApplication::getClassName() const -> FString
 inline auto FApplication::getArgs() const -> Args
 { return app_args; }
 
+//----------------------------------------------------------------------
+template <typename EventT, typename... EventArgs>
+inline auto FApplication::queueEvent (FObject* receiver, EventArgs&&... args) -> EventT*
+{
+  // The application owns the created event. It is destroyed
+  // after the next sendQueuedEvents() call has delivered it.
+
+  if ( ! receiver )
+    return nullptr;
+
+  auto event = event_arena.create<EventT>(std::forward<EventArgs>(args)...);
+  queueEvent (receiver, event);
+  return event;
+}
+
 //----------------------------------------------------------------------
 inline void FApplication::cb_exitApp (FWidget* w) const
 { w->close(); }
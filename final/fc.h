@@ -79,7 +79,8 @@ enum class Event
   Hide,              // widget is hidden
   Close,             // widget close
   Timer,             // timer event occur
-  User               // user defined event
+  User,              // user defined event
+  Paste              // text pasted
 };
 
 // Internal character encoding
@@ -701,6 +702,7 @@ enum class FKey : uInt32
   Shift_Ctrl_Meta_menu       = 0x01600007,  // shifted control-M-menu
   Term_Focus_In              = 0x01900000,  // Terminal focus-in event
   Term_Focus_Out             = 0x01900001,  // Terminal focus-out event
+  Term_Paste                 = 0x01900002,  // Terminal bracketed paste
   Escape_mintty              = 0x0200001b,  // mintty Esc
   X11mouse                   = 0x02000020,  // xterm mouse
   Extended_mouse             = 0x02000021,  // SGR extended mouse
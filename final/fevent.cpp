@@ -34,6 +34,9 @@ FEvent::FEvent (Event ev_type)  // constructor
   : t{ev_type}
 { }
 
+//----------------------------------------------------------------------
+FEvent::~FEvent() noexcept = default;  // destructor
+
 //----------------------------------------------------------------------
 auto FEvent::getType() const -> Event
 { return t; }
@@ -73,6 +76,32 @@ void FKeyEvent::ignore()
 { accpt = false; }
 
 
+//----------------------------------------------------------------------
+// class FPasteEvent
+//----------------------------------------------------------------------
+
+FPasteEvent::FPasteEvent (Event ev_type, FString str)  // constructor
+  : FEvent{ev_type}
+  , text{std::move(str)}
+{ }
+
+//----------------------------------------------------------------------
+auto FPasteEvent::getText() const & -> const FString&
+{ return text; }
+
+//----------------------------------------------------------------------
+auto FPasteEvent::isAccepted() const -> bool
+{ return accpt; }
+
+//----------------------------------------------------------------------
+void FPasteEvent::accept()
+{ accpt = true; }
+
+//----------------------------------------------------------------------
+void FPasteEvent::ignore()
+{ accpt = false; }
+
+
 //----------------------------------------------------------------------
 // class FMouseEvent
 //----------------------------------------------------------------------
@@ -33,6 +33,10 @@
  *      │    ▕▁▁▁▁▁▁▁▁▁▁▁▏
  *      │
  *      │    ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *      ├─────▏FPasteEvent ▏
+ *      │    ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *      │
+ *      │    ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
  *      ├─────▏FMouseEvent ▏
  *      │    ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
  *      │
@@ -87,6 +91,7 @@
 #include "final/ftypes.h"
 #include "final/util/fdata.h"
 #include "final/util/fpoint.h"
+#include "final/util/fstring.h"
 
 namespace finalcut
 {
@@ -102,6 +107,7 @@ class FEvent  // event base class
 {
   public:
     explicit FEvent(Event);
+    virtual ~FEvent() noexcept;
     auto getType() const -> Event;
     auto isQueued() const -> bool;
     auto wasSent() const -> bool;
@@ -137,6 +143,26 @@ class FKeyEvent : public FEvent  // keyboard event
 };
 
 
+//----------------------------------------------------------------------
+// class FPasteEvent
+//----------------------------------------------------------------------
+
+class FPasteEvent : public FEvent  // paste event
+{
+  public:
+    FPasteEvent (Event, FString);
+
+    auto getText() const & -> const FString&;
+    auto isAccepted() const -> bool;
+    void accept();
+    void ignore();
+
+  private:
+    FString text{};
+    bool    accpt{false};  // reject by default
+};
+
+
 //----------------------------------------------------------------------
 // class FMouseEvent
 //----------------------------------------------------------------------
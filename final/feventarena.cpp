@@ -0,0 +1,86 @@
+/***********************************************************************
+* feventarena.cpp - Bulk-released memory arena for queued events       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+
+#include "final/feventarena.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FEventArena
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FEventArena::~FEventArena() noexcept  // destructor
+{
+  clear();
+}
+
+
+// public methods of FEventArena
+//----------------------------------------------------------------------
+void FEventArena::clear() noexcept
+{
+  // Destroys all events in reverse order of creation
+  // and keeps the memory blocks for reuse
+
+  for (auto iter = events.rbegin(); iter != events.rend(); ++iter)
+    (*iter)->~FEvent();
+
+  events.clear();
+  block_index = 0;
+  block_used = 0;
+}
+
+
+// private methods of FEventArena
+//----------------------------------------------------------------------
+auto FEventArena::allocate (std::size_t size, std::size_t alignment) -> void*
+{
+  while ( block_index < blocks.size() )
+  {
+    auto& block = blocks[block_index];
+    const auto offset = (block_used + alignment - 1) & ~(alignment - 1);
+
+    if ( offset + size <= block.size )
+    {
+      block_used = offset + size;
+      return block.data.get() + offset;
+    }
+
+    // Continue with the next block
+    block_index++;
+    block_used = 0;
+  }
+
+  // Large events get a block of their own
+  const auto block_size = std::max(BLOCK_SIZE, size);
+  blocks.push_back({std::make_unique<char[]>(block_size), block_size});
+  block_index = blocks.size() - 1;
+  block_used = size;
+  return blocks.back().data.get();
+}
+
+}  // namespace finalcut
@@ -0,0 +1,147 @@
+/***********************************************************************
+* feventarena.h - Bulk-released memory arena for queued events         *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▏
+ * ▕ FEventArena ▏- - - -▕ FEvent ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▏
+ */
+
+// The arena owns all events created with create(). The events are
+// placed one after the other in large memory blocks and are destroyed
+// together by clear(). The memory blocks are kept for reuse, so a
+// running event loop does not need any further heap allocations.
+// Not thread-safe - use it only in the main thread.
+
+#ifndef FEVENTARENA_H
+#define FEVENTARENA_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "final/fevent.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FEventArena
+//----------------------------------------------------------------------
+
+class FEventArena final
+{
+  public:
+    // Constructor
+    FEventArena() = default;
+
+    // Disable copy constructor
+    FEventArena (const FEventArena&) = delete;
+
+    // Destructor
+    ~FEventArena() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FEventArena&) -> FEventArena& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getEventCount() const noexcept -> std::size_t;
+    auto getBlockCount() const noexcept -> std::size_t;
+
+    // Inquiry
+    auto isEmpty() const noexcept -> bool;
+
+    // Methods
+    template <typename EventT, typename... Args>
+    auto create (Args&&...) -> EventT*;
+    void clear() noexcept;
+
+  private:
+    // Constants
+    static constexpr std::size_t BLOCK_SIZE = 8192;
+
+    // Using-declaration
+    using BlockData = std::unique_ptr<char[]>;
+
+    struct Block
+    {
+      BlockData    data{};
+      std::size_t  size{0};
+    };
+
+    // Method
+    auto allocate (std::size_t, std::size_t) -> void*;
+
+    // Data members
+    std::vector<Block>    blocks{};
+    std::vector<FEvent*>  events{};
+    std::size_t           block_index{0};
+    std::size_t           block_used{0};
+};
+
+// FEventArena inline functions
+//----------------------------------------------------------------------
+inline auto FEventArena::getClassName() const -> FString
+{ return "FEventArena"; }
+
+//----------------------------------------------------------------------
+inline auto FEventArena::getEventCount() const noexcept -> std::size_t
+{ return events.size(); }
+
+//----------------------------------------------------------------------
+inline auto FEventArena::getBlockCount() const noexcept -> std::size_t
+{ return blocks.size(); }
+
+//----------------------------------------------------------------------
+inline auto FEventArena::isEmpty() const noexcept -> bool
+{ return events.empty(); }
+
+//----------------------------------------------------------------------
+template <typename EventT, typename... Args>
+inline auto FEventArena::create (Args&&... args) -> EventT*
+{
+  static_assert ( std::is_base_of<FEvent, EventT>::value
+                , "EventT must be derived from FEvent" );
+  static_assert ( alignof(EventT) <= alignof(std::max_align_t)
+                , "Over-aligned events are not supported" );
+
+  events.reserve(events.size() + 1);  // push_back cannot throw anymore
+  auto memory = allocate (sizeof(EventT), alignof(EventT));
+  auto event = new (memory) EventT(std::forward<Args>(args)...);
+  events.push_back(event);
+  return event;
+}
+
+}  // namespace finalcut
+
+#endif  // FEVENTARENA_H
@@ -29,6 +29,7 @@
 #include <final/fapplication.h>
 #include <final/fc.h>
 #include <final/fevent.h>
+#include <final/feventarena.h>
 #include <final/fobject.h>
 #include <final/fstartoptions.h>
 #include <final/ftimer.h>
@@ -47,6 +48,7 @@
 #include <final/eventloop/timer_monitor.h>
 #include <final/input/fkeyboard.h>
 #include <final/input/fkey_map.h>
+#include <final/input/fkey_trie.h>
 #include <final/input/fmouse.h>
 #include <final/menu/fcheckmenuitem.h>
 #include <final/menu/fdialoglistmenu.h>
@@ -71,19 +73,28 @@
 #include <final/output/tty/sgr_optimizer.h>
 #include <final/util/char_ringbuffer.h>
 #include <final/util/emptyfstring.h>
+#include <final/util/fasynclogger.h>
 #include <final/util/fdata.h>
+#include <final/util/fframeprofiler.h>
 #include <final/util/flogger.h>
 #include <final/util/flog.h>
 #include <final/util/fpoint.h>
 #include <final/util/frect.h>
+#include <final/util/fsessionrecorder.h>
+#include <final/util/fsessionreplay.h>
 #include <final/util/fsize.h>
+#include <final/util/fspatialgrid.h>
 #include <final/util/fstring.h>
+#include <final/util/fstringview.h>
 #include <final/util/fsystem.h>
+#include <final/util/ftaskexecutor.h>
 #include <final/vterm/fcolorpair.h>
 #include <final/vterm/fstyle.h>
 #include <final/vterm/fvtermbuffer.h>
 #include <final/vterm/fvterm.h>
+#include <final/vterm/ftermareapool.h>
 #include <final/widget/fbusyindicator.h>
+#include <final/widget/fframeprofileroverlay.h>
 #include <final/widget/fbuttongroup.h>
 #include <final/widget/fbutton.h>
 #include <final/widget/fcheckbox.h>
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 #include "final/fc.h"
 #include "final/fevent.h"
@@ -48,10 +49,13 @@ FObject::~FObject()  // destructor
 {
   delOwnTimers();  // Delete all timers of this object
 
-  // Delete children objects
-  if ( hasChildren() )
+  // Delete children objects. The list is detached first, so that
+  // the delChild() call of each child destructor finds an empty list
+  // and the teardown of n children takes linear time.
+  while ( hasChildren() )
   {
-    auto delete_list = children_list;
+    auto delete_list = std::move(children_list);
+    children_list.clear();
 
     for (auto&& obj : delete_list)
       delete obj;
@@ -122,6 +126,7 @@ void FObject::addChild (FObject* obj) &
   obj->parent_obj = this;
   obj->has_parent = true;
   children_list.push_back(obj);
+  childListChanged();
 }
 
 //----------------------------------------------------------------------
@@ -137,6 +142,7 @@ void FObject::delChild (FObject* obj) &
   auto list_end = children_list.end();
   auto last = std::remove (children_list.begin(), list_end, obj);
   children_list.erase(last, list_end);
+  childListChanged();
 }
 
 //----------------------------------------------------------------------
@@ -151,6 +157,7 @@ void FObject::setParent (FObject* parent) &
   parent_obj = parent;
   has_parent = true;
   parent->children_list.push_back(this);
+  parent->childListChanged();
 }
 
 //----------------------------------------------------------------------
@@ -174,6 +181,13 @@ auto FObject::event (FEvent* ev) -> bool
 
 
 // protected methods of FObject
+//----------------------------------------------------------------------
+void FObject::childListChanged()
+{
+  // This method can be reimplemented in a subclass to get
+  // notified when a child object is added or removed
+}
+
 //----------------------------------------------------------------------
 void FObject::onTimer (FTimerEvent*)
 {
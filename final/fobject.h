@@ -159,6 +159,9 @@ class FObject : public FObjectTimer
     // Mutator
     void  setWidgetProperty (bool = true);
 
+    // Method
+    virtual void childListChanged();
+
     // Event handler
     virtual void onTimer (FTimerEvent*);
     virtual void onUserEvent (FUserEvent*);
@@ -52,6 +52,7 @@ FStartOptions::FStartOptions()
 #endif
   , dark_theme{false}
   , color_change{true}
+  , kitty_keyboard{true}
 { }
 
 
@@ -75,6 +76,7 @@ void FStartOptions::setDefault()
   encoding = Encoding::Unknown;
   dark_theme = false;
   terminal_focus_events = true;
+  kitty_keyboard = true;
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
   meta_sends_escape = true;
@@ -83,7 +83,8 @@ class FStartOptions final
 
     uInt16 dark_theme           : 1;
     uInt16 color_change         : 1;
-    uInt16                      : 14;  // padding bits
+    uInt16 kitty_keyboard       : 1;
+    uInt16                      : 13;  // padding bits
 
     Encoding      encoding{Encoding::Unknown};
     std::ofstream logfile_stream{};
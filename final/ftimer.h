@@ -340,6 +340,7 @@ class FObjectTimer
     // Methods
     auto addTimer (int interval) -> int
     {
+      has_own_timers = true;
       return timer->addTimer(selfPointer<FObject*>(), interval);
     }
 
@@ -350,6 +351,10 @@ class FObjectTimer
 
     auto delOwnTimers() const -> bool
     {
+      // Objects without timers do not need to search the global list
+      if ( ! has_own_timers )
+        return false;
+
       return timer->delOwnTimers(selfPointer<const FObject*>());
     }
 
@@ -392,6 +397,7 @@ class FObjectTimer
 
     // Data members
     static FTimer<FObject>* timer;
+    bool                    has_own_timers{false};
 };
 
 
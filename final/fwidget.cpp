@@ -31,6 +31,7 @@
 #include "final/menu/fmenubar.h"
 #include "final/output/tty/ftermdata.h"
 #include "final/util/flog.h"
+#include "final/util/fspatialgrid.h"
 #include "final/util/fstring.h"
 #include "final/widget/fstatusbar.h"
 #include "final/widget/fwindow.h"
@@ -61,6 +62,25 @@ FWidget::FWidgetList* FWidget::close_widget_list{nullptr};
 bool                  FWidget::init_terminal{false};
 bool                  FWidget::init_desktop{false};
 uInt                  FWidget::modal_dialog_counter{};
+uInt64                FWidget::window_geometry_generation{0};
+
+//----------------------------------------------------------------------
+// struct FWidget::FChildHitIndex
+//----------------------------------------------------------------------
+
+struct FWidget::FChildHitIndex
+{
+  // Constant
+  static constexpr std::size_t MIN_CHILDREN{16};
+
+  // Data members
+  FWidgetList  widgets{};   // Child widgets in the order of the children
+  FSpatialGrid grid{};      // Terminal geometry of the child widgets
+  bool         valid{false};
+};
+
+constexpr std::size_t FWidget::FChildHitIndex::MIN_CHILDREN;
+
 
 //----------------------------------------------------------------------
 // class FWidget
@@ -99,6 +119,7 @@ FWidget::FWidget (FWidget* parent)
   else
   {
     woffset = parent->wclient_offset;
+    geometryChanged();
   }
 
   mapEventFunctions();
@@ -316,6 +337,7 @@ void FWidget::setX (int x, bool adjust)
   if ( ! isWindowWidget() )
     x = std::max(x, 1);
 
+  geometryChanged();
   wsize.setX(x);
   adjust_wsize.setX(x);
 
@@ -332,6 +354,7 @@ void FWidget::setY (int y, bool adjust)
   if ( ! isWindowWidget() )
     y = std::max(y, 1);
 
+  geometryChanged();
   wsize.setY(y);
   adjust_wsize.setY(y);
 
@@ -356,6 +379,7 @@ void FWidget::setPos (const FPoint& p, bool adjust)
     pos.setY(std::max(pos.getY(), 1));
   }
 
+  geometryChanged();
   wsize.setPos(pos);
   adjust_wsize.setPos(pos);
 
@@ -375,6 +399,7 @@ void FWidget::setWidth (std::size_t width, bool adjust)
   // A width can never be narrower than 1 character
   width = std::max(width, std::size_t(1));
   // Set the width
+  geometryChanged();
   wsize.setWidth(width);
   adjust_wsize.setWidth(width);
 
@@ -396,6 +421,7 @@ void FWidget::setHeight (std::size_t height, bool adjust)
   // A height can never be narrower than 1 character
   height = std::max(height, std::size_t(1));
   // Set the height
+  geometryChanged();
   wsize.setHeight(height);
   adjust_wsize.setHeight(height);
 
@@ -417,6 +443,8 @@ void FWidget::setSize (const FSize& size, bool adjust)
     && getHeight() == height && wsize.getHeight() == height )
     return;
 
+  geometryChanged();
+
   // A width or a height can never be narrower than 1 character
   wsize.setSize ( std::max(width, std::size_t(1))
                 , std::max(height, std::size_t(1)) );
@@ -433,6 +461,7 @@ void FWidget::setTopPadding (int top, bool adjust)
   if ( padding.top == top )
     return;
 
+  geometryChanged();
   padding.top = top;
 
   if ( ! adjust )
@@ -454,6 +483,7 @@ void FWidget::setLeftPadding (int left, bool adjust)
   if ( padding.left == left )
     return;
 
+  geometryChanged();
   padding.left = left;
 
   if ( ! adjust )
@@ -475,6 +505,7 @@ void FWidget::setBottomPadding (int bottom, bool adjust)
   if ( padding.bottom == bottom )
     return;
 
+  geometryChanged();
   padding.bottom = bottom;
 
   if ( ! adjust )
@@ -501,6 +532,7 @@ void FWidget::setRightPadding (int right, bool adjust)
   if ( padding.right == right )
     return;
 
+  geometryChanged();
   padding.right = right;
 
   if ( ! adjust )
@@ -529,6 +561,7 @@ void FWidget::setTerminalSize (const FSize& size) const
   if ( ! FVTerm::getFOutput()->allowsTerminalSizeManipulation() )
     return;
 
+  internal::var::root_widget->geometryChanged();
   internal::var::root_widget->wsize.setRect(FPoint{1, 1}, size);
   internal::var::root_widget->adjust_wsize = internal::var::root_widget->wsize;
   FVTerm::getFOutput()->setTerminalSize(size);
@@ -550,6 +583,8 @@ void FWidget::setGeometry (const FPoint& p, const FSize& s, bool adjust)
   if ( getPos() == p && getWidth() == w && getHeight() == h )
     return;
 
+  geometryChanged();
+
   if ( isWindowWidget() )  // A window widget can be outside
   {
     wsize.setX(x);
@@ -691,17 +726,34 @@ auto FWidget::childWidgetAt (const FPoint& pos) & -> FWidget*
   if ( ! hasChildren() )
     return nullptr;
 
-  for (auto* child : getChildren())
+  if ( numOfChildren() < FChildHitIndex::MIN_CHILDREN )
   {
-    if ( ! child->isWidget() )
-      continue;
+    // A linear search is faster for a few children
+    for (auto* child : getChildren())
+    {
+      if ( ! child->isWidget() )
+        continue;
 
-    auto widget = static_cast<FWidget*>(child);
+      auto widget = static_cast<FWidget*>(child);
 
-    if ( widget->isEnabled()
-      && widget->isShown()
-      && ! widget->isWindowWidget()
-      && widget->getTermGeometry().contains(pos) )
+      if ( isChildWidgetAt(widget, pos) )
+      {
+        auto sub_child = widget->childWidgetAt(pos);
+        return ( sub_child != nullptr ) ? sub_child : widget;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Only the children in the grid cell of pos are tested
+  const auto& index = getChildHitIndex();
+
+  for (auto i : index.grid.getCandidates(pos))
+  {
+    auto widget = index.widgets[i];
+
+    if ( isChildWidgetAt(widget, pos) )
     {
       auto sub_child = widget->childWidgetAt(pos);
       return ( sub_child != nullptr ) ? sub_child : widget;
@@ -1069,6 +1121,7 @@ auto FWidget::focusLastChild() & -> bool
 //----------------------------------------------------------------------
 void FWidget::move (const FPoint& pos)
 {
+  geometryChanged();
   wsize.move(pos);
   adjust_wsize.move(pos);
 }
@@ -1165,6 +1218,7 @@ void FWidget::setMenuBar (FMenuBar* mbar)
 //----------------------------------------------------------------------
 void FWidget::setParentOffset()
 {
+  geometryChanged();
   const auto& p = getParentWidget();
 
   if ( p )
@@ -1174,6 +1228,7 @@ void FWidget::setParentOffset()
 //----------------------------------------------------------------------
 void FWidget::setTermOffset()
 {
+  geometryChanged();
   const auto& r = getRootWidget();
   const auto w = int(r->getWidth());
   const auto h = int(r->getHeight());
@@ -1183,6 +1238,7 @@ void FWidget::setTermOffset()
 //----------------------------------------------------------------------
 void FWidget::setTermOffsetWithPadding()
 {
+  geometryChanged();
   const auto& r = getRootWidget();
   woffset.setCoordinates
   (
@@ -1246,6 +1302,8 @@ void FWidget::initLayout()
 //----------------------------------------------------------------------
 void FWidget::adjustSize()
 {
+  geometryChanged();
+
   // Adjust widget size and position
   adjustWidget();
 
@@ -1346,6 +1404,14 @@ void FWidget::onKeyDown (FKeyEvent*)
   // to receive key down events for the widget
 }
 
+//----------------------------------------------------------------------
+void FWidget::onPaste (FPasteEvent*)
+{
+  // This event handler can be reimplemented in a subclass to receive
+  // pasted text as a whole. Without ev->accept(), the text is sent
+  // as single key press events.
+}
+
 //----------------------------------------------------------------------
 void FWidget::onMouseDown (FMouseEvent*)
 {
@@ -1482,6 +1548,7 @@ void FWidget::determineDesktopSize()
   detectTerminalSize();
   auto width = getDesktopWidth();
   auto height = getDesktopHeight();
+  geometryChanged();
   wsize.setRect(1, 1, width, height);
   adjust_wsize = wsize;
   woffset.setRect(0, 0, width, height);
@@ -1522,6 +1589,12 @@ inline void FWidget::mapKeyEvents()
       {
         KeyDownEvent(static_cast<FKeyEvent*>(ev));
       }
+    },
+    { Event::Paste,
+      [this] (FEvent* ev)
+      {
+        onPaste (static_cast<FPasteEvent*>(ev));
+      }
     }
   } );
 }
@@ -2292,6 +2365,69 @@ void FWidget::setStatusbarText (bool enable) const
   getStatusBar()->drawMessage();
 }
 
+//----------------------------------------------------------------------
+inline auto FWidget::isChildWidgetAt ( FWidget* widget
+                                     , const FPoint& pos ) const -> bool
+{
+  return widget->isEnabled()
+      && widget->isShown()
+      && ! widget->isWindowWidget()
+      && widget->getTermGeometry().contains(pos);
+}
+
+//----------------------------------------------------------------------
+auto FWidget::getChildHitIndex() -> const FChildHitIndex&
+{
+  // The index is rebuilt after a child geometry
+  // or the list of child objects has changed
+
+  if ( ! child_hit_index )
+    child_hit_index = std::make_unique<FChildHitIndex>();
+
+  auto& index = *child_hit_index;
+
+  if ( index.valid )
+    return index;
+
+  index.valid = true;
+  index.widgets.clear();
+  std::vector<FRect> geometries{};
+
+  for (auto* child : getChildren())
+  {
+    if ( ! child->isWidget() )
+      continue;
+
+    auto widget = static_cast<FWidget*>(child);
+    index.widgets.push_back(widget);
+    geometries.push_back(widget->getTermGeometry());
+  }
+
+  index.grid.build(geometries);
+  return index;
+}
+
+//----------------------------------------------------------------------
+void FWidget::childListChanged()
+{
+  if ( child_hit_index )
+    child_hit_index->valid = false;
+}
+
+//----------------------------------------------------------------------
+void FWidget::geometryChanged()
+{
+  // Invalidates the hit-test index that contains this widget
+
+  auto parent = getParentWidget();
+
+  if ( parent && parent->child_hit_index )
+    parent->child_hit_index->valid = false;
+
+  if ( isWindowWidget() )
+    windowGeometryChanged();
+}
+
 
 // non-member functions
 //----------------------------------------------------------------------
@@ -277,10 +277,10 @@ class FWidget : public FVTerm
     virtual auto close() -> bool;
     void  clearStatusbarMessage();
     template <typename... Args>
-    void  addCallback (FString&&, Args&&...) & noexcept;
+    void  addCallback (FSignalId, Args&&...) & noexcept;
     template <typename... Args>
     void  delCallback (Args&&...) & noexcept;
-    void  emitCallback (const FString&) const &;
+    void  emitCallback (FSignalId) const &;
     void  addAccelerator (FKey) &;
     virtual void addAccelerator (FKey, FWidget*) &;
     void  delAccelerator () &;
@@ -303,6 +303,7 @@ class FWidget : public FVTerm
   protected:
     // Accessor
     auto  getPrintArea() -> FTermArea* override;
+    static auto getWindowGeometryGeneration() noexcept -> uInt64;
     static auto getModalDialogCounter() -> uInt;
     static auto getDialogList() -> FWidgetList*&;
     static auto getAlwaysOnTopList() -> FWidgetList*&;
@@ -329,12 +330,14 @@ class FWidget : public FVTerm
     virtual void adjustSize();
     void  adjustSizeGlobal();
     void  hideArea (const FSize&);
+    static void windowGeometryChanged() noexcept;
 
     // Event handlers
     auto  event (FEvent*) -> bool override;
     virtual void onKeyPress (FKeyEvent*);
     virtual void onKeyUp (FKeyEvent*);
     virtual void onKeyDown (FKeyEvent*);
+    virtual void onPaste (FPasteEvent*);
     virtual void onMouseDown (FMouseEvent*);
     virtual void onMouseUp (FMouseEvent*);
     virtual void onMouseDoubleClick (FMouseEvent*);
@@ -354,9 +357,13 @@ class FWidget : public FVTerm
     virtual void onClose (FCloseEvent*);
 
   private:
+    // Forward declaration
+    struct FChildHitIndex;
+
     // Using-declaration
     using EventHandler = std::function<void(FEvent*)>;
     using EventMap = std::unordered_map<Event, EventHandler, EnumHash<Event>>;
+    using FChildHitIndexPtr = std::unique_ptr<FChildHitIndex>;
 
     struct WidgetSizeHints
     {
@@ -473,6 +480,10 @@ class FWidget : public FVTerm
     static void  initColorTheme();
     void  removeQueuedEvent() const;
     void  setStatusbarText (bool = true) const;
+    auto  isChildWidgetAt (FWidget*, const FPoint&) const -> bool;
+    auto  getChildHitIndex() -> const FChildHitIndex&;
+    void  childListChanged() override;
+    void  geometryChanged();
 
     // Data members
     struct FWidgetFlags  flags{};
@@ -501,6 +512,7 @@ class FWidget : public FVTerm
     FAcceleratorList     accelerator_list{};
     EventMap             event_map{};
     FCallback            callback_impl{};
+    FChildHitIndexPtr    child_hit_index{};  // Built on demand
 
     static FStatusBar*   statusbar;
     static FMenuBar*     menubar;
@@ -516,6 +528,7 @@ class FWidget : public FVTerm
     static FWidgetList*  always_on_top_list;
     static FWidgetList*  close_widget_list;
     static uInt          modal_dialog_counter;
+    static uInt64        window_geometry_generation;
     static bool          init_terminal;
     static bool          init_desktop;
 
@@ -946,9 +959,9 @@ inline void FWidget::clearStatusbarMessage()
 
 //----------------------------------------------------------------------
 template <typename... Args>
-inline void FWidget::addCallback (FString&& cb_signal, Args&&... args) & noexcept
+inline void FWidget::addCallback (FSignalId cb_signal, Args&&... args) & noexcept
 {
-  callback_impl.addCallback (std::move(cb_signal), std::forward<Args>(args)...);
+  callback_impl.addCallback (cb_signal, std::forward<Args>(args)...);
 }
 
 //----------------------------------------------------------------------
@@ -959,7 +972,7 @@ inline void FWidget::delCallback (Args&&... args) & noexcept
 }
 
 //----------------------------------------------------------------------
-inline void FWidget::emitCallback (const FString& emit_signal) const &
+inline void FWidget::emitCallback (FSignalId emit_signal) const &
 {
   callback_impl.emitCallback(emit_signal);
 }
@@ -991,6 +1004,10 @@ inline void FWidget::drawBorder()
   finalcut::drawBorder (this, FRect(FPoint{1, 1}, getSize()));
 }
 
+//----------------------------------------------------------------------
+inline auto FWidget::getWindowGeometryGeneration() noexcept -> uInt64
+{ return window_geometry_generation; }
+
 //----------------------------------------------------------------------
 inline auto FWidget::getModalDialogCounter() -> uInt
 { return modal_dialog_counter; }
@@ -1015,6 +1032,13 @@ inline auto FWidget::setModalDialogCounter() -> uInt&
 inline void FWidget::processDestroy() const
 { emitCallback("destroy"); }
 
+//----------------------------------------------------------------------
+inline void FWidget::windowGeometryChanged() noexcept
+{
+  // Invalidates the window hit-test index
+  window_geometry_generation++;
+}
+
 
 // Non-member elements for NewFont
 //----------------------------------------------------------------------
@@ -84,6 +84,27 @@ void drawGenericBox (FWidget*, const FRect&, const std::array<wchar_t, 8>&);
 void updateStatusbar (const FWidget* w, bool = true);
 void drawStatusBarMessage();
 
+// non-member function template
+//----------------------------------------------------------------------
+template <typename CacheT>
+void trimPageCache (CacheT& cache, std::size_t first, std::size_t page_size)
+{
+  // Keeps the entries (key = line number) of the previous,
+  // the current and the next page
+
+  if ( cache.size() <= 4 * page_size )
+    return;
+
+  for (auto iter = cache.begin(); iter != cache.end(); )
+  {
+    if ( iter->first + page_size < first
+      || iter->first >= first + 2 * page_size )
+      iter = cache.erase(iter);
+    else
+      ++iter;
+  }
+}
+
 }  // namespace finalcut
 
 #endif  // FWIDGET_FUNCTIONS_H
@@ -785,6 +785,7 @@ constexpr FKeyMap::KeyNameType FKeyMap::fkeyname =
   { FKey::Shift_Ctrl_Meta_menu      , {"Shift+Ctrl+Meta+Menu"} },
   { FKey::Term_Focus_In             , {"terminal focus-in"} },
   { FKey::Term_Focus_Out            , {"terminal focus-out"} },
+  { FKey::Term_Paste                , {"terminal paste"} },
   { FKey::Meta_tab                  , {"Meta+Tab"} },
   { FKey::Meta_enter                , {"Meta+Enter"} },
   { FKey::Meta_space                , {"Meta+Space"} },
@@ -65,7 +65,7 @@ class FKeyMap final
     // Using-declaration
     using KeyCapMapType = std::array<KeyCapMap, 190>;
     using KeyMapType = std::array<KeyMap, 234>;
-    using KeyNameType = std::array<KeyName, 390>;
+    using KeyNameType = std::array<KeyName, 391>;
 
     // Constructors
     FKeyMap() = default;
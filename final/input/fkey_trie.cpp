@@ -0,0 +1,79 @@
+/***********************************************************************
+* fkey_trie.cpp - Prefix tree for key sequence matching                *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include "final/input/fkey_trie.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FKeyTrie
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FKeyTrie::FKeyTrie()
+{
+  clear();
+}
+
+
+// public methods of FKeyTrie
+//----------------------------------------------------------------------
+void FKeyTrie::insert (const char* string, std::size_t length, FKey key)
+{
+  // Adds a key sequence. A later entry with
+  // the same sequence replaces the key.
+
+  if ( ! string || length == 0 || key == FKey::None )
+    return;
+
+  uInt32 index{0};  // Root node
+
+  for (std::size_t i{0}; i < length; i++)
+  {
+    auto child = findChild (index, string[i]);
+
+    if ( child == 0 )
+    {
+      child = uInt32(nodes.size());
+      Node node{};
+      node.byte = string[i];
+      node.next_sibling = nodes[index].first_child;
+      nodes.push_back(node);
+      nodes[index].first_child = child;
+    }
+
+    index = child;
+  }
+
+  nodes[index].key = key;
+}
+
+//----------------------------------------------------------------------
+void FKeyTrie::clear()
+{
+  nodes.clear();
+  nodes.emplace_back();  // Root node
+}
+
+}  // namespace finalcut
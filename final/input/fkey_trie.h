@@ -0,0 +1,149 @@
+/***********************************************************************
+* fkey_trie.h - Prefix tree for key sequence matching                  *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FKeyTrie ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// All key sequences are stored in one prefix tree. A single walk
+// over the input bytes tells whether the input is a complete key
+// sequence, the beginning of a key sequence, or whether no key
+// sequence can match anymore.
+
+#ifndef FKEYTRIE_H
+#define FKEYTRIE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <vector>
+
+#include "final/fc.h"
+#include "final/ftypes.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FKeyTrie
+//----------------------------------------------------------------------
+
+class FKeyTrie final
+{
+  public:
+    // Enumeration
+    enum class Match
+    {
+      None,    // No key sequence starts with the input
+      Prefix,  // The input is the beginning of a key sequence
+      Key      // The input is a complete key sequence
+    };
+
+    struct Result
+    {
+      Match  match{Match::None};
+      FKey   key{FKey::None};
+      bool   has_continuation{false};  // Longer sequences start with the key
+    };
+
+    // Constructor
+    FKeyTrie();
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getNodeCount() const noexcept -> std::size_t;
+
+    // Methods
+    void insert (const char*, std::size_t, FKey);
+    void clear();
+    template <typename IterT>
+    auto find (IterT, IterT) const -> Result;
+
+  private:
+    struct Node
+    {
+      FKey    key{FKey::None};
+      uInt32  first_child{0};   // 0 = no child
+      uInt32  next_sibling{0};  // 0 = no sibling
+      char    byte{'\0'};
+    };
+
+    // Method
+    auto findChild (uInt32, char) const noexcept -> uInt32;
+
+    // Data member
+    std::vector<Node>  nodes{};
+};
+
+// FKeyTrie inline functions
+//----------------------------------------------------------------------
+inline auto FKeyTrie::getClassName() const -> FString
+{ return "FKeyTrie"; }
+
+//----------------------------------------------------------------------
+inline auto FKeyTrie::getNodeCount() const noexcept -> std::size_t
+{ return nodes.size(); }
+
+//----------------------------------------------------------------------
+template <typename IterT>
+auto FKeyTrie::find (IterT iter, IterT end) const -> Result
+{
+  uInt32 index{0};  // Root node
+
+  while ( iter != end )
+  {
+    index = findChild (index, char(*iter));
+
+    if ( index == 0 )
+      return {};
+
+    ++iter;
+  }
+
+  const auto& node = nodes[index];
+
+  if ( node.key == FKey::None )
+    return { Match::Prefix, FKey::None, node.first_child != 0 };
+
+  return { Match::Key, node.key, node.first_child != 0 };
+}
+
+//----------------------------------------------------------------------
+inline auto FKeyTrie::findChild (uInt32 index, char byte) const noexcept -> uInt32
+{
+  auto child = nodes[index].first_child;
+
+  while ( child != 0 && nodes[child].byte != byte )
+    child = nodes[child].next_sibling;
+
+  return child;
+}
+
+}  // namespace finalcut
+
+#endif  // FKEYTRIE_H
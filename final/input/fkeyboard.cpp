@@ -37,6 +37,7 @@
 #include "final/input/fkey_map.h"
 #include "final/output/tty/fterm.h"
 #include "final/output/tty/ftermios.h"
+#include "final/util/fsessionrecorder.h"
 
 #if defined(__linux__)
   #include "final/output/tty/ftermlinux.h"
@@ -47,6 +48,8 @@ namespace finalcut
 
 // static class attributes
 uInt64    FKeyboard::key_timeout{100'000};             // 100 ms  (10 Hz)
+uInt64    FKeyboard::paste_timeout{1'000'000};         //   1 s
+std::size_t FKeyboard::max_paste_size{4 * 1024 * 1024};  //   4 MiB
 uInt64    FKeyboard::read_blocking_time{100'000};      // 100 ms  (10 Hz)
 uInt64    FKeyboard::read_blocking_time_short{5'000};  //   5 ms (200 Hz)
 bool      FKeyboard::non_blocking_input_support{true};
@@ -78,6 +81,8 @@ FKeyboard::FKeyboard()
                 return lhs.length < rhs.length;
               }
             );
+
+  buildKeyTrie();
 }
 
 
@@ -174,11 +179,26 @@ auto FKeyboard::isKeyPressed (uInt64 blocking_time) -> bool
   else
     tv.tv_usec = suseconds_t(read_blocking_time_short);
 
+  // A write to the wakeup file descriptor ends the waiting
+  // (e.g. when another thread has posted an event)
+  int max_fd = stdin_no;
+  FD_ZERO(&ifds);
+  FD_SET(stdin_no, &ifds);
+
+  if ( wakeup_fd >= 0 )
+  {
+    FD_SET(wakeup_fd, &ifds);
+    max_fd = std::max(max_fd, wakeup_fd);
+  }
+
   if ( ! has_pending_input
-    && select(stdin_no + 1, &ifds, nullptr, nullptr, &tv) > 0
-    && FD_ISSET(stdin_no, &ifds) )
+    && select(max_fd + 1, &ifds, nullptr, nullptr, &tv) > 0 )
   {
-    has_pending_input = true;
+    if ( wakeup_fd >= 0 && FD_ISSET(wakeup_fd, &ifds) )
+      drainWakeupFileDescriptor();
+
+    if ( FD_ISSET(stdin_no, &ifds) )
+      has_pending_input = true;
   }
 
   return has_pending_input;
@@ -192,6 +212,8 @@ void FKeyboard::clearKeyBuffer() noexcept
   fkey = FKey::None;
   key = FKey::None;
   fifo_buf.clear();
+  paste_buffer.clear();
+  is_pasting = false;
 }
 
 //----------------------------------------------------------------------
@@ -203,12 +225,29 @@ void FKeyboard::clearKeyBufferOnTimeout()
     clearKeyBuffer();
 }
 
+//----------------------------------------------------------------------
+void FKeyboard::drainWakeupFileDescriptor() const
+{
+  // Empties the (non-blocking) wakeup pipe
+
+  std::array<char, 64> buffer{};
+
+  while ( read(wakeup_fd, buffer.data(), buffer.size()) > 0 )
+    continue;
+}
+
 //----------------------------------------------------------------------
 void FKeyboard::escapeKeyHandling()
 {
   // Send an escape key press event if there is only one 0x1b
   // in the buffer and the timeout is reached
 
+  // With the kitty keyboard protocol, the Esc key and all
+  // Meta keys arrive as complete CSI u sequences. Until the terminal
+  // has sent the first CSI u sequence, the timeout remains as fallback.
+  if ( kitty_keyboard && kitty_key_received )
+    return;
+
   if ( fifo_buf.getSize() == 1
     && fifo_buf[0] == 0x1b
     && isKeypressTimeout() )
@@ -221,6 +260,20 @@ void FKeyboard::escapeKeyHandling()
   substringKeyHandling();
 }
 
+//----------------------------------------------------------------------
+void FKeyboard::pasteTimeoutHandling()
+{
+  // A bracketed paste without an end marker is handed over
+  // as Term_Paste after the paste timeout without further input
+
+  if ( ! is_pasting || ! isPasteTimeout() )
+    return;
+
+  queuePasteText (paste_buffer.size());
+  is_pasting = false;
+  fkey_queue.emplace(FKey::Term_Paste);
+}
+
 //----------------------------------------------------------------------
 void FKeyboard::processQueuedInput()
 {
@@ -229,6 +282,12 @@ void FKeyboard::processQueuedInput()
     key = fkey_queue.front();
     fkey_queue.pop();
 
+    if ( key == FKey::Term_Paste && ! paste_queue.empty() )
+    {
+      paste_text = std::move(paste_queue.front());
+      paste_queue.pop();
+    }
+
     if ( key > FKey::None )
     {
       keyPressedCommand();
@@ -283,52 +342,191 @@ inline auto FKeyboard::getMouseProtocolKey() const -> FKey
 }
 
 //----------------------------------------------------------------------
-inline auto FKeyboard::getTermcapKey() -> FKey
+auto FKeyboard::getKittyKey() -> FKey
 {
-  // Looking for termcap key strings in the buffer
-
-  static_assert ( FIFO_BUF_SIZE > 0, "FIFO buffer too small" );
+  // Looking for a kitty keyboard protocol key in the buffer
+  // CSI key-code[:alternates] [; modifiers[:event-type]] u
 
-  if ( key_cap_ptr.use_count() == 0 )
+  if ( ! kitty_keyboard )
     return NOT_SET;
 
   const auto buf_len = fifo_buf.getSize();
-  auto found_key = fkeyhashmap::getTermcapKey(fifo_buf);
 
-  if ( found_key != FKey::None )  // found
+  if ( buf_len < 4 || fifo_buf[1] != '[' || fifo_buf[buf_len - 1] != 'u' )
+    return NOT_SET;
+
+  std::array<uInt32, 2> values{};  // Key code and modifiers
+  std::size_t field{0};
+  bool sub_field{false};
+
+  for (std::size_t i{2}; i < buf_len - 1; i++)
   {
-    fifo_buf.pop(buf_len);  // Remove founded entry
-    return found_key;
+    const auto ch = fifo_buf[i];
+
+    if ( std::isdigit(uChar(ch)) )
+    {
+      if ( sub_field || field >= values.size() )
+        continue;  // Alternate key codes, event type and text are ignored
+
+      values[field] = 10 * values[field] + uInt32(ch - '0');
+
+      if ( values[field] > 0x10ffff )
+        return NOT_SET;
+    }
+    else if ( ch == ':' )
+      sub_field = true;
+    else if ( ch == ';' )
+    {
+      field++;
+      sub_field = false;
+    }
+    else
+      return NOT_SET;
   }
 
-  return NOT_SET;
+  if ( values[0] == 0 )
+    return NOT_SET;
+
+  fifo_buf.pop(buf_len);  // Remove founded entry
+  kitty_key_received = true;  // The terminal uses the protocol
+  // The modifiers are transmitted as 1 + bit mask
+  const auto modifiers = ( values[1] > 0 ) ? values[1] - 1 : 0;
+  return getKittyKeyCode (values[0], modifiers);
+}
+
+//----------------------------------------------------------------------
+auto FKeyboard::getKittyKeyCode (uInt32 code, uInt32 modifiers) -> FKey
+{
+  constexpr uInt32 shift{1};
+  constexpr uInt32 alt{2};
+  constexpr uInt32 ctrl{4};
+  modifiers &= (shift | alt | ctrl);  // Ignore super, hyper and lock keys
+
+  if ( code == 27 )
+    return FKey::Escape;
+
+  if ( code == 13 )
+    return ( modifiers & alt ) ? FKey::Meta_enter : FKey::Return;
+
+  if ( code == 9 )
+  {
+    if ( modifiers & alt )
+      return FKey::Meta_tab;
+
+    return ( modifiers & shift ) ? FKey::Back_tab : FKey::Tab;
+  }
+
+  if ( code == 127 )
+    return FKey::Backspace;
+
+  if ( (modifiers & shift) && code >= 'a' && code <= 'z' )
+    code -= 0x20;  // Upper case letter
+
+  modifiers &= ~shift;
+
+  if ( modifiers == 0 )
+    return FKey(code);
+
+  if ( code < 0x20 || code > 0x7e )
+    return FKey::None;  // No key code for this combination
+
+  if ( modifiers == ctrl )
+  {
+    if ( code == ' ' || code == '@' )
+      return FKey::Ctrl_space;
+
+    if ( code >= 'a' && code <= 'z' )
+      code -= 0x20;
+
+    if ( code >= 'A' && code <= '_' )  // Control character
+      return FKey(code & 0x1f);
+
+    return FKey::None;
+  }
+
+  if ( modifiers == alt )
+    return FKey::Meta_offset + code;
+
+  return FKey::None;
+}
+
+//----------------------------------------------------------------------
+inline auto FKeyboard::getPasteStartKey() -> FKey
+{
+  // Looking for the start of a bracketed paste (ESC [ 200 ~)
+
+  static constexpr std::array<char, 6> paste_start{{'\033', '[', '2', '0', '0', '~'}};
+
+  if ( fifo_buf.getSize() < paste_start.size()
+    || ! std::equal(paste_start.cbegin(), paste_start.cend(), std::begin(fifo_buf)) )
+    return NOT_SET;
+
+  // Buffered characters after the start marker belong to the text
+  paste_buffer.assign(std::begin(fifo_buf) + paste_start.size(), std::end(fifo_buf));
+  fifo_buf.clear();
+  is_pasting = true;
+
+  if ( completePasteText(0) )
+    return FKey::Term_Paste;
+
+  return FKey::Incomplete;  // The text follows
 }
 
 //----------------------------------------------------------------------
-inline auto FKeyboard::getKnownKey() -> FKey
+inline auto FKeyboard::getSequenceKey() -> FKey
 {
-  // Looking for a known key strings in the buffer
+  // Looking for a termcap or known key sequence in the buffer
 
-  static_assert ( FIFO_BUF_SIZE > 0, "FIFO buffer too small" );
   const auto buf_len = fifo_buf.getSize();
-  auto found_key = fkeyhashmap::getKnownKey(fifo_buf);
+  const auto result = key_trie.find(std::begin(fifo_buf), std::end(fifo_buf));
 
-  if ( found_key != FKey::None )  // found
+  if ( result.match == FKeyTrie::Match::Key )
   {
-    if ( buf_len == 2
-      && ( fifo_buf[1] == 'O'
-        || fifo_buf[1] == '['
-        || fifo_buf[1] == ']' )
-      && ! isKeypressTimeout() )
-    {
+    // Keys like Meta-O or Meta-[ are also the beginning of longer
+    // key sequences, Meta-] is the beginning of an OSC terminal reply
+    const bool is_osc_start( buf_len == 2 && fifo_buf[1] == ']' );
+
+    if ( (result.has_continuation || is_osc_start) && ! isKeypressTimeout() )
       return FKey::Incomplete;
-    }
 
     fifo_buf.pop(buf_len);  // Remove founded entry
-    return found_key;
+    return result.key;
   }
 
-  return NOT_SET;
+  // Prefix of a key sequence or an unfinished control sequence:
+  // wait for further characters until the timeout
+  if ( result.match == FKeyTrie::Match::Prefix || isIncompleteSequence() )
+    return NOT_SET;
+
+  // No key sequence can match anymore, so the characters
+  // are processed at once instead of after the timeout
+  return getSingleKey();
+}
+
+//----------------------------------------------------------------------
+inline auto FKeyboard::isIncompleteSequence() const -> bool
+{
+  // A CSI sequence without its final byte (e.g. a mouse report or
+  // a kitty key that is not yet complete) or an OSC terminal reply
+  // can still become a valid input
+
+  const auto buf_len = fifo_buf.getSize();
+
+  if ( buf_len < 2 || fifo_buf[1] == ']' )
+    return true;
+
+  if ( fifo_buf[1] != '[' )
+    return false;
+
+  for (std::size_t i{2}; i < buf_len; i++)
+  {
+    const auto ch = uChar(fifo_buf[i]);
+
+    if ( ch < 0x20 || ch > 0x3f )  // Final byte or invalid character
+      return false;
+  }
+
+  return true;  // Only parameter and intermediate bytes
 }
 
 //----------------------------------------------------------------------
@@ -389,6 +587,30 @@ inline auto FKeyboard::isKeypressTimeout() -> bool
   return FObjectTimer::isTimeout (time_keypressed, key_timeout);
 }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::isPasteTimeout() -> bool
+{
+  return FObjectTimer::isTimeout (time_keypressed, paste_timeout);
+}
+
+//----------------------------------------------------------------------
+void FKeyboard::buildKeyTrie()
+{
+  // The termcap keys are inserted last and take precedence
+  // over the known keys with the same sequence
+
+  key_trie.clear();
+
+  for (const auto& item : FKeyMap::getKeyMap())
+    key_trie.insert (item.string.data(), item.length, item.num);
+
+  if ( ! key_cap_ptr )
+    return;
+
+  for (auto iter = key_cap_ptr->cbegin(); iter != key_cap_end; ++iter)
+    key_trie.insert (iter->string, iter->length, iter->num);
+}
+
 //----------------------------------------------------------------------
 auto FKeyboard::UTF8decode (const std::size_t len) const noexcept -> FKey
 {
@@ -443,6 +665,11 @@ inline auto FKeyboard::readKey() -> ssize_t
   setNonBlockingInput();
   const ssize_t bytes = read(FTermios::getStdIn(), &read_character, 1);
   unsetNonBlockingInput();
+  static auto& recorder = FSessionRecorder::getInstance();
+
+  if ( bytes > 0 )
+    recorder.recordInput (&read_character, std::size_t(bytes));
+
   return bytes;
 }
 
@@ -454,11 +681,13 @@ void FKeyboard::parseKeyBuffer()
     time_keypressed = FObjectTimer::getCurrentTime();
     has_pending_input = false;
 
-    if ( ! fifo_buf.isFull() )
+    if ( is_pasting )
+      readPasteText();
+    else if ( ! fifo_buf.isFull() )
       fifo_buf.push(read_character);
 
     // Read the rest from the fifo buffer
-    while ( fifo_buf.hasData() && fkey != FKey::Incomplete )
+    while ( ! is_pasting && fifo_buf.hasData() && fkey != FKey::Incomplete )
     {
       fkey = parseKeyString();
       fkey = keyCorrection(fkey);
@@ -467,9 +696,16 @@ void FKeyboard::parseKeyBuffer()
         || fkey == FKey::Extended_mouse
         || fkey == FKey::Urxvt_mouse )
       {
+        // The mouse report is decoded and removed from the buffer
+        // by the command, the following input is parsed in this pass
+        const auto buf_len = fifo_buf.getSize();
         key = fkey;
         mouseTrackingCommand();
-        break;
+
+        if ( fifo_buf.getSize() == buf_len )
+          break;  // Report was not consumed
+
+        continue;
       }
 
       if ( fkey != FKey::Incomplete )
@@ -483,6 +719,101 @@ void FKeyboard::parseKeyBuffer()
   }
 }
 
+//----------------------------------------------------------------------
+void FKeyboard::readPasteText()
+{
+  // Collects the pasted text up to the end marker. The text is read
+  // in large blocks and is queued as a single Term_Paste key instead
+  // of one key per character. Text longer than max_paste_size is
+  // handed over in several Term_Paste keys.
+
+  paste_buffer.push_back(read_character);
+  auto search_start = paste_buffer.size() - 1;
+  std::array<char, 4096> block{};
+  static auto& recorder = FSessionRecorder::getInstance();
+  setNonBlockingInput();
+
+  while ( ! completePasteText(search_start) )
+  {
+    if ( paste_buffer.size() >= max_paste_size )
+    {
+      // Keeps a possibly split end marker or UTF-8 character
+      // in the buffer and reads the rest in the next pass
+      auto length = paste_buffer.size();
+      length -= std::min(length, std::size_t(5));
+
+      while ( length > 0 && (uChar(paste_buffer[length]) & 0xc0) == 0x80 )
+        length--;
+
+      if ( length > 0 )
+      {
+        queuePasteText (length);
+        fkey_queue.emplace(FKey::Term_Paste);
+      }
+
+      break;
+    }
+
+    const auto max_bytes = std::min(block.size(), max_paste_size - paste_buffer.size());
+    const auto bytes = read(FTermios::getStdIn(), block.data(), max_bytes);
+
+    if ( bytes <= 0 )
+      break;  // Wait for more text
+
+    recorder.recordInput (block.data(), std::size_t(bytes));
+    search_start = paste_buffer.size();
+    paste_buffer.append(block.data(), std::size_t(bytes));
+  }
+
+  unsetNonBlockingInput();
+
+  if ( ! is_pasting )
+    fkey_queue.emplace(FKey::Term_Paste);
+}
+
+//----------------------------------------------------------------------
+auto FKeyboard::completePasteText (std::size_t search_start) -> bool
+{
+  // Looking for the end of a bracketed paste (ESC [ 201 ~)
+  // in the text that has been added since search_start
+
+  static constexpr char paste_end[] = "\033[201~";
+  static constexpr std::size_t paste_end_length = sizeof(paste_end) - 1;
+  search_start = ( search_start >= paste_end_length - 1 )
+               ? search_start - (paste_end_length - 1)
+               : 0;
+  const auto end_pos = paste_buffer.find(paste_end, search_start);
+
+  if ( end_pos == std::string::npos )
+    return false;
+
+  // Characters after the end marker are regular key input
+  for (auto i = end_pos + paste_end_length; i < paste_buffer.size(); i++)
+    if ( ! fifo_buf.isFull() )
+      fifo_buf.push(paste_buffer[i]);
+
+  paste_buffer.resize(end_pos);
+  queuePasteText (paste_buffer.size());
+  is_pasting = false;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FKeyboard::queuePasteText (std::size_t length)
+{
+  // Moves the first length bytes of the pasted text into the paste queue
+
+  if ( length >= paste_buffer.size() )
+  {
+    paste_queue.push(std::move(paste_buffer));
+    paste_buffer.clear();
+    return;
+  }
+
+  paste_queue.push(paste_buffer.substr(0, length));
+  paste_buffer.erase(0, length);
+}
+
 //----------------------------------------------------------------------
 auto FKeyboard::parseKeyString() -> FKey
 {
@@ -499,12 +830,17 @@ auto FKeyboard::parseKeyString() -> FKey
   if ( keycode != NOT_SET )
     return keycode;
 
-  keycode = getTermcapKey();
+  keycode = getKittyKey();
+
+  if ( keycode != NOT_SET )
+    return keycode;
+
+  keycode = getPasteStartKey();
 
   if ( keycode != NOT_SET )
     return keycode;
 
-  keycode = getKnownKey();
+  keycode = getSequenceKey();
 
   if ( keycode != NOT_SET )
     return keycode;
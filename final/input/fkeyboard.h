@@ -41,12 +41,14 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <queue>
 #include <string>
 #include <utility>
 
 #include "final/ftypes.h"
 #include "final/input/fkey_hashmap.h"
 #include "final/input/fkey_map.h"
+#include "final/input/fkey_trie.h"
 #include "final/util/char_ringbuffer.h"
 #include "final/util/fstring.h"
 
@@ -117,14 +119,20 @@ class FKeyboard final
     auto  getKeyName (const FKey) const -> FString;
     auto  getKeyBuffer() & noexcept -> keybuffer&;
     auto  getKeyPressedTime() const noexcept -> TimeValue;
+    auto  getPasteText() const & noexcept -> const std::string&;
     static auto  getKeypressTimeout() noexcept -> uInt64;
+    static auto  getPasteTimeout() noexcept -> uInt64;
+    static auto  getMaxPasteSize() noexcept -> std::size_t;
     static auto  getReadBlockingTime() noexcept -> uInt64;
+    auto  getWakeupFileDescriptor() const noexcept -> int;
 
     // Mutators
     template <typename T>
     void  setTermcapMap (const T&);
     void  setTermcapMap();
     static void  setKeypressTimeout (const uInt64) noexcept;
+    static void  setPasteTimeout (const uInt64) noexcept;
+    static void  setMaxPasteSize (const std::size_t) noexcept;
     static void  setReadBlockingTime (const uInt64) noexcept;
     static void  setNonBlockingInputSupport (bool = true) noexcept;
     void  setNonBlockingInput (bool = true);
@@ -133,22 +141,29 @@ class FKeyboard final
     void  disableUTF8() noexcept;
     void  enableMouseSequences() noexcept;
     void  disableMouseSequences() noexcept;
+    void  enableKittyKeyboard() noexcept;
+    void  disableKittyKeyboard() noexcept;
     void  setPressCommand (const FKeyboardCommand&);
     void  setReleaseCommand (const FKeyboardCommand&);
     void  setEscPressedCommand (const FKeyboardCommand&);
     void  setMouseTrackingCommand (const FKeyboardCommand&);
+    void  setWakeupFileDescriptor (int) noexcept;
 
     // Inquiry
     auto  hasPendingInput() const noexcept -> bool;
     auto  hasDataInQueue() const -> bool;
+    auto  hasKittyKeyboard() const noexcept -> bool;
+    auto  isPasting() const noexcept -> bool;
 
     // Methods
     auto  hasUnprocessedInput() const noexcept -> bool;
     auto  isKeyPressed (uInt64 = read_blocking_time) -> bool;
     void  clearKeyBuffer() noexcept;
     void  clearKeyBufferOnTimeout();
+    void  drainWakeupFileDescriptor() const;
     void  fetchKeyCode();
     void  escapeKeyHandling();
+    void  pasteTimeoutHandling();
     void  processQueuedInput();
 
   private:
@@ -160,21 +175,30 @@ class FKeyboard final
     using FKeyMapPtr = std::shared_ptr<FKeyMap::KeyCapMapType>;
     using KeyMapEnd = FKeyMap::KeyCapMapType::const_iterator;
     using KeyQueue = FRingBuffer<FKey, MAX_QUEUE_SIZE>;
+    using PasteQueue = std::queue<std::string>;
 
     // Accessors
     auto  getMouseProtocolKey() const -> FKey;
-    auto  getTermcapKey() -> FKey;
-    auto  getKnownKey() -> FKey;
+    auto  getKittyKey() -> FKey;
+    auto  getPasteStartKey() -> FKey;
+    static auto getKittyKeyCode (uInt32, uInt32) -> FKey;
+    auto  getSequenceKey() -> FKey;
+    auto  isIncompleteSequence() const -> bool;
     auto  getSingleKey() -> FKey;
 
     // Inquiry
     static auto isKeypressTimeout() -> bool;
     static auto isIntervalTimeout() -> bool;
+    static auto isPasteTimeout() -> bool;
 
     // Methods
+    void  buildKeyTrie();
     auto  UTF8decode (const std::size_t) const noexcept -> FKey;
     auto  readKey() -> ssize_t;
     void  parseKeyBuffer();
+    void  readPasteText();
+    auto  completePasteText (std::size_t) -> bool;
+    void  queuePasteText (std::size_t);
     auto  parseKeyString() -> FKey;
     auto  keyCorrection (const FKey&) const -> FKey;
     void  substringKeyHandling();
@@ -193,19 +217,29 @@ class FKeyboard final
     static uInt64     read_blocking_time;
     static uInt64     read_blocking_time_short;
     static uInt64     key_timeout;
+    static uInt64     paste_timeout;
+    static std::size_t max_paste_size;
     static bool       non_blocking_input_support;
     FKeyMapPtr        key_cap_ptr{};
     KeyMapEnd         key_cap_end{};
+    FKeyTrie          key_trie{};  // Known and termcap key sequences
     keybuffer         fifo_buf{};
     KeyQueue          fkey_queue{};
+    PasteQueue        paste_queue{};   // Text of each queued Term_Paste
+    std::string       paste_buffer{};  // Bracketed paste in progress
+    std::string       paste_text{};
     FKey              fkey{FKey::None};
     FKey              key{FKey::None};
     int               stdin_status_flags{0};
+    int               wakeup_fd{-1};  // Interrupts the waiting for input
     char              read_character{};
     bool              has_pending_input{false};
     bool              fifo_in_use{false};
     bool              utf8_input{false};
     bool              mouse_support{true};
+    bool              kitty_keyboard{false};  // CSI u key sequences
+    bool              kitty_key_received{false};
+    bool              is_pasting{false};
     bool              non_blocking_stdin{false};
 };
 
@@ -226,14 +260,30 @@ inline auto FKeyboard::getKeyBuffer() & noexcept -> keybuffer&
 inline auto FKeyboard::getKeyPressedTime() const noexcept -> TimeValue
 { return time_keypressed; }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::getPasteText() const & noexcept -> const std::string&
+{ return paste_text; }
+
 //----------------------------------------------------------------------
 inline auto FKeyboard::getKeypressTimeout() noexcept -> uInt64
 { return key_timeout; }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::getPasteTimeout() noexcept -> uInt64
+{ return paste_timeout; }
+
+//----------------------------------------------------------------------
+inline auto FKeyboard::getMaxPasteSize() noexcept -> std::size_t
+{ return max_paste_size; }
+
 //----------------------------------------------------------------------
 inline auto FKeyboard::getReadBlockingTime() noexcept -> uInt64
 { return read_blocking_time; }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::getWakeupFileDescriptor() const noexcept -> int
+{ return wakeup_fd; }
+
 //----------------------------------------------------------------------
 template <typename T>
 inline void FKeyboard::setTermcapMap (const T& keymap)
@@ -241,6 +291,7 @@ inline void FKeyboard::setTermcapMap (const T& keymap)
   key_cap_ptr = std::make_shared<T>(keymap);
   key_cap_end = key_cap_ptr->cend();
   fkeyhashmap::setKeyCapMap<keybuffer>(key_cap_ptr->cbegin(), key_cap_end);
+  buildKeyTrie();
 }
 
 //----------------------------------------------------------------------
@@ -255,12 +306,21 @@ inline void FKeyboard::setTermcapMap()
                                { return entry.length == 0; }
                              );
   fkeyhashmap::setKeyCapMap<keybuffer>(key_cap_ptr->cbegin(), key_cap_end);
+  buildKeyTrie();
 }
 
 //----------------------------------------------------------------------
 inline void FKeyboard::setKeypressTimeout (const uInt64 timeout) noexcept
 { key_timeout = timeout; }
 
+//----------------------------------------------------------------------
+inline void FKeyboard::setPasteTimeout (const uInt64 timeout) noexcept
+{ paste_timeout = timeout; }
+
+//----------------------------------------------------------------------
+inline void FKeyboard::setMaxPasteSize (const std::size_t size) noexcept
+{ max_paste_size = size; }
+
 //----------------------------------------------------------------------
 inline void FKeyboard::setReadBlockingTime (const uInt64 blocking_time) noexcept
 { read_blocking_time = blocking_time; }
@@ -281,6 +341,14 @@ inline auto FKeyboard::hasPendingInput() const noexcept -> bool
 inline auto FKeyboard::hasDataInQueue() const -> bool
 { return ! fkey_queue.isEmpty(); }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::isPasting() const noexcept -> bool
+{ return is_pasting; }
+
+//----------------------------------------------------------------------
+inline auto FKeyboard::hasKittyKeyboard() const noexcept -> bool
+{ return kitty_keyboard; }
+
 //----------------------------------------------------------------------
 inline void FKeyboard::enableUTF8() noexcept
 { utf8_input = true; }
@@ -297,6 +365,20 @@ inline void FKeyboard::enableMouseSequences() noexcept
 inline void FKeyboard::disableMouseSequences() noexcept
 { mouse_support = false; }
 
+//----------------------------------------------------------------------
+inline void FKeyboard::enableKittyKeyboard() noexcept
+{
+  kitty_keyboard = true;
+  kitty_key_received = false;
+}
+
+//----------------------------------------------------------------------
+inline void FKeyboard::disableKittyKeyboard() noexcept
+{
+  kitty_keyboard = false;
+  kitty_key_received = false;
+}
+
 //----------------------------------------------------------------------
 inline void FKeyboard::setPressCommand (const FKeyboardCommand& cmd)
 { keypressed_cmd = cmd; }
@@ -313,6 +395,10 @@ inline void FKeyboard::setEscPressedCommand (const FKeyboardCommand& cmd)
 inline void FKeyboard::setMouseTrackingCommand (const FKeyboardCommand& cmd)
 { mouse_tracking_cmd = cmd; }
 
+//----------------------------------------------------------------------
+inline void FKeyboard::setWakeupFileDescriptor (int fd) noexcept
+{ wakeup_fd = fd; }
+
 }  // namespace finalcut
 
 #endif  // FKEYBOARD_H
@@ -46,22 +46,27 @@ namespace finalcut
 
 // Function prototypes
 template <typename NumT, typename UnaryPredicate>
-auto parseNumberIf (const char*&, NumT&, UnaryPredicate) -> bool;
+auto parseNumberIf ( const FKeyboard::keybuffer&, std::size_t&
+                   , std::size_t, NumT&, UnaryPredicate ) -> bool;
 
 // non-member functions
 //----------------------------------------------------------------------
 template <typename NumT, typename UnaryPredicate>
-inline auto parseNumberIf ( const char*& p
+inline auto parseNumberIf ( const FKeyboard::keybuffer& fifo_buf
+                          , std::size_t& pos
+                          , std::size_t end
                           , NumT& number
                           , UnaryPredicate up ) -> bool
 {
-  while ( *p && up(*p) )
+  // Reads the decimal number at pos directly from the key buffer
+
+  while ( pos < end && up(fifo_buf[pos]) )
   {
-    if ( ! std::isdigit(*p) )
+    if ( ! std::isdigit(fifo_buf[pos]) )
       return false;
 
-    number = 10 * number + (*p - '0');
-    p++;
+    number = 10 * number + (fifo_buf[pos] - '0');
+    pos++;
   }
 
   return true;
@@ -605,17 +610,28 @@ inline void FMouseGPM::updateMousePosition()
 //----------------------------------------------------------------------
 auto FMouseGPM::gpmEvent (bool clear) const -> gpmEventType
 {
-  const int max = std::max(gpm_fd, stdin_no);
+  static const auto& keyboard = FKeyboard::getInstance();
+  const int wakeup_fd = keyboard.getWakeupFileDescriptor();
+  const int max = std::max({gpm_fd, stdin_no, wakeup_fd});
   fd_set ifds{};
   struct timeval tv{};
 
   FD_ZERO(&ifds);
   FD_SET(stdin_no, &ifds);
   FD_SET(gpm_fd, &ifds);
+
+  if ( wakeup_fd >= 0 )  // Posted events end the waiting
+    FD_SET(wakeup_fd, &ifds);
+
   tv.tv_sec  = 0;
   tv.tv_usec = suseconds_t(FKeyboard::getReadBlockingTime());  // preset to 100 ms
   const int result = select (max + 1, &ifds, nullptr, nullptr, &tv);
 
+  // Empty the wakeup pipe, otherwise a byte left behind
+  // would end every further select() immediately
+  if ( result > 0 && wakeup_fd >= 0 && FD_ISSET(wakeup_fd, &ifds) )
+    keyboard.drainWakeupFileDescriptor();
+
   if ( result > 0 && FD_ISSET(stdin_no, &ifds) )
   {
     if ( clear )
@@ -624,11 +640,13 @@ auto FMouseGPM::gpmEvent (bool clear) const -> gpmEventType
     return gpmEventType::Keyboard;
   }
 
-  if ( clear && result > 0 && FD_ISSET(gpm_fd, &ifds) )
-    FD_CLR (gpm_fd, &ifds);
+  if ( result > 0 && FD_ISSET(gpm_fd, &ifds) )
+  {
+    if ( clear )
+      FD_CLR (gpm_fd, &ifds);
 
-  if ( result > 0 )
     return gpmEventType::Mouse;
+  }
 
   return gpmEventType::None;
 }
@@ -656,19 +674,24 @@ auto FMouseX11::getClassName() const -> FString
 //----------------------------------------------------------------------
 auto FMouseX11::hasData() noexcept -> bool
 {
-  return ( x11_mouse[0] );
+  return has_x11_data;
 }
 
 //----------------------------------------------------------------------
 void FMouseX11::setRawData (FKeyboard::keybuffer& fifo_buf) noexcept
 {
-  // Import the X11 xterm mouse protocol (SGR-Mode) raw mouse data
+  // Decode the X11 xterm mouse report (ESC [ M btn x y)
+  // directly from the key buffer
 
   static constexpr std::size_t len = 6;
-  x11_mouse[0] = fifo_buf[3];
-  x11_mouse[1] = fifo_buf[4];
-  x11_mouse[2] = fifo_buf[5];
-  x11_mouse[3] = '\0';
+
+  if ( fifo_buf.getSize() < len )
+    return;
+
+  x11_tokens.btn = uChar(fifo_buf[3]);
+  x11_tokens.x = uChar(fifo_buf[4] - 0x20);
+  x11_tokens.y = uChar(fifo_buf[5] - 0x20);
+  has_x11_data = true;
   fifo_buf.pop(len);  // Remove founded entry
   setPending(fifo_buf.hasData());
 }
@@ -676,12 +699,13 @@ void FMouseX11::setRawData (FKeyboard::keybuffer& fifo_buf) noexcept
 //----------------------------------------------------------------------
 void FMouseX11::processEvent (const TimeValue& time)
 {
-  // Parse and interpret the X11 xterm mouse string
+  // Interpret the X11 xterm mouse report
 
   const auto& mouse_position = getPos();
-  const auto x = uChar(x11_mouse[1] - 0x20);
-  const auto y = uChar(x11_mouse[2] - 0x20);
-  const int btn = uChar(x11_mouse[0]);
+  const auto x = x11_tokens.x;
+  const auto y = x11_tokens.y;
+  const int btn = x11_tokens.btn;
+  has_x11_data = false;  // Delete already interpreted data
   setNewPos (x, y);
   clearButtonState();
   setKeyState (btn);
@@ -691,7 +715,6 @@ void FMouseX11::processEvent (const TimeValue& time)
   if ( noChanges(mouse_position, uChar(btn)) )
   {
     clearEvent();
-    x11_mouse[0] = '\0';  // Delete already interpreted data
     return;
   }
 
@@ -699,8 +722,6 @@ void FMouseX11::processEvent (const TimeValue& time)
   setPos (FPoint{x, y});
   // Get the button state from string
   x11_button_state = uChar(btn);
-  // Delete already interpreted data
-  x11_mouse[0] = '\0';
 }
 
 
@@ -899,34 +920,36 @@ auto FMouseSGR::getClassName() const -> FString
 //----------------------------------------------------------------------
 auto FMouseSGR::hasData() noexcept -> bool
 {
-  return ( sgr_mouse[0] );
+  return has_sgr_data;
 }
 
 //----------------------------------------------------------------------
 void FMouseSGR::setRawData (FKeyboard::keybuffer& fifo_buf) noexcept
 {
-  // Import the X11 xterm mouse protocol (SGR-Mode) raw mouse data
+  // Decode the X11 xterm mouse report in SGR mode
+  // (ESC [ < btn ; x ; y M/m) directly from the key buffer
 
   const auto max = fifo_buf.getSize();
-  std::size_t len{0};
-  std::size_t n{3};
 
-  while ( n < max )
-  {
-    sgr_mouse[n - 3] = fifo_buf[n];
+  if ( max <= 3 )
+    return;
 
-    if ( fifo_buf[n] == 'M' || fifo_buf[n] == 'm' )
-    {
-      n++;
-      len = n;
-      break;
-    }
+  std::size_t end{3};
+
+  while ( end < max && fifo_buf[end] != pressed && fifo_buf[end] != released )
+    end++;
 
-    n++;
+  sgr_tokens = {};
+  has_sgr_data = true;
+
+  if ( end < max )
+  {
+    sgr_parse_error = parseSGRMouseString(fifo_buf, end, sgr_tokens);
+    fifo_buf.pop(end + 1);  // Remove founded entry
   }
+  else  // No final character
+    sgr_parse_error = ParseError::Yes;
 
-  sgr_mouse[n - 3] = '\0';
-  fifo_buf.pop(len);  // Remove founded entry
   setPending(fifo_buf.hasData());
 }
 
@@ -934,12 +957,12 @@ void FMouseSGR::setRawData (FKeyboard::keybuffer& fifo_buf) noexcept
 void FMouseSGR::processEvent (const TimeValue& time)
 {
   const auto& mouse_position = getPos();
-  Tokens token{};
+  const auto& token = sgr_tokens;
+  has_sgr_data = false;  // Delete already interpreted data
 
-  if ( parseSGRMouseString(token) == ParseError::Yes )
+  if ( sgr_parse_error == ParseError::Yes )
   {
     clearEvent();
-    sgr_mouse[0] = '\0';  // Delete already interpreted data
     return;
   }
 
@@ -948,24 +971,21 @@ void FMouseSGR::processEvent (const TimeValue& time)
   setKeyState (token.btn);
   setMoveState (mouse_position, token.btn);
 
-  if ( *token.p == pressed )
+  if ( token.action == pressed )
     setPressedButtonState (token.btn & button_mask, time);
-  else  // *token.p == released
+  else  // token.action == released
     setReleasedButtonState (token.btn & button_mask);
 
-  if ( noChanges(mouse_position, uChar(((*token.p & 0x20) << 2) + token.btn)) )
+  if ( noChanges(mouse_position, uChar(((token.action & 0x20) << 2) + token.btn)) )
   {
     clearEvent();
-    sgr_mouse[0] = '\0';  // Delete already interpreted data
     return;
   }
 
   setEvent();
   useNewPos();
   // Get the button state from string
-  sgr_button_state = uChar(((*token.p & 0x20) << 2) + token.btn);
-  // Delete already interpreted data
-  sgr_mouse[0] = '\0';
+  sgr_button_state = uChar(((token.action & 0x20) << 2) + token.btn);
 }
 
 // private methods of FMouseSGR
@@ -1014,29 +1034,33 @@ inline auto FMouseSGR::isMouseWheelButton (const int btn) const noexcept -> bool
 }
 
 //----------------------------------------------------------------------
-inline auto FMouseSGR::parseSGRMouseString (FMouseSGR::Tokens& token) const noexcept -> ParseError
+inline auto FMouseSGR::parseSGRMouseString ( const FKeyboard::keybuffer& fifo_buf
+                                            , std::size_t end
+                                            , FMouseSGR::Tokens& token ) noexcept -> ParseError
 {
-  // Parse the SGR mouse string
-  token.p = sgr_mouse.data();
+  // Parse the SGR mouse string between the prefix and
+  // the final character at position end
+  std::size_t pos{3};
 
   // Parse button
-  if ( ! parseNumberIf (token.p, token.btn, [] (char ch) { return ch != ';'; }) )
+  if ( ! parseNumberIf (fifo_buf, pos, end, token.btn, [] (char ch) { return ch != ';'; }) )
     return ParseError::Yes;
 
-  if ( *token.p )
-    token.p++;  // ship one character after the number
+  if ( pos < end )
+    pos++;  // ship one character after the number
 
   // Parse x-value
-  if ( ! parseNumberIf (token.p, token.x, [] (char ch) { return ch != ';'; }) )
+  if ( ! parseNumberIf (fifo_buf, pos, end, token.x, [] (char ch) { return ch != ';'; }) )
     return ParseError::Yes;
 
-  if ( *token.p )
-    token.p++;  // ship one character after the number
+  if ( pos < end )
+    pos++;  // ship one character after the number
 
   // Parse y-value
-  if ( ! parseNumberIf (token.p, token.y, [] (char ch) { return ch != 'M' && ch != 'm'; }) )
+  if ( ! parseNumberIf (fifo_buf, pos, end, token.y, [] (char) { return true; }) )
     return ParseError::Yes;
 
+  token.action = fifo_buf[end];
   return ParseError::No;
 }
 
@@ -1189,49 +1213,51 @@ auto FMouseUrxvt::getClassName() const -> FString
 //----------------------------------------------------------------------
 auto FMouseUrxvt::hasData() noexcept -> bool
 {
-  return ( urxvt_mouse[0] );
+  return has_urxvt_data;
 }
 
 //----------------------------------------------------------------------
 void FMouseUrxvt::setRawData (FKeyboard::keybuffer& fifo_buf) noexcept
 {
-  // Import the X11 xterm mouse protocol (Urxvt-Mode) raw mouse data
+  // Decode the X11 xterm mouse report in Urxvt mode
+  // (ESC [ btn ; x ; y M) directly from the key buffer
 
   const auto max = fifo_buf.getSize();
-  std::size_t len{0};
-  std::size_t n{2};
 
-  while ( n < max )
-  {
-    urxvt_mouse[n - 2] = fifo_buf[n];
+  if ( max <= 2 )
+    return;
 
-    if ( fifo_buf[n] == 'M' || fifo_buf[n] == 'm' )
-    {
-      n++;
-      len = n;
-      break;
-    }
+  std::size_t end{2};
 
-    n++;
+  while ( end < max && fifo_buf[end] != 'M' && fifo_buf[end] != 'm' )
+    end++;
+
+  urxvt_tokens = {};
+  has_urxvt_data = true;
+
+  if ( end < max )
+  {
+    urxvt_parse_error = parseUrxvtMouseString(fifo_buf, end, urxvt_tokens);
+    fifo_buf.pop(end + 1);  // Remove founded entry
   }
+  else  // No final character
+    urxvt_parse_error = ParseError::Yes;
 
-  urxvt_mouse[n - 2] = '\0';
-  fifo_buf.pop(len);  // Remove founded entry
   setPending(fifo_buf.hasData());
 }
 
 //----------------------------------------------------------------------
 void FMouseUrxvt::processEvent (const TimeValue& time)
 {
-  // Parse and interpret the X11 xterm mouse string (Urxvt-Mode)
+  // Interpret the X11 xterm mouse report (Urxvt-Mode)
 
   const auto& mouse_position = getPos();
-  Tokens token{};
+  auto& token = urxvt_tokens;
+  has_urxvt_data = false;  // Delete already interpreted data
 
-  if ( parseUrxvtMouseString(token) == ParseError::Yes )
+  if ( urxvt_parse_error == ParseError::Yes )
   {
     clearEvent();
-    urxvt_mouse[0] = '\0';  // Delete already interpreted data
     return;
   }
 
@@ -1244,15 +1270,12 @@ void FMouseUrxvt::processEvent (const TimeValue& time)
   if ( noChanges(mouse_position, uChar(token.btn)) )
   {
     clearEvent();
-    urxvt_mouse[0] = '\0';  // Delete already interpreted data
     return;
   }
 
   setEvent();
   useNewPos();
   urxvt_button_state = uChar(token.btn);
-  // Delete already interpreted data
-  urxvt_mouse[0] = '\0';
 }
 
 
@@ -1302,33 +1325,37 @@ inline auto FMouseUrxvt::isMouseWheelButton (const int btn) const noexcept -> bo
 }
 
 //----------------------------------------------------------------------
-inline auto FMouseUrxvt::parseUrxvtMouseString (FMouseUrxvt::Tokens& token) const noexcept -> ParseError
+inline auto FMouseUrxvt::parseUrxvtMouseString ( const FKeyboard::keybuffer& fifo_buf
+                                                , std::size_t end
+                                                , FMouseUrxvt::Tokens& token ) noexcept -> ParseError
 {
-  // Parse the Urxvt mouse string
-  token.p = urxvt_mouse.data();
+  // Parse the Urxvt mouse string between the prefix and
+  // the final character at position end
+  std::size_t pos{2};
 
   // Parse button
-  if ( ! parseNumberIf (token.p, token.btn, [] (char ch) { return ch != ';'; }) )
+  if ( ! parseNumberIf (fifo_buf, pos, end, token.btn, [] (char ch) { return ch != ';'; }) )
     return ParseError::Yes;
 
-  if ( *++token.p == '-' )
+  if ( ++pos < end && fifo_buf[pos] == '-' )
   {
-    token.p++;
+    pos++;
     token.x_neg = true;
   }
 
   // Parse x-value
-  if ( ! parseNumberIf (token.p, token.x, [] (char ch) { return ch != ';'; }) )
+  if ( ! parseNumberIf (fifo_buf, pos, end, token.x, [] (char ch) { return ch != ';'; }) )
     return ParseError::Yes;
 
-  if ( *++token.p == '-' )
+  if ( ++pos < end && fifo_buf[pos] == '-' )
   {
-    token.p++;
+    pos++;
     token.y_neg = true;
   }
 
   // Parse y-value
-  if ( ! parseNumberIf (token.p, token.y, [] (char ch) { return ch != 'M'; }) )
+  if ( fifo_buf[end] != 'M'
+    || ! parseNumberIf (fifo_buf, pos, end, token.y, [] (char) { return true; }) )
     return ParseError::Yes;
 
   return ParseError::No;
@@ -1791,15 +1818,16 @@ void FMouseControl::processQueuedInput()
     if ( FApplication::isQuit() )
       return;
 
-    FMouseDataPtr md(std::move(fmousedata_queue.front()));
-    fmousedata_queue.pop();
+    // Reuse the event data object unless
+    // an event handler still holds a reference
+    if ( ! event_data || event_data.use_count() > 1 )
+      event_data = std::make_shared<FMouseData>();
 
-    if ( md )
-    {
-      setCurrentMouseEvent (md);
-      event_cmd.execute(*md);
-      resetCurrentMouseEvent();
-    }
+    *event_data = std::move(fmousedata_queue.front());
+    fmousedata_queue.pop();
+    setCurrentMouseEvent (event_data);
+    event_cmd.execute(*event_data);
+    resetCurrentMouseEvent();
 
     if ( FApplication::isQuit() )
       return;
@@ -1817,8 +1845,7 @@ void FMouseControl::processEvent (const TimeValue& time)
   if ( iter != mouse_protocol.end() )
   {
     (*iter)->processEvent(time);
-    auto& md = static_cast<FMouseData&>(**iter);
-    fmousedata_queue.emplace(std::make_unique<FMouseData>(std::move(md)));
+    fmousedata_queue.emplace(static_cast<const FMouseData&>(**iter));
   }
 }
 
@@ -368,8 +368,12 @@ class FMouseX11 final : public FMouse
       button_right         = 0x63   // Mouse wheel right tilt
     };
 
-    // Constant
-    static constexpr std::size_t MOUSE_BUF_SIZE = 4;
+    struct Tokens
+    {
+      int    btn{0};
+      uChar  x{0};
+      uChar  y{0};
+    };
 
     // Methods
     void setKeyState (int) noexcept;
@@ -383,9 +387,10 @@ class FMouseX11 final : public FMouse
     void handleButton1Pressed (const TimeValue& time) noexcept;
     void handleButtonRelease() noexcept;
 
-    // Data member
-    std::array<char, MOUSE_BUF_SIZE>x11_mouse{};
-    uChar x11_button_state{all_buttons_released};
+    // Data members
+    Tokens  x11_tokens{};  // Decoded mouse report
+    bool    has_x11_data{false};
+    uChar   x11_button_state{all_buttons_released};
 };
 
 
@@ -415,7 +420,7 @@ class FMouseSGR final : public FMouse
       sInt16  x{0};
       sInt16  y{0};
       int     btn{0};
-      const char* p{nullptr};  // Current read position
+      char    action{'\0'};  // Pressed 'M' or released 'm'
     };
 
     // Enumerations
@@ -442,15 +447,13 @@ class FMouseSGR final : public FMouse
       released        = 'm'
     };
 
-    // Constant
-    static constexpr std::size_t MOUSE_BUF_SIZE = 13;
-
     // Methods
     void setKeyState (int) noexcept;
     void setMoveState (const FPoint&, int) noexcept;
     auto isMouseClickButton (const int) const noexcept -> bool;
     auto isMouseWheelButton (const int) const noexcept -> bool;
-    auto parseSGRMouseString (Tokens&) const noexcept -> ParseError;
+    static auto parseSGRMouseString ( const FKeyboard::keybuffer&
+                                    , std::size_t, Tokens& ) noexcept -> ParseError;
     auto noChanges (const FPoint&, uChar) const noexcept -> bool;
     void handleMouseClickButton (int, const TimeValue&) noexcept;
     void handleMouseWheelButton (int) noexcept;
@@ -459,8 +462,10 @@ class FMouseSGR final : public FMouse
     void setReleasedButtonState (const int) noexcept;
 
     // Data members
-    std::array<char, MOUSE_BUF_SIZE> sgr_mouse{};
-    uChar sgr_button_state{0x23};
+    Tokens      sgr_tokens{};  // Decoded mouse report
+    ParseError  sgr_parse_error{ParseError::No};
+    bool        has_sgr_data{false};
+    uChar       sgr_button_state{0x23};
 };
 
 
@@ -492,7 +497,6 @@ class FMouseUrxvt final : public FMouse
       int         btn{0};
       bool        x_neg{false};
       bool        y_neg{false};
-      const char* p{nullptr};  // Current read position
     };
 
     // Enumerations
@@ -518,15 +522,13 @@ class FMouseUrxvt final : public FMouse
       button_right         = 0x63   // Mouse wheel right tilt
     };
 
-    // Constant
-    static constexpr std::size_t MOUSE_BUF_SIZE = 14;
-
     // Methods
     void setKeyState (int) noexcept;
     void setMoveState (const FPoint&, int) noexcept;
     auto isMouseClickButton (const int) const noexcept -> bool;
     auto isMouseWheelButton (const int) const noexcept -> bool;
-    auto parseUrxvtMouseString (Tokens&) const noexcept -> ParseError;
+    static auto parseUrxvtMouseString ( const FKeyboard::keybuffer&
+                                      , std::size_t, Tokens& ) noexcept -> ParseError;
     void adjustAndSetPosition (Tokens&);
     auto noChanges (const FPoint&, uChar) const noexcept -> bool;
     void handleMouseClickButton (int, const TimeValue&) noexcept;
@@ -535,8 +537,10 @@ class FMouseUrxvt final : public FMouse
     void setButtonState (const int, const TimeValue&) noexcept;
 
     // Data members
-    std::array<char, MOUSE_BUF_SIZE>  urxvt_mouse{};
-    uChar urxvt_button_state{all_buttons_released};
+    Tokens      urxvt_tokens{};  // Decoded mouse report
+    ParseError  urxvt_parse_error{ParseError::No};
+    bool        has_urxvt_data{false};
+    uChar       urxvt_button_state{all_buttons_released};
 };
 
 
@@ -650,7 +654,7 @@ class FMouseControl
     // Using-declarations
     using FMousePtr = std::unique_ptr<FMouse>;
     using FMouseProtocol = std::vector<FMousePtr>;
-    using MouseQueue = FRingBuffer<FMouseDataPtr, MAX_QUEUE_SIZE>;
+    using MouseQueue = FRingBuffer<FMouseData, MAX_QUEUE_SIZE>;
 
     // Accessor
     auto  findMouseWithType (const FMouse::MouseType&) const -> FMouseProtocol::const_iterator;
@@ -669,7 +673,8 @@ class FMouseControl
     FMouseCommand   event_cmd{};
     FMouseCommand   enable_xterm_mouse_cmd{};
     FMouseCommand   disable_xterm_mouse_cmd{};
-    MouseQueue      fmousedata_queue{};
+    MouseQueue      fmousedata_queue{};  // Mouse data records by value
+    FMouseDataPtr   event_data{};        // Reused for each delivered event
     FPoint          zero_point{0, 0};
     bool            use_gpm_mouse{false};
     bool            use_xterm_mouse{false};
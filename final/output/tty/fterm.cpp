@@ -1708,6 +1708,38 @@ inline void FTerm::disableKeypad()
   }
 }
 
+//----------------------------------------------------------------------
+inline void FTerm::enableKittyKeyboard()
+{
+  // Push the 'disambiguate escape codes' flag of the kitty keyboard
+  // protocol. The Esc key and all Meta keys are then sent as
+  // CSI u sequences and no longer need the keypress timeout
+  // (see FKeyboard::escapeKeyHandling).
+
+  if ( ! getStartOptions().kitty_keyboard
+    || ! FTermDetection::getInstance().hasKittyKeyboardSupport() )
+    return;
+
+  paddingPrint (CSI ">1u");
+  std::fflush(stdout);
+  FKeyboard::getInstance().enableKittyKeyboard();
+}
+
+//----------------------------------------------------------------------
+inline void FTerm::disableKittyKeyboard()
+{
+  // Pop the pushed kitty keyboard protocol flags
+
+  auto& keyboard = FKeyboard::getInstance();
+
+  if ( ! keyboard.hasKittyKeyboard() )
+    return;
+
+  paddingPrint (CSI "<u");
+  std::fflush(stdout);
+  keyboard.disableKittyKeyboard();
+}
+
 //----------------------------------------------------------------------
 inline void FTerm::enableAlternateCharset()
 {
@@ -1829,13 +1861,15 @@ void FTerm::init()
   // Enable the terminal mouse support
   enableMouse();
 
-  // Activate meta key sends escape + terminal focus event
+  // Activate meta key sends escape + terminal focus event + bracketed paste
   if ( FTermData::getInstance().isTermType(FTermType::xterm) )
   {
     FTermXTerminal::getInstance().metaSendsESC(true);
 
     if ( getStartOptions().terminal_focus_events )
       FTermXTerminal::getInstance().setFocusSupport(true);
+
+    FTermXTerminal::getInstance().setBracketedPaste(true);
   }
 
   // switch to application escape key mode
@@ -1847,6 +1881,11 @@ void FTerm::init()
   // Switch to the alternate screen
   useAlternateScreenBuffer();
 
+  // Use the kitty keyboard protocol if available. The main and the
+  // alternate screen have separate flag stacks in kitty, so the flags
+  // are pushed after switching to the alternate screen.
+  enableKittyKeyboard();
+
   // Enable alternate charset
   enableAlternateCharset();
 
@@ -2039,15 +2078,21 @@ void FTerm::finish() const
   if ( getStartOptions().mouse_support )
     disableMouse();
 
-  // Deactivate terminal focus event + meta key sends escape
+  // Deactivate terminal focus event + bracketed paste + meta key sends escape
   if ( data.isTermType(FTermType::xterm) )
   {
     if ( getStartOptions().terminal_focus_events )
       xterm.setFocusSupport(false);
 
+    xterm.setBracketedPaste(false);
+
     xterm.metaSendsESC(false);
   }
 
+  // Return to the legacy keyboard encoding
+  // (on the stack of the alternate screen)
+  disableKittyKeyboard();
+
   // Switch to the normal screen
   useNormalScreenBuffer();
 
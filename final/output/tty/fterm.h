@@ -282,6 +282,8 @@ class FTerm final
     static void disableApplicationEscKey();
     static void enableKeypad();
     static void disableKeypad();
+    static void enableKittyKeyboard();
+    static void disableKittyKeyboard();
     static void enableAlternateCharset();
     static void useAlternateScreenBuffer();
     static void useNormalScreenBuffer();
@@ -56,6 +56,7 @@
 #include "final/output/tty/fterm.h"
 #include "final/util/emptyfstring.h"
 #include "final/util/flog.h"
+#include "final/util/fsessionrecorder.h"
 #include "final/util/fsystem.h"
 
 namespace finalcut
@@ -271,7 +272,14 @@ void FTermcap::init()
 void FTermcap::setDefaultPutCharFunction()
 {
   static const auto& fsys = FSystem::getInstance();
-  auto put_char = [] (int ch) { return fsys->putchar(ch); };
+  static auto& recorder = FSessionRecorder::getInstance();
+  auto put_char = \
+      [] (int ch)
+      {
+        const auto c = char(ch);
+        recorder.recordOutput (&c, 1);
+        return fsys->putchar(ch);
+      };
   outc = put_char;
 }
 
@@ -279,9 +287,11 @@ void FTermcap::setDefaultPutCharFunction()
 void FTermcap::setDefaultPutStringFunction()
 {
   static const auto& fsys = FSystem::getInstance();
+  static auto& recorder = FSessionRecorder::getInstance();
   auto put_string = \
       [] (const std::string& string)
       {
+        recorder.recordOutput (string.data(), string.size());
         return fsys->fputs(string.c_str(), stdout);
       };
   outs = put_string;
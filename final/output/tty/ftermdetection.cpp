@@ -343,6 +343,11 @@ void FTermDetection::detectTerminal()
     // Identify the terminal via the secondary device attributes (SEC_DA)
     new_termtype = parseSecDA (new_termtype);
 
+    // Terminals that answered the SEC_DA query are
+    // asked for the kitty keyboard protocol (CSI u)
+    if ( ! sec_da.isEmpty() )
+      kitty_keyboard = queryKittyKeyboard();
+
     // Determines the maximum number of colors
     new_termtype = determineMaxColor(new_termtype);
 
@@ -615,13 +620,19 @@ auto FTermDetection::parseSecDA (const FString& current_termtype) -> FString
   if ( sec_da.getLength() < 6 )
     return current_termtype;
 
-  // remove the first 3 bytes ("\033[>")
-  FString temp(sec_da.right(sec_da.getLength() - 3));
-  // remove the last byte ("c")
-  temp.remove(temp.getLength() - 1, 1);
-  // split into components
-  const auto& sec_da_components = temp.split(';');
-  const auto& num_components = sec_da_components.size();
+  // Strip the first 3 bytes ("\033[>") and the last byte ("c")
+  const auto params = FStringView{sec_da}.mid(4, sec_da.getLength() - 4);
+  // Split into components without allocating substrings
+  std::array<FStringView, 3> sec_da_components{};
+  std::size_t num_components{0};
+
+  for (const auto& component : FStringTokenizer{params, L";"})
+  {
+    if ( num_components < sec_da_components.size() )
+      sec_da_components[num_components] = component;
+
+    num_components++;
+  }
 
   // The second device attribute (SEC_DA) always has 3 parameters,
   // otherwise it usually has a copy of the device attribute (primary DA)
@@ -651,33 +662,34 @@ auto FTermDetection::parseSecDA (const FString& current_termtype) -> FString
 }
 
 //----------------------------------------------------------------------
-auto FTermDetection::str2int (const FString& s) const -> int
+auto FTermDetection::str2int (FStringView s) const -> int
 {
   // This is not a general string to integer conversion method.
   // It is only used in this class to convert the device attribute
   // parameters into numbers.
 
   constexpr int ERROR = -1;
+  const auto digits = s.trim();
 
-  if ( s.isEmpty() )
+  if ( digits.isEmpty() )
     return ERROR;
 
-  try
-  {
-    return s.toInt();
-  }
-  catch (const std::invalid_argument&)
-  {
-    return ERROR;
-  }
-  catch (const std::underflow_error&)
-  {
-    return ERROR;
-  }
-  catch (const std::overflow_error&)
+  int num{0};
+
+  for (const auto& ch : digits)
   {
-    return ERROR;
+    if ( ! std::iswdigit(std::wint_t(ch)) )
+      return ERROR;
+
+    const auto d = int(ch - L'0');
+
+    if ( num > (INT_MAX - d) / 10 )  // Overflow
+      return ERROR;
+
+    num = (10 * num) + d;
   }
+
+  return num;
 }
 
 //----------------------------------------------------------------------
@@ -969,6 +981,41 @@ inline auto FTermDetection::secDA_Analysis_kitty (const FString& current_termtyp
   return new_termtype;
 }
 
+//----------------------------------------------------------------------
+auto FTermDetection::queryKittyKeyboard() const -> bool
+{
+  // Query the progressive enhancement flags of the keyboard protocol
+  // followed by the primary device attributes (DA). Every terminal
+  // answers DA, but only terminals with kitty keyboard protocol
+  // support send the flags (ESC [ ? <flags> u) before.
+
+  const auto& stdout_no{FTermios::getStdOut()};
+  const std::string QUERY{CSI "?u" CSI "c"};
+
+  if ( write(stdout_no, QUERY.data(), QUERY.length()) == -1 )
+    return false;
+
+  std::fflush(stdout);
+  std::array<char, 64> temp{};
+  auto isWithout_c = [] (const auto& t) { return ! std::strchr(t.data(), 'c'); };
+  auto pos = captureTerminalInput(temp, 600'000, isWithout_c);
+
+  if ( pos < 5 )
+    return false;
+
+  const auto* answer = std::strstr(temp.data(), CSI "?");
+
+  if ( ! answer )
+    return false;
+
+  const auto* iter = answer + 3;
+
+  while ( std::isdigit(uChar(*iter)) )
+    ++iter;
+
+  return iter > answer + 3 && *iter == 'u';
+}
+
 //----------------------------------------------------------------------
 inline void FTermDetection::correctFalseAssumptions (int terminal_id_type) const
 {
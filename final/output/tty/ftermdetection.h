@@ -42,6 +42,7 @@
 
 #include "final/fconfig.h"  // Supplies F_HAVE_GETTTYNAM if available
 #include "final/util/fstring.h"
+#include "final/util/fstringview.h"
 
 namespace finalcut
 {
@@ -73,6 +74,7 @@ class FTermDetection final
     auto  canDisplay256Colors() const noexcept -> bool;
     auto  hasTerminalDetection() const noexcept -> bool;
     auto  hasSetCursorStyleSupport() const noexcept -> bool;
+    auto  hasKittyKeyboardSupport() const noexcept -> bool;
 
     // Mutators
     void  setTerminalDetection (bool = true) noexcept;
@@ -126,7 +128,7 @@ class FTermDetection final
     auto  parseAnswerbackMsg (const FString&) -> FString;
     auto  getAnswerbackMsg() const -> FString;
     auto  parseSecDA (const FString&) -> FString;
-    auto  str2int (const FString&) const -> int;
+    auto  str2int (FStringView) const -> int;
     auto  getSecDA() const -> FString;
     auto  secDA_Analysis (const FString&) -> FString;
     auto  secDA_Analysis_0 (const FString&) const -> FString;
@@ -143,6 +145,7 @@ class FTermDetection final
     auto  secDA_Analysis_vte (const FString&) -> FString;
     auto  secDA_Analysis_kitty (const FString&) -> FString;
     void  correctFalseAssumptions (int) const;
+    auto  queryKittyKeyboard() const -> bool;
 
     // Data members
 #if DEBUG
@@ -153,6 +156,7 @@ class FTermDetection final
     FString      termtype{};
     FString      ttytypename{"/etc/ttytype"};  // Default ttytype file
     bool         decscusr_support{false};      // Preset to false
+    bool         kitty_keyboard{false};        // CSI u keyboard protocol
     bool         terminal_detection{true};     // Preset to true
     bool         color256{};
     FString      answer_back{};
@@ -193,6 +197,10 @@ inline auto FTermDetection::canDisplay256Colors() const noexcept -> bool
 inline auto FTermDetection::hasSetCursorStyleSupport() const noexcept -> bool
 { return decscusr_support; }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::hasKittyKeyboardSupport() const noexcept -> bool
+{ return kitty_keyboard; }
+
 //----------------------------------------------------------------------
 inline auto FTermDetection::hasTerminalDetection() const noexcept -> bool
 { return terminal_detection; }
@@ -37,6 +37,7 @@
 #include "final/output/tty/ftermoutput.h"
 #include "final/output/tty/ftermxterminal.h"
 #include "final/util/char_ringbuffer.h"
+#include "final/util/fframeprofiler.h"
 #include "final/util/fpoint.h"
 #include "final/util/fsize.h"
 
@@ -446,6 +447,8 @@ void FTermOutput::flush()
     || ! (isFlushTimeout() || getFVTerm().isTerminalUpdateForced()) )
     return;
 
+  static auto& profiler = FFrameProfiler::getInstance();
+
   while ( ! output_buffer->isEmpty() )
   {
     const auto& first = output_buffer->front();
@@ -457,6 +460,7 @@ void FTermOutput::flush()
     else if ( type == OutputType::Control )
       FTerm::paddingPrint (data);
 
+    profiler.addBytes (data.size());
     output_buffer->pop();
   }
 
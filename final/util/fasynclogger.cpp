@@ -0,0 +1,522 @@
+/***********************************************************************
+* fasynclogger.cpp - Asynchronous logging with a background writer     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include "final/util/fasynclogger.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+struct var
+{
+  static std::atomic<uInt64> async_logger_id;
+};
+
+std::atomic<uInt64> var::async_logger_id{0};
+
+}  // namespace internal
+
+//----------------------------------------------------------------------
+// class FAsyncLogger::RingBuffer
+//----------------------------------------------------------------------
+
+class FAsyncLogger::RingBuffer
+{
+  public:
+    // Log entry
+    struct Entry
+    {
+      LogLevel    level{LogLevel::Info};
+      std::time_t time{0};
+      std::string message{};
+    };
+
+    // Constructor
+    explicit RingBuffer (std::size_t size)
+      : entries(roundUpPowerOfTwo(size))
+      , mask{entries.size() - 1}
+    { }
+
+    // Methods
+    auto push (LogLevel level, std::time_t t, const std::string& msg) -> bool
+    {
+      // Only called by the owning (producer) thread
+      const auto h = head.load(std::memory_order_relaxed);
+
+      if ( h - tail.load(std::memory_order_acquire) > mask )
+        return false;  // Buffer full
+
+      auto& entry = entries[h & mask];
+      entry.level = level;
+      entry.time = t;
+      entry.message.assign(msg);  // Reuses the capacity of the slot
+      head.store(h + 1, std::memory_order_release);
+      return true;
+    }
+
+    template <typename WriteFunc>
+    auto pop (WriteFunc&& write) -> std::size_t
+    {
+      // Only called by the writer (consumer) thread
+      auto t = tail.load(std::memory_order_relaxed);
+      const auto h = head.load(std::memory_order_acquire);
+      const auto count = std::size_t(h - t);
+
+      while ( t != h )
+      {
+        const auto& entry = entries[t & mask];
+        write (entry.level, entry.time, entry.message);
+        t++;
+        tail.store(t, std::memory_order_release);
+      }
+
+      return count;
+    }
+
+    void close() noexcept
+    {
+      // Called by the owning thread when it exits
+      closed.store(true, std::memory_order_release);
+    }
+
+    auto isClosed() const noexcept -> bool
+    {
+      return closed.load(std::memory_order_acquire);
+    }
+
+    auto isEmpty() const noexcept -> bool
+    {
+      return head.load(std::memory_order_acquire)
+          == tail.load(std::memory_order_relaxed);
+    }
+
+  private:
+    // Method
+    static auto roundUpPowerOfTwo (std::size_t size) -> std::size_t
+    {
+      std::size_t n{1};
+
+      while ( n < size )
+        n <<= 1;
+
+      return n;
+    }
+
+    // Data members
+    std::vector<Entry>        entries;
+    const std::size_t         mask;
+    std::atomic<std::size_t>  head{0};
+    std::atomic<std::size_t>  tail{0};
+    std::atomic<bool>         closed{false};
+};
+
+
+//----------------------------------------------------------------------
+// class FAsyncLogger::ThreadBufferList
+//----------------------------------------------------------------------
+
+class FAsyncLogger::ThreadBufferList
+{
+  public:
+    // Constructor
+    ThreadBufferList() = default;
+
+    // Disable copy constructor
+    ThreadBufferList (const ThreadBufferList&) = delete;
+
+    // Destructor
+    ~ThreadBufferList() noexcept
+    {
+      // The thread exits, its buffers can be released after draining
+      for (const auto& ref : refs)
+        ref.buffer->close();
+    }
+
+    // Disable copy assignment operator (=)
+    auto operator = (const ThreadBufferList&) -> ThreadBufferList& = delete;
+
+    // Methods
+    auto find (uInt64 logger_id) const -> RingBuffer*
+    {
+      for (const auto& ref : refs)
+        if ( ref.logger_id == logger_id )
+          return ref.buffer.get();
+
+      return nullptr;
+    }
+
+    void add (uInt64 logger_id, RingBufferPtr buffer)
+    {
+      refs.push_back({logger_id, std::move(buffer)});
+    }
+
+    void remove (uInt64 logger_id)
+    {
+      refs.erase ( std::remove_if ( refs.begin(), refs.end()
+                                  , [logger_id] (const auto& ref)
+                                    { return ref.logger_id == logger_id; } )
+                 , refs.end() );
+    }
+
+  private:
+    // Per-thread entry that maps a logger to its ring buffer
+    struct BufferRef
+    {
+      uInt64         logger_id;
+      RingBufferPtr  buffer;
+    };
+
+    // Data member
+    std::vector<BufferRef>  refs{};
+};
+
+
+//----------------------------------------------------------------------
+// class FAsyncLogger
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FAsyncLogger::FAsyncLogger (std::size_t size, OverflowPolicy policy)
+  : id{++internal::var::async_logger_id}
+  , buffer_size{std::max(size, std::size_t(2))}
+  , overflow_policy{policy}
+{
+  writer = std::thread([this] () { writerLoop(); });
+}
+
+//----------------------------------------------------------------------
+FAsyncLogger::~FAsyncLogger() noexcept  // destructor
+{
+  sync();  // Pass on the remaining stream buffer content
+  running = false;
+  wakeUpWriter();
+
+  if ( writer.joinable() )
+    writer.join();
+
+  // Remove the buffer reference of the current thread. Other threads
+  // keep their (closed) buffer references until they exit.
+  getThreadBufferList().remove(id);
+}
+
+
+// public methods of FAsyncLogger
+//----------------------------------------------------------------------
+auto FAsyncLogger::getThreadBufferCount() -> std::size_t
+{
+  std::lock_guard<std::mutex> lock_guard(buffers_mutex);
+  return buffers.size();
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::flush()
+{
+  // Called in every cycle of the main event loop,
+  // therefore only the writer thread is woken up here
+  if ( enqueued != written )
+    wakeUpWriter();
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::waitUntilWritten()
+{
+  // Blocks until all messages logged so far have been written
+
+  const uInt64 target = enqueued;
+
+  while ( written < target && running )
+  {
+    wakeUpWriter();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  std::lock_guard<std::mutex> lock_guard(output_mutex);
+  output.flush();
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::setOutputStream (const std::ostream& os)
+{
+  waitUntilWritten();  // Pending messages go to the previous stream
+  std::lock_guard<std::mutex> lock_guard(output_mutex);
+  output.rdbuf(os.rdbuf());
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::setLineEnding (LineEnding eol)
+{
+  waitUntilWritten();
+  std::lock_guard<std::mutex> lock_guard(output_mutex);
+  setEnding() = eol;
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::enableTimestamp()
+{
+  waitUntilWritten();
+  timestamp = true;
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::disableTimestamp()
+{
+  waitUntilWritten();
+  timestamp = false;
+}
+
+
+// private methods of FAsyncLogger
+//----------------------------------------------------------------------
+void FAsyncLogger::push (LogLevel level, const std::string& msg)
+{
+  auto& buffer = getThreadBuffer();
+  const auto now = std::time(nullptr);
+
+  while ( ! buffer.push(level, now, msg) )
+  {
+    if ( overflow_policy == OverflowPolicy::Drop || ! running )
+    {
+      ++dropped;
+      return;
+    }
+
+    wakeUpWriter();
+    std::this_thread::yield();
+  }
+
+  ++enqueued;
+
+  if ( writer_idle )
+    wakeUpWriter();
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::getThreadBuffer() -> RingBuffer&
+{
+  // Lock-free fast path via the thread-local buffer cache
+  auto& thread_buffer_list = getThreadBufferList();
+
+  if ( auto buffer = thread_buffer_list.find(id) )
+    return *buffer;
+
+  // First message of this thread: register a new ring buffer
+  auto buffer = std::make_shared<RingBuffer>(buffer_size);
+  thread_buffer_list.add(id, buffer);
+  std::lock_guard<std::mutex> lock_guard(buffers_mutex);
+  buffers.push_back(buffer);
+  return *buffer;
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::getThreadBufferList() -> ThreadBufferList&
+{
+  thread_local ThreadBufferList thread_buffer_list{};
+  return thread_buffer_list;
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::wakeUpWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock_guard(wakeup_mutex);
+    wakeup = true;
+  }
+
+  wakeup_cv.notify_one();
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::writerLoop()
+{
+  static constexpr auto idle_timeout = std::chrono::milliseconds(100);
+
+  while ( running )
+  {
+    if ( drainBuffers() > 0 )
+      continue;
+
+    std::unique_lock<std::mutex> lock(wakeup_mutex);
+    writer_idle = true;
+    wakeup_cv.wait_for (lock, idle_timeout, [this] () { return wakeup; });
+    wakeup = false;
+    writer_idle = false;
+  }
+
+  drainBuffers();  // Write the remaining messages
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::drainBuffers() -> std::size_t
+{
+  // The buffer list is copied, so that the first message of a new
+  // thread does not have to wait until the output is written
+
+  {
+    std::lock_guard<std::mutex> buffers_lock(buffers_mutex);
+    drain_list = buffers;
+  }
+
+  std::size_t count{0};
+  bool has_closed_buffers{false};
+
+  {
+    std::lock_guard<std::mutex> output_lock(output_mutex);
+
+    for (const auto& buffer : drain_list)
+    {
+      // A buffer that is closed before pop() is empty afterwards
+      if ( buffer->isClosed() )
+        has_closed_buffers = true;
+
+      count += buffer->pop ( [this] ( LogLevel level, std::time_t t
+                                    , const std::string& msg )
+                             { writeLine (level, t, msg); } );
+    }
+
+    if ( count > 0 )
+    {
+      output.flush();
+      written += count;
+    }
+  }
+
+  drain_list.clear();  // Keeps the capacity
+
+  if ( has_closed_buffers )
+    releaseClosedBuffers();
+
+  return count;
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::releaseClosedBuffers()
+{
+  // Releases the drained buffers of exited threads
+
+  std::lock_guard<std::mutex> buffers_lock(buffers_mutex);
+  buffers.erase ( std::remove_if ( buffers.begin(), buffers.end()
+                                 , [] (const auto& buffer)
+                                   {
+                                     return buffer->isClosed()
+                                         && buffer->isEmpty();
+                                   } )
+                , buffers.end() );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLogger::writeLine ( LogLevel level, std::time_t t
+                             , const std::string& msg )
+{
+  // Same line format as FLogger, but written directly
+  // into the stream without building intermediate strings
+
+  const auto eol = getEOL();
+
+  auto print_prefix = [this, level, t] ()
+  {
+    if ( timestamp )
+      output << getTimeString(t) << ' ';
+
+    output << '[' << getLogLevelString(level) << "] ";
+  };
+
+  print_prefix();
+  std::size_t first{0};
+  std::size_t pos{0};
+
+  // A trailing newline is not replaced
+  while ( (pos = msg.find('\n', first)) != std::string::npos
+       && pos + 1 < msg.length() )
+  {
+    output.write (msg.data() + first, std::streamsize(pos - first));
+    output << eol;
+    print_prefix();
+    first = pos + 1;
+  }
+
+  output.write (msg.data() + first, std::streamsize(msg.length() - first));
+  output << eol;
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::getTimeString (std::time_t t) -> const std::string&
+{
+  // The RFC 2822 date is only formatted once per second
+
+  if ( t == last_time )
+    return time_string;
+
+  std::array<char, 100> str{};
+  struct tm time{};
+  localtime_r (&t, &time);
+  std::strftime (str.data(), str.size(), "%a, %d %b %Y %T %z", &time);
+  time_string = str.data();
+  last_time = t;
+  return time_string;
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::getEOL() const -> const char*
+{
+  if ( getEnding() == LineEnding::LF )
+    return "\n";
+
+  if ( getEnding() == LineEnding::CR )
+    return "\r";
+
+  if ( getEnding() == LineEnding::CRLF )
+    return "\r\n";
+
+  return "";
+}
+
+//----------------------------------------------------------------------
+auto FAsyncLogger::getLogLevelString (LogLevel level) -> const char*
+{
+  switch ( level )
+  {
+    case LogLevel::Info:
+      return "INFO";
+
+    case LogLevel::Warn:
+      return "WARNING";
+
+    case LogLevel::Error:
+      return "ERROR";
+
+    case LogLevel::Debug:
+      return "DEBUG";
+  }
+
+  return "";
+}
+
+}  // namespace finalcut
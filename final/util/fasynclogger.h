@@ -0,0 +1,209 @@
+/***********************************************************************
+* fasynclogger.h - Asynchronous logging with a background writer       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ std::stringbuf ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *         ▲
+ *         │
+ *      ▕▔▔▔▔▔▔▏
+ *      ▕ FLog ▏
+ *      ▕▁▁▁▁▁▁▏
+ *         ▲
+ *         │
+ *  ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *  ▕ FAsyncLogger ▏
+ *  ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// The logging thread only copies the message into a lock-free
+// single-producer/single-consumer ring buffer of its own. A background
+// writer thread formats the lines (with a timestamp that is computed
+// at most once per second) and writes them to the output stream.
+// Messages from one thread keep their order, messages from different
+// threads are only ordered per drain cycle. The ring buffer of a
+// thread is released once the thread has exited and the writer
+// has written its remaining messages.
+
+#ifndef FASYNCLOGGER_H
+#define FASYNCLOGGER_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "final/ftypes.h"
+#include "final/util/flog.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FAsyncLogger
+//----------------------------------------------------------------------
+
+class FAsyncLogger : public FLog
+{
+  public:
+    // Enumeration
+    enum class OverflowPolicy
+    {
+      Drop,   // Discard new messages when the buffer is full
+      Block   // Wait until the writer has made room
+    };
+
+    // Constants
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE{1024};
+
+    // Constructor
+    explicit FAsyncLogger ( std::size_t = DEFAULT_BUFFER_SIZE
+                          , OverflowPolicy = OverflowPolicy::Drop );
+
+    // Disable copy constructor
+    FAsyncLogger (const FAsyncLogger&) = delete;
+
+    // Destructor
+    ~FAsyncLogger() noexcept override;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FAsyncLogger&) -> FAsyncLogger& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getBufferSize() const noexcept -> std::size_t;
+    auto getOverflowPolicy() const noexcept -> OverflowPolicy;
+    auto getDroppedCount() const noexcept -> uInt64;
+    auto getThreadBufferCount() -> std::size_t;
+
+    // Mutator
+    void setOverflowPolicy (OverflowPolicy) noexcept;
+
+    // Methods
+    void info (const std::string&) override;
+    void warn (const std::string&) override;
+    void error (const std::string&) override;
+    void debug (const std::string&) override;
+    void flush() override;
+    void waitUntilWritten();
+    void setOutputStream (const std::ostream&) override;
+    void setLineEnding (LineEnding) override;
+    void enableTimestamp() override;
+    void disableTimestamp() override;
+
+  private:
+    // Forward declarations
+    class RingBuffer;
+    class ThreadBufferList;
+
+    // Using-declarations
+    using RingBufferPtr = std::shared_ptr<RingBuffer>;
+    using RingBufferList = std::vector<RingBufferPtr>;
+
+    // Methods
+    void push (LogLevel, const std::string&);
+    auto getThreadBuffer() -> RingBuffer&;
+    static auto getThreadBufferList() -> ThreadBufferList&;
+    void wakeUpWriter();
+    void writerLoop();
+    auto drainBuffers() -> std::size_t;
+    void releaseClosedBuffers();
+    void writeLine (LogLevel, std::time_t, const std::string&);
+    auto getTimeString (std::time_t) -> const std::string&;
+    auto getEOL() const -> const char*;
+    static auto getLogLevelString (LogLevel) -> const char*;
+
+    // Data members
+    const uInt64                 id;
+    const std::size_t            buffer_size;
+    std::atomic<OverflowPolicy>  overflow_policy;
+    std::atomic<bool>            timestamp{false};
+    std::atomic<bool>            running{true};
+    std::atomic<bool>            writer_idle{false};
+    std::atomic<uInt64>          enqueued{0};
+    std::atomic<uInt64>          written{0};
+    std::atomic<uInt64>          dropped{0};
+    RingBufferList               buffers{};
+    RingBufferList               drain_list{};  // Used by the writer only
+    std::mutex                   buffers_mutex{};
+    std::mutex                   wakeup_mutex{};
+    std::condition_variable      wakeup_cv{};
+    bool                         wakeup{false};
+    std::mutex                   output_mutex{};
+    std::ostream                 output{std::cerr.rdbuf()};
+    std::time_t                  last_time{-1};
+    std::string                  time_string{};
+    std::thread                  writer{};
+};
+
+// FAsyncLogger inline functions
+//----------------------------------------------------------------------
+inline auto FAsyncLogger::getClassName() const -> FString
+{ return "FAsyncLogger"; }
+
+//----------------------------------------------------------------------
+inline auto FAsyncLogger::getBufferSize() const noexcept -> std::size_t
+{ return buffer_size; }
+
+//----------------------------------------------------------------------
+inline auto FAsyncLogger::getOverflowPolicy() const noexcept -> OverflowPolicy
+{ return overflow_policy; }
+
+//----------------------------------------------------------------------
+inline auto FAsyncLogger::getDroppedCount() const noexcept -> uInt64
+{ return dropped; }
+
+//----------------------------------------------------------------------
+inline void FAsyncLogger::setOverflowPolicy (OverflowPolicy policy) noexcept
+{ overflow_policy = policy; }
+
+//----------------------------------------------------------------------
+inline void FAsyncLogger::info (const std::string& msg)
+{ push (LogLevel::Info, msg); }
+
+//----------------------------------------------------------------------
+inline void FAsyncLogger::warn (const std::string& msg)
+{ push (LogLevel::Warn, msg); }
+
+//----------------------------------------------------------------------
+inline void FAsyncLogger::error (const std::string& msg)
+{ push (LogLevel::Error, msg); }
+
+//----------------------------------------------------------------------
+inline void FAsyncLogger::debug (const std::string& msg)
+{ push (LogLevel::Debug, msg); }
+
+}  // namespace finalcut
+
+#endif  // FASYNCLOGGER_H
@@ -20,33 +20,84 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <cassert>
+#include <mutex>
+
 #include "final/util/fcallback.h"
 
 namespace finalcut
 {
 
+#if DEBUG
+//----------------------------------------------------------------------
+// class FSignalId
+//----------------------------------------------------------------------
+
+// private methods of FSignalId
+//----------------------------------------------------------------------
+void FSignalId::checkName() const
+{
+  // Registers the name of a character array
+
+  if ( name )
+    registerName (id, toWideName(name, name_length));
+  else if ( wide_name )
+    registerName (id, toWideName(wide_name, name_length));
+}
+
+//----------------------------------------------------------------------
+auto FSignalId::toWideName (const char* str, std::size_t length) -> std::wstring
+{
+  // Decodes the name like hash() does
+
+  std::wstring wide_str{};
+  std::size_t i{0};
+
+  while ( i < length && str[i] != '\0' )
+    wide_str.push_back(wchar_t(decode(str, length, i)));
+
+  return wide_str;
+}
+
+//----------------------------------------------------------------------
+auto FSignalId::toWideName (const wchar_t* str, std::size_t length) -> std::wstring
+{
+  std::wstring wide_str{};
+
+  for (std::size_t i{0}; i < length && str[i] != L'\0'; i++)
+    wide_str.push_back(str[i]);
+
+  return wide_str;
+}
+
+//----------------------------------------------------------------------
+void FSignalId::registerName (uInt64 signal_id, const std::wstring& signal_name)
+{
+  // Debug builds remember the name of each signal id, because
+  // different names with the same hash value would share their
+  // callbacks without notice
+
+  static std::mutex names_mutex{};
+  static std::unordered_map<uInt64, std::wstring> names{};
+  std::lock_guard<std::mutex> lock_guard(names_mutex);
+  const auto& entry = *names.emplace(signal_id, signal_name).first;
+  assert ( entry.second == signal_name && "Signal id collision" );
+  static_cast<void>(entry);
+}
+#endif  // DEBUG
+
+
 //----------------------------------------------------------------------
 // class FCallback
 //----------------------------------------------------------------------
 
 // public methods of FCallback
 //----------------------------------------------------------------------
-void FCallback::delCallback (const FString& cb_signal)
+void FCallback::delCallback (FSignalId cb_signal)
 {
   // Deletes entries with the given signal from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  callback_objects.erase(cb_signal.get());
 }
 
 //----------------------------------------------------------------------
@@ -58,20 +109,26 @@ void FCallback::delCallback()
 }
 
 //----------------------------------------------------------------------
-void FCallback::emitCallback (const FString& emit_signal) const
+void FCallback::emitCallback (FSignalId emit_signal) const
 {
   // Initiate callback for the given signal
 
+#if DEBUG
+  emit_signal.checkName();  // Asserts on a signal id collision
+#endif
+
   if ( callback_objects.empty() )
     return;
 
-  for (auto&& cback : callback_objects)
+  const auto iter = callback_objects.find(emit_signal.get());
+
+  if ( iter == callback_objects.end() )
+    return;
+
+  for (auto&& cback : iter->second)
   {
-    if ( cback.cb_signal == emit_signal )
-    {
-      // Calling the stored function pointer
-      cback.cb_function();
-    }
+    // Calling the stored function pointer
+    cback.cb_function();
   }
 }
 
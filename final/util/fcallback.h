@@ -26,6 +26,12 @@
  * ▕▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
  * ▕ FCallback ▏- - - -▕ FCallbackData ▏
  * ▕▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *       :1
+ *       :
+ *       :*
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FSignalId ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▏
  */
 
 #ifndef FCALLBACK_H
@@ -35,6 +41,9 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <cstring>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -47,6 +56,218 @@ namespace finalcut
 // class forward declaration
 class FWidget;
 
+//----------------------------------------------------------------------
+// class FSignalId
+//----------------------------------------------------------------------
+
+class FSignalId
+{
+  public:
+    // Using-declaration
+    template <typename T>
+    using enable_if_CharPointer_t =
+        std::enable_if_t< std::is_same<T, const char*>::value
+                       || std::is_same<T, char*>::value
+                       , std::nullptr_t >;
+
+    // Constructors
+    template <std::size_t N>
+    constexpr FSignalId (const char (&)[N]) noexcept;  // implicit
+    template <std::size_t N>
+    constexpr FSignalId (const wchar_t (&)[N]) noexcept;  // implicit
+    template <typename CharPtr
+            , enable_if_CharPointer_t<CharPtr> = nullptr>
+    FSignalId (const CharPtr&) noexcept;  // implicit
+    FSignalId (const std::string&) noexcept;  // implicit
+    FSignalId (const std::wstring&) noexcept;  // implicit
+    FSignalId (const FString&) noexcept;  // implicit
+
+    // Accessors
+    auto getClassName() const -> FString;
+    constexpr auto get() const noexcept -> uInt64;
+
+    // Friend operators
+    friend constexpr auto operator == (const FSignalId& lhs, const FSignalId& rhs) noexcept -> bool
+    {
+      return lhs.id == rhs.id;
+    }
+
+    friend constexpr auto operator != (const FSignalId& lhs, const FSignalId& rhs) noexcept -> bool
+    {
+      return lhs.id != rhs.id;
+    }
+
+  private:
+    // Constants
+    static constexpr uInt64 FNV_OFFSET_BASIS{0xcbf29ce484222325};
+    static constexpr uInt64 FNV_PRIME{0x100000001b3};
+
+    // Methods
+    static constexpr auto decode (const char*, std::size_t, std::size_t&) noexcept -> uInt32;
+    static constexpr auto hash (uInt64, uInt32) noexcept -> uInt64;
+    static constexpr auto hash (const char*, std::size_t) noexcept -> uInt64;
+    static constexpr auto hash (const wchar_t*, std::size_t) noexcept -> uInt64;
+#if DEBUG
+    void checkName() const;
+    static auto toWideName (const char*, std::size_t) -> std::wstring;
+    static auto toWideName (const wchar_t*, std::size_t) -> std::wstring;
+    static void registerName (uInt64, const std::wstring&);
+#endif
+
+    // Data members
+    uInt64 id{FNV_OFFSET_BASIS};
+#if DEBUG
+    // The character array of a constructor call
+    // (names of other strings are registered directly)
+    const char*     name{nullptr};
+    const wchar_t*  wide_name{nullptr};
+    std::size_t     name_length{0};
+#endif
+
+    // Friend class
+    friend class FCallback;
+};
+
+// FSignalId inline functions
+//----------------------------------------------------------------------
+template <std::size_t N>
+constexpr FSignalId::FSignalId (const char (&signal)[N]) noexcept
+  : id{hash(signal, N - 1)}  // Can be computed at compile time
+#if DEBUG
+  , name{signal}
+  , name_length{N - 1}
+#endif
+{ }
+
+//----------------------------------------------------------------------
+template <std::size_t N>
+constexpr FSignalId::FSignalId (const wchar_t (&signal)[N]) noexcept
+  : id{hash(signal, N - 1)}  // Can be computed at compile time
+#if DEBUG
+  , wide_name{signal}
+  , name_length{N - 1}
+#endif
+{ }
+
+//----------------------------------------------------------------------
+template <typename CharPtr
+        , FSignalId::enable_if_CharPointer_t<CharPtr>>
+inline FSignalId::FSignalId (const CharPtr& signal) noexcept
+  : id{signal ? hash(signal, std::strlen(signal)) : FNV_OFFSET_BASIS}
+{
+#if DEBUG
+  if ( signal )
+    registerName (id, toWideName(signal, std::strlen(signal)));
+#endif
+}
+
+//----------------------------------------------------------------------
+inline FSignalId::FSignalId (const std::string& signal) noexcept
+  : id{hash(signal.data(), signal.length())}
+{
+#if DEBUG
+  registerName (id, toWideName(signal.data(), signal.length()));
+#endif
+}
+
+//----------------------------------------------------------------------
+inline FSignalId::FSignalId (const std::wstring& signal) noexcept
+  : id{hash(signal.data(), signal.length())}
+{
+#if DEBUG
+  registerName (id, toWideName(signal.data(), signal.length()));
+#endif
+}
+
+//----------------------------------------------------------------------
+inline FSignalId::FSignalId (const FString& signal) noexcept
+  : id{hash(signal.wc_str(), signal.getLength())}
+{
+#if DEBUG
+  registerName (id, toWideName(signal.wc_str(), signal.getLength()));
+#endif
+}
+
+//----------------------------------------------------------------------
+inline auto FSignalId::getClassName() const -> FString
+{ return "FSignalId"; }
+
+//----------------------------------------------------------------------
+constexpr auto FSignalId::get() const noexcept -> uInt64
+{ return id; }
+
+//----------------------------------------------------------------------
+constexpr auto FSignalId::decode ( const char* str, std::size_t length
+                                 , std::size_t& i ) noexcept -> uInt32
+{
+  // Returns the Unicode code point of the UTF-8 sequence
+  // at position i and moves i behind the sequence
+
+  auto ch = uInt32(uChar(str[i]));
+  std::size_t follow{0};
+
+  if ( ch >= 0xf0 )
+  {
+    ch &= 0x07;
+    follow = 3;
+  }
+  else if ( ch >= 0xe0 )
+  {
+    ch &= 0x0f;
+    follow = 2;
+  }
+  else if ( ch >= 0xc0 )
+  {
+    ch &= 0x1f;
+    follow = 1;
+  }
+
+  i++;
+
+  while ( follow > 0 && i < length && (uChar(str[i]) & 0xc0) == 0x80 )
+  {
+    ch = (ch << 6) | (uChar(str[i]) & 0x3f);
+    follow--;
+    i++;
+  }
+
+  return ch;
+}
+
+//----------------------------------------------------------------------
+constexpr auto FSignalId::hash (uInt64 value, uInt32 code_point) noexcept -> uInt64
+{
+  // FNV-1a step for one code point
+  return (value ^ code_point) * FNV_PRIME;
+}
+
+//----------------------------------------------------------------------
+constexpr auto FSignalId::hash (const char* str, std::size_t length) noexcept -> uInt64
+{
+  // Hashes the Unicode code points of a UTF-8 string, so that
+  // narrow and wide signal names get the same identifier
+
+  uInt64 value{FNV_OFFSET_BASIS};
+  std::size_t i{0};
+
+  while ( i < length && str[i] != '\0' )
+    value = hash(value, decode(str, length, i));
+
+  return value;
+}
+
+//----------------------------------------------------------------------
+constexpr auto FSignalId::hash (const wchar_t* str, std::size_t length) noexcept -> uInt64
+{
+  uInt64 value{FNV_OFFSET_BASIS};
+
+  for (std::size_t i{0}; i < length && str[i] != L'\0'; i++)
+    value = hash(value, uInt32(str[i]));
+
+  return value;
+}
+
+
 //----------------------------------------------------------------------
 // struct FCallbackData
 //----------------------------------------------------------------------
@@ -57,9 +278,8 @@ struct FCallbackData
   FCallbackData() = default;
 
   template <typename FuncPtr>
-  FCallbackData (FString&& s, FWidget* i, FuncPtr m, FCall&& c)
-    : cb_signal(std::move(s))
-    , cb_instance(i)
+  FCallbackData (FWidget* i, FuncPtr m, FCall&& c)
+    : cb_instance(i)
     , cb_function_ptr(m)
     , cb_function(std::move(c))
   { }
@@ -71,7 +291,6 @@ struct FCallbackData
   auto operator = (FCallbackData&&) noexcept -> FCallbackData& = default;
 
   // Data members
-  FString   cb_signal{};
   FWidget*  cb_instance{};
   void*     cb_function_ptr{};
   FCall     cb_function{};
@@ -154,7 +373,7 @@ class FCallback
             , enable_if_ObjectPointer_t<Object> = nullptr
             , enable_if_MemberFunctionPointer_t<Function> = nullptr
             , typename... Args>
-    void addCallback ( FString&&  cb_signal
+    void addCallback ( FSignalId  cb_signal
                      , Object&&   cb_instance
                      , Function&& cb_member
                      , Args&&...  args) noexcept;
@@ -163,41 +382,41 @@ class FCallback
              , enable_if_ObjectPointer_t<Object> = nullptr
              , enable_if_ClassObject_t<Function> = nullptr
              , typename... Args>
-    void addCallback ( FString&&  cb_signal
+    void addCallback ( FSignalId  cb_signal
                      , Object&&   cb_instance
                      , Function&& cb_function
                      , Args&&...  args) noexcept;
     template < typename Function
              , enable_if_ClassObject_t<Function> = nullptr
              , typename... Args>
-    void addCallback ( FString&&  cb_signal
+    void addCallback ( FSignalId  cb_signal
                      , Function&& cb_function
                      , Args&&...  args) noexcept;
     template <typename Function
             , enable_if_ClassObject_t<Function> = nullptr
             , typename... Args>
-    void addCallback ( FString&& cb_signal
+    void addCallback ( FSignalId cb_signal
                      , Function& cb_function
                      , Args&&... args) noexcept;
     template <typename Function
             , enable_if_FunctionReference_t<Function> = nullptr
             , typename... Args>
-    void addCallback ( FString&& cb_signal
+    void addCallback ( FSignalId cb_signal
                      , Function& cb_function
                      , Args&&... args) noexcept;
     template <typename Function
             , enable_if_FunctionPointer_t<Function> = nullptr
             , typename... Args>
-    void addCallback ( FString&&  cb_signal
+    void addCallback ( FSignalId  cb_signal
                      , Function&& cb_function
                      , Args&&...  args) noexcept;
     template <typename Object
             , enable_if_ObjectPointer_t<Object> = nullptr>
     void delCallback (Object&& cb_instance) noexcept;
-    void delCallback (const FString& cb_signal);
+    void delCallback (FSignalId cb_signal);
     template <typename Object
             , enable_if_ObjectPointer_t<Object> = nullptr>
-    void delCallback ( const FString& cb_signal
+    void delCallback ( FSignalId cb_signal
                      , Object&& cb_instance ) noexcept;
     template <typename FunctionPtr
             , enable_if_FunctionPointer_t<FunctionPtr> = nullptr>
@@ -206,14 +425,22 @@ class FCallback
             , enable_if_FunctionReference_t<Function> = nullptr>
     void delCallback (const Function& cb_function);
     void delCallback();
-    void emitCallback (const FString& emit_signal) const;
+    void emitCallback (FSignalId emit_signal) const;
 
   private:
-    // Using-declaration
+    // Using-declarations
     using FCallbackObjects = std::vector<FCallbackData>;
+    using FCallbackMap = std::unordered_map<uInt64, FCallbackObjects>;
+
+    // Methods
+    auto getSignalCallbacks (const FSignalId&) -> FCallbackObjects&;
+    template <typename Predicate>
+    void eraseCallbacks (FCallbackObjects&, Predicate&&) noexcept;
+    template <typename Predicate>
+    void eraseCallbacks (Predicate&&) noexcept;
 
     // Data members
-    FCallbackObjects  callback_objects{};
+    FCallbackMap  callback_objects{};  // Callbacks grouped by signal
 };
 
 // FCallback inline functions
@@ -223,7 +450,14 @@ inline auto FCallback::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline auto FCallback::getCallbackCount() const -> std::size_t
-{ return callback_objects.size(); }
+{
+  std::size_t count{0};
+
+  for (const auto& signal_callbacks : callback_objects)
+    count += signal_callbacks.second.size();
+
+  return count;
+}
 
 //----------------------------------------------------------------------
 template <typename Object
@@ -231,7 +465,7 @@ template <typename Object
         , FCallback::enable_if_ObjectPointer_t<Object>
         , FCallback::enable_if_MemberFunctionPointer_t<Function>
         , typename... Args>
-inline void FCallback::addCallback ( FString&&  cb_signal
+inline void FCallback::addCallback ( FSignalId  cb_signal
                                    , Object&&   cb_instance
                                    , Function&& cb_member
                                    , Args&&...  args) noexcept
@@ -242,7 +476,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   auto fn = std::bind ( std::forward<Function>(cb_member)
                       , std::forward<Object>(cb_instance)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), instance, nullptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (instance, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -251,7 +485,7 @@ template <typename Object
          , FCallback::enable_if_ObjectPointer_t<Object>
          , FCallback::enable_if_ClassObject_t<Function>
          , typename... Args>
-inline void FCallback::addCallback ( FString&&  cb_signal
+inline void FCallback::addCallback ( FSignalId  cb_signal
                                    , Object&&   cb_instance
                                    , Function&& cb_function
                                    , Args&&...  args) noexcept
@@ -259,14 +493,14 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   // Add a function object to an instance as callback
 
   auto fn = std::bind (std::forward<Function>(cb_function), std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), cb_instance, nullptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (cb_instance, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
 template <typename Function
         , FCallback::enable_if_ClassObject_t<Function>
         , typename... Args>
-inline void FCallback::addCallback ( FString&&  cb_signal
+inline void FCallback::addCallback ( FSignalId  cb_signal
                                    , Function&& cb_function
                                    , Args&&...  args) noexcept
 {
@@ -274,28 +508,28 @@ inline void FCallback::addCallback ( FString&&  cb_signal
 
   auto fn = std::bind ( std::forward<Function>(cb_function)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (nullptr, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
 template <typename Function
         , FCallback::enable_if_ClassObject_t<Function>
         , typename... Args>
-inline void FCallback::addCallback ( FString&& cb_signal
+inline void FCallback::addCallback ( FSignalId cb_signal
                                    , Function& cb_function
                                    , Args&&... args) noexcept
 {
   // Add a function object reference as callback
 
   auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (nullptr, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
 template <typename Function
         , FCallback::enable_if_FunctionReference_t<Function>
         , typename... Args>
-inline void FCallback::addCallback ( FString&& cb_signal
+inline void FCallback::addCallback ( FSignalId cb_signal
                                    , Function& cb_function
                                    , Args&&... args) noexcept
 {
@@ -303,14 +537,14 @@ inline void FCallback::addCallback ( FString&& cb_signal
 
   auto ptr = reinterpret_cast<void*>(&cb_function);
   auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, ptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (nullptr, ptr, fn);
 }
 
 //----------------------------------------------------------------------
 template <typename Function
         , FCallback::enable_if_FunctionPointer_t<Function>
         , typename... Args>
-inline void FCallback::addCallback ( FString&&  cb_signal
+inline void FCallback::addCallback ( FSignalId  cb_signal
                                    , Function&& cb_function
                                    , Args&&...  args) noexcept
 {
@@ -319,7 +553,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   auto ptr = reinterpret_cast<void*>(cb_function);
   auto fn = std::bind ( std::forward<Function>(cb_function)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back(std::move(cb_signal), nullptr, ptr, fn);
+  getSignalCallbacks(cb_signal).emplace_back (nullptr, ptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -329,42 +563,30 @@ inline void FCallback::delCallback (Object&& cb_instance) noexcept
 {
   // Deletes entries with the given instance from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [&cb_instance] (const FCallbackData& data)
+                   { return data.cb_instance == cb_instance; } );
 }
 
 //----------------------------------------------------------------------
 template <typename Object
         , FCallback::enable_if_ObjectPointer_t<Object>>
-inline void FCallback::delCallback ( const FString& cb_signal
+inline void FCallback::delCallback ( FSignalId cb_signal
                                    , Object&& cb_instance ) noexcept
 {
   // Deletes entries with the given signal and instance
   // from the callback list
 
-  if ( callback_objects.empty() )
+  const auto iter = callback_objects.find(cb_signal.get());
+
+  if ( iter == callback_objects.end() )
     return;
 
-  auto iter = callback_objects.cbegin();
+  eraseCallbacks ( iter->second
+                 , [&cb_instance] (const FCallbackData& data)
+                   { return data.cb_instance == cb_instance; } );
 
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal
-      && iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  if ( iter->second.empty() )
+    callback_objects.erase(iter);
 }
 
 //----------------------------------------------------------------------
@@ -375,19 +597,9 @@ inline void FCallback::delCallback (FunctionPtr&& cb_func_ptr) noexcept
   // Deletes entries with the given function pointer
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(cb_func_ptr);
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_function_ptr == ptr )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [ptr] (const FCallbackData& data)
+                   { return data.cb_function_ptr == ptr; } );
 }
 
 //----------------------------------------------------------------------
@@ -398,15 +610,49 @@ inline void FCallback::delCallback (const Function& cb_function)
   // Deletes entries with the given function reference
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(&cb_function);
-  auto iter = callback_objects.cbegin();
+  eraseCallbacks ( [ptr] (const FCallbackData& data)
+                   { return data.cb_function_ptr == ptr; } );
+}
 
-  while ( iter != callback_objects.cend() )
+//----------------------------------------------------------------------
+inline auto FCallback::getSignalCallbacks (const FSignalId& cb_signal) -> FCallbackObjects&
+{
+#if DEBUG
+  cb_signal.checkName();  // Asserts on a signal id collision
+#endif
+  return callback_objects[cb_signal.get()];
+}
+
+//----------------------------------------------------------------------
+template <typename Predicate>
+inline void FCallback::eraseCallbacks ( FCallbackObjects& callbacks
+                                      , Predicate&& predicate ) noexcept
+{
+  auto iter = callbacks.cbegin();
+
+  while ( iter != callbacks.cend() )
   {
-    if ( iter->cb_function_ptr == ptr )
+    if ( predicate(*iter) )
+      iter = callbacks.erase(iter);
+    else
+      ++iter;
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename Predicate>
+inline void FCallback::eraseCallbacks (Predicate&& predicate) noexcept
+{
+  // Deletes matching entries of all signals
+
+  auto iter = callback_objects.begin();
+
+  while ( iter != callback_objects.end() )
+  {
+    eraseCallbacks (iter->second, predicate);
+
+    if ( iter->second.empty() )
       iter = callback_objects.erase(iter);
     else
       ++iter;
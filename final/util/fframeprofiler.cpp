@@ -0,0 +1,145 @@
+/***********************************************************************
+* fframeprofiler.cpp - Per-phase timing of the event loop frames       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+#include <algorithm>
+#include <memory>
+
+#include "final/util/fframeprofiler.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FFrameProfiler
+//----------------------------------------------------------------------
+
+// public methods of FFrameProfiler
+//----------------------------------------------------------------------
+auto FFrameProfiler::getInstance() -> FFrameProfiler&
+{
+  static const auto& frame_profiler = std::make_unique<FFrameProfiler>();
+  return *frame_profiler;
+}
+
+//----------------------------------------------------------------------
+auto FFrameProfiler::getPhaseName (Phase phase) -> const char*
+{
+  static constexpr std::array<const char*, PHASE_COUNT> phase_names
+  {{
+    "timer",
+    "input",
+    "resize",
+    "close",
+    "events",
+    "dialog move",
+    "update",
+    "flush",
+    "logger"
+  }};
+
+  return phase_names[std::size_t(phase)];
+}
+
+//----------------------------------------------------------------------
+auto FFrameProfiler::getFrames (std::size_t count) const -> std::vector<FrameData>
+{
+  // Returns the last "count" frames, the oldest frame first
+
+  std::vector<FrameData> frames{};
+  std::lock_guard<std::mutex> lock_guard(ring_mutex);
+  const auto end = frame_count.load(std::memory_order_relaxed);
+  count = std::size_t(std::min({uInt64(count), uInt64(RING_SIZE), end}));
+  frames.reserve(count);
+
+  for (auto n = end - count; n < end; n++)
+    frames.push_back(ring[std::size_t(n % RING_SIZE)]);
+
+  return frames;
+}
+
+//----------------------------------------------------------------------
+auto FFrameProfiler::getAverage (std::size_t count) const -> FrameData
+{
+  // Returns the average of the last "count" frames
+
+  const auto frames = getFrames(count);
+  FrameData average{};
+
+  if ( frames.empty() )
+    return average;
+
+  for (const auto& frame : frames)
+  {
+    for (std::size_t i{0}; i < PHASE_COUNT; i++)
+      average.phase_time[i] += frame.phase_time[i];
+
+    average.total_time += frame.total_time;
+    average.cell_count += frame.cell_count;
+    average.byte_count += frame.byte_count;
+    average.event_count += frame.event_count;
+  }
+
+  const auto size = frames.size();
+
+  for (auto& phase_time : average.phase_time)
+    phase_time /= size;
+
+  average.number = frames.back().number;
+  average.total_time /= size;
+  average.cell_count /= size;
+  average.byte_count /= size;
+  average.event_count /= size;
+  return average;
+}
+
+//----------------------------------------------------------------------
+void FFrameProfiler::endFrame() noexcept
+{
+  if ( ! recording )
+    return;
+
+  recording = false;
+  const auto count = frame_count.load(std::memory_order_relaxed);
+  current.number = count;
+  current.total_time = getNanoseconds(frame_start, Clock::now());
+
+  {
+    std::lock_guard<std::mutex> lock_guard(ring_mutex);
+    ring[std::size_t(count % RING_SIZE)] = current;
+    frame_count.store(count + 1, std::memory_order_release);  // Publish
+  }
+
+  current = FrameData{};
+}
+
+//----------------------------------------------------------------------
+void FFrameProfiler::clear() noexcept
+{
+  // Removes all recorded frames (main thread only)
+
+  current = FrameData{};
+  std::lock_guard<std::mutex> lock_guard(ring_mutex);
+  frame_count.store(0, std::memory_order_release);
+}
+
+}  // namespace finalcut
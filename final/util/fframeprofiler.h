@@ -0,0 +1,231 @@
+/***********************************************************************
+* fframeprofiler.h - Per-phase timing of the event loop frames         *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FFrameProfiler ▏- - - -▕ FrameData ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// The frame profiler measures the duration of every phase of an
+// event loop pass (a frame) together with the number of composited
+// character cells, written bytes and dispatched events. Completed
+// frames are stored in a ring of the last RING_SIZE frames. Only the
+// main thread writes frames. The ring is guarded by a mutex, which the
+// main thread locks once per frame to store the completed frame, so
+// other threads can read the frames safely. When the profiler is
+// disabled, every hook costs only a test of a boolean flag.
+
+#ifndef FFRAMEPROFILER_H
+#define FFRAMEPROFILER_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "final/ftypes.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FFrameProfiler
+//----------------------------------------------------------------------
+
+class FFrameProfiler final
+{
+  public:
+    // Enumeration
+    enum class Phase : std::size_t
+    {
+      Timer,           // Timer events
+      Input,           // Keyboard and mouse input
+      Resize,          // Terminal resize
+      Close,           // Closing widgets
+      QueuedEvents,    // Queued and posted events
+      DialogMove,      // Dialog resizing and moving
+      TerminalUpdate,  // Compositing and output of changes
+      Flush,           // Flushing the output buffer
+      Logger           // Log output
+    };
+
+    // Constants
+    static constexpr std::size_t PHASE_COUNT = 9;
+    static constexpr std::size_t RING_SIZE = 256;
+
+    // Using-declaration
+    using PhaseTimes = std::array<uInt64, PHASE_COUNT>;
+
+    struct FrameData
+    {
+      uInt64       number{0};        // Consecutive frame number
+      PhaseTimes   phase_time{};     // Phase durations in nanoseconds
+      uInt64       total_time{0};    // Frame duration in nanoseconds
+      std::size_t  cell_count{0};    // Composited character cells
+      std::size_t  byte_count{0};    // Bytes written to the terminal
+      std::size_t  event_count{0};   // Dispatched events
+    };
+
+    // Constructor
+    FFrameProfiler() = default;
+
+    // Disable copy constructor
+    FFrameProfiler (const FFrameProfiler&) = delete;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FFrameProfiler&) -> FFrameProfiler& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    static auto getInstance() -> FFrameProfiler&;
+    static auto getPhaseName (Phase) -> const char*;
+    auto getFrameCount() const noexcept -> uInt64;
+    auto getFrames (std::size_t = RING_SIZE) const -> std::vector<FrameData>;
+    auto getAverage (std::size_t = RING_SIZE) const -> FrameData;
+
+    // Mutators
+    void setEnable (bool = true) noexcept;
+    void unsetEnable() noexcept;
+
+    // Inquiries
+    auto isEnabled() const noexcept -> bool;
+    auto isRecording() const noexcept -> bool;
+
+    // Methods
+    void beginFrame() noexcept;
+    void endPhase (Phase) noexcept;
+    void endFrame() noexcept;
+    void addCells (std::size_t) noexcept;
+    void addBytes (std::size_t) noexcept;
+    void addEvents (std::size_t) noexcept;
+    void clear() noexcept;
+
+  private:
+    // Using-declaration
+    using Clock = std::chrono::steady_clock;
+
+    // Method
+    static auto getNanoseconds (Clock::time_point, Clock::time_point) noexcept -> uInt64;
+
+    // Data members
+    std::array<FrameData, RING_SIZE>  ring{};
+    mutable std::mutex                ring_mutex{};
+    FrameData                         current{};
+    Clock::time_point                 frame_start{};
+    Clock::time_point                 phase_start{};
+    std::atomic<uInt64>               frame_count{0};
+    std::atomic<bool>                 enabled{false};
+    bool                              recording{false};
+};
+
+// FFrameProfiler inline functions
+//----------------------------------------------------------------------
+inline auto FFrameProfiler::getClassName() const -> FString
+{ return "FFrameProfiler"; }
+
+//----------------------------------------------------------------------
+inline auto FFrameProfiler::getFrameCount() const noexcept -> uInt64
+{ return frame_count.load(std::memory_order_acquire); }
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::setEnable (bool enable) noexcept
+{ enabled.store(enable, std::memory_order_relaxed); }
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::unsetEnable() noexcept
+{ setEnable(false); }
+
+//----------------------------------------------------------------------
+inline auto FFrameProfiler::isEnabled() const noexcept -> bool
+{ return enabled.load(std::memory_order_relaxed); }
+
+//----------------------------------------------------------------------
+inline auto FFrameProfiler::isRecording() const noexcept -> bool
+{ return recording; }
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::beginFrame() noexcept
+{
+  // A changed enable state takes effect with the next frame
+  recording = isEnabled();
+
+  if ( ! recording )
+    return;
+
+  frame_start = Clock::now();
+  phase_start = frame_start;
+}
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::endPhase (Phase phase) noexcept
+{
+  if ( ! recording )
+    return;
+
+  const auto now = Clock::now();
+  current.phase_time[std::size_t(phase)] += getNanoseconds(phase_start, now);
+  phase_start = now;
+}
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::addCells (std::size_t count) noexcept
+{
+  if ( recording )
+    current.cell_count += count;
+}
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::addBytes (std::size_t count) noexcept
+{
+  if ( recording )
+    current.byte_count += count;
+}
+
+//----------------------------------------------------------------------
+inline void FFrameProfiler::addEvents (std::size_t count) noexcept
+{
+  if ( recording )
+    current.event_count += count;
+}
+
+//----------------------------------------------------------------------
+inline auto FFrameProfiler::getNanoseconds ( Clock::time_point start
+                                           , Clock::time_point end ) noexcept -> uInt64
+{
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+  return uInt64(duration_cast<nanoseconds>(end - start).count());
+}
+
+}  // namespace finalcut
+
+#endif  // FFRAMEPROFILER_H
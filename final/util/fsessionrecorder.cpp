@@ -0,0 +1,283 @@
+/***********************************************************************
+* fsessionrecorder.cpp - Records the terminal input and output         *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <array>
+#include <memory>
+
+#include "final/util/fsessionrecorder.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+constexpr char session_header[] = "FINALCUT-SESSION 1\n";
+constexpr std::size_t session_header_length = sizeof(session_header) - 1;
+
+//----------------------------------------------------------------------
+template <typename NumT>
+void writeNumber (std::ofstream& file, NumT number)
+{
+  // Writes the number in little-endian byte order
+
+  std::array<char, sizeof(NumT)> bytes{};
+
+  for (auto& byte : bytes)
+  {
+    byte = char(number & 0xff);
+    number = NumT(number >> 8);
+  }
+
+  file.write (bytes.data(), std::streamsize(bytes.size()));
+}
+
+//----------------------------------------------------------------------
+template <typename NumT>
+auto readNumber (std::ifstream& file, NumT& number) -> bool
+{
+  std::array<char, sizeof(NumT)> bytes{};
+
+  if ( ! file.read (bytes.data(), std::streamsize(bytes.size())) )
+    return false;
+
+  number = 0;
+
+  for (auto iter = bytes.crbegin(); iter != bytes.crend(); ++iter)
+    number = NumT((number << 8) | NumT(uChar(*iter)));
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto isValidRecordType (char type) -> bool
+{
+  using RecordType = FSessionRecorder::RecordType;
+
+  return type == char(RecordType::Input)
+      || type == char(RecordType::Output)
+      || type == char(RecordType::Frame)
+      || type == char(RecordType::Resize);
+}
+
+}  // namespace internal
+
+
+//----------------------------------------------------------------------
+// class FSessionRecorder
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FSessionRecorder::~FSessionRecorder() noexcept  // destructor
+{
+  stop();
+}
+
+
+// public methods of FSessionRecorder
+//----------------------------------------------------------------------
+auto FSessionRecorder::getInstance() -> FSessionRecorder&
+{
+  static const auto& session_recorder = std::make_unique<FSessionRecorder>();
+  return *session_recorder;
+}
+
+//----------------------------------------------------------------------
+auto FSessionRecorder::getTerminalSize (const Record& record) -> std::pair<uInt32, uInt32>
+{
+  // Returns the columns and lines of a resize record
+
+  if ( record.type != RecordType::Resize || record.data.size() != 8 )
+    return {0, 0};
+
+  auto get = [&record] (std::size_t pos)
+  {
+    uInt32 number{0};
+
+    for (std::size_t i{4}; i > 0; i--)
+      number = (number << 8) | uInt32(uChar(record.data[pos + i - 1]));
+
+    return number;
+  };
+
+  return { get(0), get(4) };
+}
+
+//----------------------------------------------------------------------
+auto FSessionRecorder::start (const std::string& filename) -> bool
+{
+  stop();
+  file.open (filename, std::ofstream::out | std::ofstream::binary);
+
+  if ( ! file.is_open() )
+    return false;
+
+  file.write (internal::session_header, internal::session_header_length);
+  pending = {};
+  frame_changed = false;
+  start_time = Clock::now();
+  recording = true;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::stop() noexcept
+{
+  if ( ! recording )
+    return;
+
+  recording = false;
+
+  try
+  {
+    writePending();
+    file.close();
+  }
+  catch (const std::exception&)
+  {
+    // Nothing to do, the recording is incomplete
+  }
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::recordFrame()
+{
+  // Event loop passes without input or output are not recorded
+
+  if ( ! recording || ! frame_changed )
+    return;
+
+  writePending();
+  writeRecord ({RecordType::Frame, getTime(), {}});
+  frame_changed = false;
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::recordResize (std::size_t columns, std::size_t lines)
+{
+  if ( ! recording )
+    return;
+
+  std::string data(8, '\0');
+
+  for (std::size_t i{0}; i < 4; i++)
+  {
+    data[i] = char((columns >> (8 * i)) & 0xff);
+    data[i + 4] = char((lines >> (8 * i)) & 0xff);
+  }
+
+  writePending();
+  writeRecord ({RecordType::Resize, getTime(), std::move(data)});
+  frame_changed = true;
+}
+
+//----------------------------------------------------------------------
+auto FSessionRecorder::load (const std::string& filename) -> RecordList
+{
+  // Reads all records of a session file. An unknown or
+  // truncated record ends the list.
+
+  RecordList records{};
+  std::ifstream in_file(filename, std::ifstream::in | std::ifstream::binary);
+  std::array<char, internal::session_header_length> header{};
+
+  if ( ! in_file.read (header.data(), std::streamsize(header.size()))
+    || std::string(header.data(), header.size()) != internal::session_header )
+    return records;
+
+  char type{};
+
+  while ( in_file.get(type) && internal::isValidRecordType(type) )
+  {
+    Record record{};
+    record.type = RecordType(type);
+    uInt32 length{0};
+
+    if ( ! internal::readNumber(in_file, record.time)
+      || ! internal::readNumber(in_file, length) )
+      break;
+
+    record.data.resize(length);
+
+    if ( length > 0
+      && ! in_file.read (&record.data[0], std::streamsize(length)) )
+      break;
+
+    records.push_back(std::move(record));
+  }
+
+  return records;
+}
+
+
+// private methods of FSessionRecorder
+//----------------------------------------------------------------------
+inline auto FSessionRecorder::getTime() const -> uInt64
+{
+  const auto duration = Clock::now() - start_time;
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  return uInt64(duration_cast<microseconds>(duration).count());
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::append ( RecordType type
+                              , const char* data, std::size_t size )
+{
+  if ( ! data || size == 0 )
+    return;
+
+  if ( pending.type != type || pending.data.size() >= MAX_PENDING_SIZE )
+    writePending();
+
+  if ( pending.data.empty() )
+  {
+    // The record gets the time of its first byte
+    pending.type = type;
+    pending.time = getTime();
+  }
+
+  pending.data.append(data, size);
+  frame_changed = true;
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::writePending()
+{
+  if ( pending.data.empty() )
+    return;
+
+  writeRecord (pending);
+  pending.data.clear();  // Keeps the capacity
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorder::writeRecord (const Record& record)
+{
+  file.put (char(record.type));
+  internal::writeNumber (file, record.time);
+  internal::writeNumber (file, uInt32(record.data.size()));
+  file.write (record.data.data(), std::streamsize(record.data.size()));
+}
+
+}  // namespace finalcut
@@ -0,0 +1,164 @@
+/***********************************************************************
+* fsessionrecorder.h - Records the terminal input and output           *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▏
+ * ▕ FSessionRecorder ▏- - - -▕ Record ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▏
+ */
+
+// The session recorder writes the raw bytes read from the terminal
+// and the raw bytes written to the terminal into a file. Every record
+// gets a timestamp in microseconds since the start of the recording.
+// An event loop pass with input or output ends with a frame record,
+// so the output can be assigned to single frames. Consecutive bytes of the same type are
+// combined into one record. A recorded session can be replayed with
+// FSessionReplay.
+//
+// File format: the header line "FINALCUT-SESSION 1\n" followed by
+// records of the form
+//   type (1 byte) │ time (8 bytes) │ length (4 bytes) │ data
+// Numbers are stored in little-endian byte order.
+
+#ifndef FSESSIONRECORDER_H
+#define FSESSIONRECORDER_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "final/ftypes.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSessionRecorder
+//----------------------------------------------------------------------
+
+class FSessionRecorder final
+{
+  public:
+    // Enumeration
+    enum class RecordType : char
+    {
+      Input  = 'I',  // Bytes read from the terminal
+      Output = 'O',  // Bytes written to the terminal
+      Frame  = 'F',  // End of an event loop pass
+      Resize = 'R'   // Terminal size (columns and lines)
+    };
+
+    struct Record
+    {
+      RecordType   type{RecordType::Input};
+      uInt64       time{0};  // Microseconds since the start
+      std::string  data{};
+    };
+
+    // Using-declaration
+    using RecordList = std::vector<Record>;
+
+    // Constructor
+    FSessionRecorder() = default;
+
+    // Disable copy constructor
+    FSessionRecorder (const FSessionRecorder&) = delete;
+
+    // Destructor
+    ~FSessionRecorder() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FSessionRecorder&) -> FSessionRecorder& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    static auto getInstance() -> FSessionRecorder&;
+    static auto getTerminalSize (const Record&) -> std::pair<uInt32, uInt32>;
+
+    // Inquiry
+    auto isRecording() const noexcept -> bool;
+
+    // Methods
+    auto start (const std::string&) -> bool;
+    void stop() noexcept;
+    void recordInput (const char*, std::size_t);
+    void recordOutput (const char*, std::size_t);
+    void recordFrame();
+    void recordResize (std::size_t, std::size_t);
+    static auto load (const std::string&) -> RecordList;
+
+  private:
+    // Constants
+    static constexpr std::size_t MAX_PENDING_SIZE = 65536;
+
+    // Using-declaration
+    using Clock = std::chrono::steady_clock;
+
+    // Methods
+    auto getTime() const -> uInt64;
+    void append (RecordType, const char*, std::size_t);
+    void writePending();
+    void writeRecord (const Record&);
+
+    // Data members
+    std::ofstream      file{};
+    Record             pending{};
+    Clock::time_point  start_time{};
+    bool               recording{false};
+    bool               frame_changed{false};
+};
+
+// FSessionRecorder inline functions
+//----------------------------------------------------------------------
+inline auto FSessionRecorder::getClassName() const -> FString
+{ return "FSessionRecorder"; }
+
+//----------------------------------------------------------------------
+inline auto FSessionRecorder::isRecording() const noexcept -> bool
+{ return recording; }
+
+//----------------------------------------------------------------------
+inline void FSessionRecorder::recordInput (const char* data, std::size_t size)
+{
+  if ( recording )
+    append (RecordType::Input, data, size);
+}
+
+//----------------------------------------------------------------------
+inline void FSessionRecorder::recordOutput (const char* data, std::size_t size)
+{
+  if ( recording )
+    append (RecordType::Output, data, size);
+}
+
+}  // namespace finalcut
+
+#endif  // FSESSIONRECORDER_H
@@ -0,0 +1,458 @@
+/***********************************************************************
+* fsessionreplay.cpp - Replays a recorded terminal session             *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <thread>
+#include <utility>
+
+#include "final/util/fsessionreplay.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+//----------------------------------------------------------------------
+inline auto getReplayTime() -> uInt64
+{
+  // Returns the current time in microseconds
+
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  return uInt64(duration_cast<microseconds>(now).count());
+}
+
+//----------------------------------------------------------------------
+inline auto toMilliseconds (uInt64 usec) -> double
+{
+  return double(usec) / 1000.0;
+}
+
+}  // namespace internal
+
+
+//----------------------------------------------------------------------
+// class FSessionReplay
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FSessionReplay::FSessionReplay (RecordList record_list)
+  : records{std::move(record_list)}
+{ }
+
+//----------------------------------------------------------------------
+FSessionReplay::~FSessionReplay() noexcept  // destructor
+{
+  Result result{};
+  stopProcess(result);
+}
+
+
+// public methods of FSessionReplay
+//----------------------------------------------------------------------
+auto FSessionReplay::getRecordedFrameBytes() const -> std::vector<std::size_t>
+{
+  // Returns the recorded output bytes of each frame
+
+  std::vector<std::size_t> frame_bytes{};
+  std::size_t bytes{0};
+
+  for (const auto& record : records)
+  {
+    if ( record.type == FSessionRecorder::RecordType::Output )
+      bytes += record.data.size();
+    else if ( record.type == FSessionRecorder::RecordType::Frame )
+    {
+      frame_bytes.push_back(bytes);
+      bytes = 0;
+    }
+  }
+
+  if ( bytes > 0 )  // Output after the last frame
+    frame_bytes.push_back(bytes);
+
+  return frame_bytes;
+}
+
+//----------------------------------------------------------------------
+auto FSessionReplay::run (const std::vector<std::string>& command) -> Result
+{
+  // Starts the command on a pseudo terminal and replays
+  // the recorded input and terminal size changes
+
+  using RecordType = FSessionRecorder::RecordType;
+  Result result{};
+
+  if ( command.empty() || ! startProcess(command) )
+    return result;
+
+  InputResult startup{};
+  const auto replay_start = internal::getReplayTime();
+  awaitOutput (startup, replay_start);
+  result.startup_bytes = startup.output_bytes;
+  result.startup_time = startup.settle_time;
+
+  const auto first = std::find_if ( records.cbegin(), records.cend()
+                                  , [] (const auto& record)
+                                    {
+                                      return record.type == RecordType::Input;
+                                    } );
+  const auto first_input_time = ( first != records.cend() ) ? first->time : 0;
+  const auto input_start = internal::getReplayTime();
+  bool first_resize{true};
+
+  for (const auto& record : records)
+  {
+    if ( eof )
+      break;
+
+    if ( record.type == RecordType::Resize && first_resize )
+    {
+      first_resize = false;  // Already set by startProcess()
+      continue;
+    }
+
+    if ( record.type != RecordType::Input
+      && record.type != RecordType::Resize )
+      continue;
+
+    if ( timing == Timing::Recorded && record.time > first_input_time )
+    {
+      // Waits for the recorded point in time
+      const auto send_time = input_start + record.time - first_input_time;
+      auto* previous = result.inputs.empty() ? &startup
+                                             : &result.inputs.back();
+
+      auto now = internal::getReplayTime();
+
+      while ( ! eof && now < send_time )
+      {
+        previous->output_bytes += readOutput(send_time - now);
+        now = internal::getReplayTime();
+      }
+    }
+
+    InputResult input_result{};
+    input_result.type = record.type;
+    const auto start = internal::getReplayTime();
+
+    if ( record.type == RecordType::Input )
+    {
+      input_result.input_bytes = record.data.size();
+
+      if ( ! writeInput(record.data) )
+        break;
+    }
+    else
+      setWindowSize (record);
+
+    awaitOutput (input_result, start);
+    result.inputs.push_back(input_result);
+  }
+
+  stopProcess(result);
+  return result;
+}
+
+//----------------------------------------------------------------------
+void FSessionReplay::printReport (const Result& result, std::ostream& out)
+{
+  using RecordType = FSessionRecorder::RecordType;
+  uInt64 latency_sum{0};
+  uInt64 latency_max{0};
+  std::size_t output_sum{0};
+  const auto flags = out.flags();
+  out << std::fixed << std::setprecision(2)
+      << "Startup: " << result.startup_bytes << " bytes in "
+      << internal::toMilliseconds(result.startup_time) << " ms\n\n"
+      << "     #  Input  Latency ms  Settle ms  Output bytes\n";
+
+  for (std::size_t n{0}; n < result.inputs.size(); n++)
+  {
+    const auto& input = result.inputs[n];
+    latency_sum += input.latency;
+    latency_max = std::max(latency_max, input.latency);
+    output_sum += input.output_bytes;
+    out << std::setw(6) << n + 1 << "  ";
+
+    if ( input.type == RecordType::Resize )
+      out << std::setw(5) << "size";
+    else
+      out << std::setw(5) << input.input_bytes;
+
+    out << std::setw(12) << internal::toMilliseconds(input.latency)
+        << std::setw(11) << internal::toMilliseconds(input.settle_time)
+        << std::setw(14) << input.output_bytes << '\n';
+  }
+
+  const auto count = std::max(result.inputs.size(), std::size_t(1));
+  out << "\nInputs: " << result.inputs.size()
+      << ", average latency: "
+      << internal::toMilliseconds(latency_sum / count) << " ms"
+      << ", maximum latency: "
+      << internal::toMilliseconds(latency_max) << " ms"
+      << ", output: " << output_sum << " bytes"
+      << ", exit status: " << result.exit_status << '\n';
+  out.flags(flags);
+}
+
+
+// private methods of FSessionReplay
+//----------------------------------------------------------------------
+auto FSessionReplay::startProcess (const std::vector<std::string>& command) -> bool
+{
+  master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+  if ( master_fd < 0 )
+    return false;
+
+  const char* slave_name = ( grantpt(master_fd) == 0
+                          && unlockpt(master_fd) == 0 )
+                         ? ptsname(master_fd)
+                         : nullptr;
+
+  if ( ! slave_name )
+  {
+    ::close(master_fd);
+    master_fd = -1;
+    return false;
+  }
+
+  const std::string slave_path{slave_name};
+  const auto resize = std::find_if ( records.cbegin(), records.cend()
+                                   , [] (const auto& record)
+                                     {
+                                       return record.type
+                                           == FSessionRecorder::RecordType::Resize;
+                                     } );
+
+  if ( resize != records.cend() )
+    setWindowSize (*resize);
+  else
+    setWindowSize ({FSessionRecorder::RecordType::Resize, 0, {}});
+
+  std::vector<char*> argv{};
+
+  for (const auto& arg : command)
+    argv.push_back(const_cast<char*>(arg.c_str()));
+
+  argv.push_back(nullptr);
+  child_pid = fork();
+
+  if ( child_pid < 0 )
+  {
+    ::close(master_fd);
+    master_fd = -1;
+    return false;
+  }
+
+  if ( child_pid == 0 )
+  {
+    // Child process: the pseudo terminal becomes the controlling terminal
+    setsid();
+    const int slave_fd = open(slave_path.c_str(), O_RDWR);
+
+    if ( slave_fd < 0 )
+      _exit(127);
+
+    ioctl(slave_fd, TIOCSCTTY, 0);
+    dup2(slave_fd, STDIN_FILENO);
+    dup2(slave_fd, STDOUT_FILENO);
+    dup2(slave_fd, STDERR_FILENO);
+
+    if ( slave_fd > STDERR_FILENO )
+      ::close(slave_fd);
+
+    ::close(master_fd);
+    execvp(argv[0], argv.data());
+    _exit(127);
+  }
+
+  eof = false;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FSessionReplay::stopProcess (Result& result)
+{
+  // Closing the pseudo terminal sends a SIGHUP to the program.
+  // A program that does not terminate is killed.
+
+  if ( master_fd >= 0 )
+  {
+    ::close(master_fd);
+    master_fd = -1;
+  }
+
+  if ( child_pid <= 0 )
+    return;
+
+  static constexpr std::array<int, 3> signals{{0, SIGTERM, SIGKILL}};
+  int status{0};
+  pid_t pid{0};
+
+  for (const auto sig : signals)
+  {
+    if ( sig != 0 )
+      kill(child_pid, sig);
+
+    for (int wait{0}; wait < 100; wait++)  // Up to one second
+    {
+      pid = waitpid(child_pid, &status, WNOHANG);
+
+      if ( pid != 0 )
+        break;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    if ( pid != 0 )
+      break;
+  }
+
+  if ( pid == child_pid )
+  {
+    if ( WIFEXITED(status) )
+      result.exit_status = WEXITSTATUS(status);
+    else if ( WIFSIGNALED(status) )
+      result.exit_status = 128 + WTERMSIG(status);
+  }
+
+  child_pid = -1;
+}
+
+//----------------------------------------------------------------------
+void FSessionReplay::setWindowSize (const FSessionRecorder::Record& record) const
+{
+  auto size = FSessionRecorder::getTerminalSize(record);
+
+  if ( size.first == 0 || size.second == 0 )
+    size = {80, 24};  // Default terminal size
+
+  struct winsize win_size{};
+  win_size.ws_col = uInt16(size.first);
+  win_size.ws_row = uInt16(size.second);
+  ioctl(master_fd, TIOCSWINSZ, &win_size);
+}
+
+//----------------------------------------------------------------------
+auto FSessionReplay::readOutput (uInt64 wait_time) -> std::size_t
+{
+  // Waits up to wait_time microseconds for output
+  // and returns the number of read bytes
+
+  struct pollfd fds{master_fd, POLLIN, 0};
+  const auto msec = int((wait_time + 999) / 1000);
+
+  if ( poll(&fds, 1, msec) <= 0 )
+    return 0;
+
+  std::array<char, 4096> buffer{};
+  const auto bytes = ::read(master_fd, buffer.data(), buffer.size());
+
+  if ( bytes > 0 )
+    return std::size_t(bytes);
+
+  if ( bytes == 0 || errno != EINTR )
+    eof = true;  // The program has closed the terminal
+
+  return 0;
+}
+
+//----------------------------------------------------------------------
+void FSessionReplay::awaitOutput (InputResult& input_result, uInt64 start)
+{
+  // Reads the output until there has been no output
+  // for settle_time or the timeout has expired
+
+  uInt64 last_output{start};
+  bool has_output{false};
+
+  while ( ! eof )
+  {
+    const auto now = internal::getReplayTime();
+    const auto settle_end = last_output + settle_time;
+    const auto timeout_end = start + timeout;
+
+    if ( now >= settle_end || now >= timeout_end )
+      break;
+
+    const auto bytes = readOutput(std::min(settle_end, timeout_end) - now);
+
+    if ( bytes == 0 )
+      continue;
+
+    last_output = internal::getReplayTime();
+
+    if ( ! has_output )
+    {
+      input_result.latency = last_output - start;
+      has_output = true;
+    }
+
+    input_result.output_bytes += bytes;
+  }
+
+  if ( has_output )
+    input_result.settle_time = last_output - start;
+}
+
+//----------------------------------------------------------------------
+auto FSessionReplay::writeInput (const std::string& data) const -> bool
+{
+  std::size_t written{0};
+
+  while ( written < data.size() )
+  {
+    const auto bytes = ::write ( master_fd
+                               , data.data() + written
+                               , data.size() - written );
+
+    if ( bytes < 0 && errno == EINTR )
+      continue;
+
+    if ( bytes <= 0 )
+      return false;
+
+    written += std::size_t(bytes);
+  }
+
+  return true;
+}
+
+}  // namespace finalcut
@@ -0,0 +1,164 @@
+/***********************************************************************
+* fsessionreplay.h - Replays a recorded terminal session               *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FSessionReplay ▏- - - -▕ FSessionRecorder ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// The session replay starts a program on a pseudo terminal and sends
+// it the recorded input of a session. After each input, the replay
+// waits until the program has finished its output and measures the
+// latency up to the first output byte, the time until the output
+// has settled and the number of output bytes. A recorded resize
+// changes the window size of the pseudo terminal.
+//
+// Terminal queries of the program are not answered, so a program
+// should be replayed with the options --no-terminal-detection
+// and --no-terminal-data-request.
+
+#ifndef FSESSIONREPLAY_H
+#define FSESSIONREPLAY_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <sys/types.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "final/ftypes.h"
+#include "final/util/fsessionrecorder.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSessionReplay
+//----------------------------------------------------------------------
+
+class FSessionReplay final
+{
+  public:
+    // Enumeration
+    enum class Timing
+    {
+      Recorded,  // Keeps the recorded pauses between the inputs
+      Fast       // Sends the next input after the output has settled
+    };
+
+    struct InputResult
+    {
+      FSessionRecorder::RecordType type{FSessionRecorder::RecordType::Input};
+      std::size_t  input_bytes{0};
+      uInt64       latency{0};      // Microseconds up to the first output byte
+      uInt64       settle_time{0};  // Microseconds up to the last output byte
+      std::size_t  output_bytes{0};
+    };
+
+    struct Result
+    {
+      std::vector<InputResult>  inputs{};
+      std::size_t               startup_bytes{0};  // Output before the first input
+      uInt64                    startup_time{0};   // Microseconds
+      int                       exit_status{-1};
+    };
+
+    // Using-declaration
+    using RecordList = FSessionRecorder::RecordList;
+
+    // Constructor
+    explicit FSessionReplay (RecordList);
+
+    // Disable copy constructor
+    FSessionReplay (const FSessionReplay&) = delete;
+
+    // Destructor
+    ~FSessionReplay() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FSessionReplay&) -> FSessionReplay& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getRecordList() const noexcept -> const RecordList&;
+    auto getRecordedFrameBytes() const -> std::vector<std::size_t>;
+
+    // Mutators
+    void setTiming (Timing) noexcept;
+    void setSettleTime (uInt64) noexcept;
+    void setTimeout (uInt64) noexcept;
+
+    // Methods
+    auto run (const std::vector<std::string>&) -> Result;
+    static void printReport (const Result&, std::ostream&);
+
+  private:
+    // Methods
+    auto startProcess (const std::vector<std::string>&) -> bool;
+    void stopProcess (Result&);
+    void setWindowSize (const FSessionRecorder::Record&) const;
+    auto readOutput (uInt64) -> std::size_t;
+    void awaitOutput (InputResult&, uInt64);
+    auto writeInput (const std::string&) const -> bool;
+
+    // Data members
+    RecordList  records{};
+    Timing      timing{Timing::Fast};
+    uInt64      settle_time{100'000};  // 100 ms
+    uInt64      timeout{5'000'000};    // 5 s
+    int         master_fd{-1};
+    pid_t       child_pid{-1};
+    bool        eof{false};
+};
+
+// FSessionReplay inline functions
+//----------------------------------------------------------------------
+inline auto FSessionReplay::getClassName() const -> FString
+{ return "FSessionReplay"; }
+
+//----------------------------------------------------------------------
+inline auto FSessionReplay::getRecordList() const noexcept -> const RecordList&
+{ return records; }
+
+//----------------------------------------------------------------------
+inline void FSessionReplay::setTiming (Timing t) noexcept
+{ timing = t; }
+
+//----------------------------------------------------------------------
+inline void FSessionReplay::setSettleTime (uInt64 usec) noexcept
+{ settle_time = usec; }
+
+//----------------------------------------------------------------------
+inline void FSessionReplay::setTimeout (uInt64 usec) noexcept
+{ timeout = usec; }
+
+}  // namespace finalcut
+
+#endif  // FSESSIONREPLAY_H
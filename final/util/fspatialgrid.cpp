@@ -0,0 +1,137 @@
+/***********************************************************************
+* fspatialgrid.cpp - Uniform grid for fast rectangle hit-testing       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+
+#include "final/util/fspatialgrid.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSpatialGrid
+//----------------------------------------------------------------------
+
+// public methods of FSpatialGrid
+//----------------------------------------------------------------------
+auto FSpatialGrid::getCandidates (const FPoint& pos) const noexcept -> CandidateRange
+{
+  // Returns the indices of all rectangles that overlap the grid cell
+  // at position pos. The caller has to check the exact rectangle.
+
+  if ( isEmpty() || ! bounds.contains(pos) )
+    return { cell_entries.cend(), cell_entries.cend() };
+
+  const auto cell = getRow(pos.getY()) * columns + getColumn(pos.getX());
+  const auto begin = cell_entries.cbegin();
+  return { begin + long(cell_start[cell])
+         , begin + long(cell_start[cell + 1]) };
+}
+
+//----------------------------------------------------------------------
+void FSpatialGrid::build (const std::vector<FRect>& rects)
+{
+  // Distributes the rectangle indices to the grid cells.
+  // The index order within a cell corresponds to the order in rects.
+
+  clear();
+  count = rects.size();
+  bool has_bounds{false};
+
+  auto is_valid = [] (const FRect& r)
+  {
+    return r.getX2() >= r.getX1() && r.getY2() >= r.getY1();
+  };
+
+  for (const auto& r : rects)
+  {
+    if ( ! is_valid(r) )
+      continue;
+
+    bounds = has_bounds ? bounds.combined(r) : r;
+    has_bounds = true;
+  }
+
+  if ( ! has_bounds )
+    return;
+
+  const auto width = bounds.getWidth();
+  const auto height = bounds.getHeight();
+  cell_width = std::max((width + MAX_COLUMNS - 1) / MAX_COLUMNS, std::size_t(1));
+  cell_height = std::max((height + MAX_ROWS - 1) / MAX_ROWS, std::size_t(1));
+  columns = (width + cell_width - 1) / cell_width;
+  rows = (height + cell_height - 1) / cell_height;
+
+  // Counting pass: number of entries per cell
+  cell_start.assign(columns * rows + 1, 0);
+
+  auto for_each_cell = [this] (const FRect& r, auto&& func)
+  {
+    const auto col_begin = getColumn(r.getX1());
+    const auto col_end = getColumn(r.getX2());
+    const auto row_begin = getRow(r.getY1());
+    const auto row_end = getRow(r.getY2());
+
+    for (auto row = row_begin; row <= row_end; row++)
+      for (auto col = col_begin; col <= col_end; col++)
+        func(row * columns + col);
+  };
+
+  for (const auto& r : rects)
+    if ( is_valid(r) )
+      for_each_cell (r, [this] (std::size_t cell) { cell_start[cell + 1]++; });
+
+  for (std::size_t cell{0}; cell < columns * rows; cell++)
+    cell_start[cell + 1] += cell_start[cell];
+
+  // Filling pass
+  cell_entries.resize(cell_start.back());
+  IndexList fill_pos(cell_start.cbegin(), cell_start.cend() - 1);
+
+  for (std::size_t index{0}; index < rects.size(); index++)
+  {
+    if ( ! is_valid(rects[index]) )
+      continue;
+
+    for_each_cell ( rects[index]
+                  , [this, &fill_pos, index] (std::size_t cell)
+                    {
+                      cell_entries[fill_pos[cell]] = index;
+                      fill_pos[cell]++;
+                    } );
+  }
+}
+
+//----------------------------------------------------------------------
+void FSpatialGrid::clear() noexcept
+{
+  bounds = FRect{};
+  count = 0;
+  columns = 0;
+  rows = 0;
+  cell_width = 1;
+  cell_height = 1;
+  cell_start.clear();
+  cell_entries.clear();
+}
+
+}  // namespace finalcut
@@ -0,0 +1,150 @@
+/***********************************************************************
+* fspatialgrid.h - Uniform grid for fast rectangle hit-testing         *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▏
+ * ▕ FSpatialGrid ▏- - - -▕ FRect ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FSPATIALGRID_H
+#define FSPATIALGRID_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <vector>
+
+#include "final/util/fpoint.h"
+#include "final/util/frect.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FSpatialGrid
+//----------------------------------------------------------------------
+
+class FSpatialGrid
+{
+  public:
+    // Using-declaration
+    using IndexList = std::vector<std::size_t>;
+
+    // Candidate range of a grid cell
+    class CandidateRange
+    {
+      public:
+        // Using-declaration
+        using const_iterator = IndexList::const_iterator;
+
+        // Constructor
+        CandidateRange (const_iterator b, const_iterator e) noexcept
+          : first{b}
+          , last{e}
+        { }
+
+        // Accessors
+        auto begin() const noexcept -> const_iterator
+        { return first; }
+
+        auto end() const noexcept -> const_iterator
+        { return last; }
+
+        auto size() const noexcept -> std::size_t
+        { return std::size_t(last - first); }
+
+        // Inquiry
+        auto empty() const noexcept -> bool
+        { return first == last; }
+
+      private:
+        // Data members
+        const_iterator first;
+        const_iterator last;
+    };
+
+    // Constants
+    static constexpr std::size_t MAX_COLUMNS{32};
+    static constexpr std::size_t MAX_ROWS{32};
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getBounds() const noexcept -> const FRect&;
+    auto getCount() const noexcept -> std::size_t;
+    auto getCandidates (const FPoint&) const noexcept -> CandidateRange;
+
+    // Inquiry
+    auto isEmpty() const noexcept -> bool;
+
+    // Methods
+    void build (const std::vector<FRect>&);
+    void clear() noexcept;
+
+  private:
+    // Methods
+    auto getColumn (int) const noexcept -> std::size_t;
+    auto getRow (int) const noexcept -> std::size_t;
+
+    // Data members
+    FRect        bounds{};
+    std::size_t  count{0};
+    std::size_t  columns{0};
+    std::size_t  rows{0};
+    std::size_t  cell_width{1};
+    std::size_t  cell_height{1};
+    IndexList    cell_start{};    // Offset of each cell in cell_entries
+    IndexList    cell_entries{};  // Rectangle indices in ascending order
+};
+
+// FSpatialGrid inline functions
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::getClassName() const -> FString
+{ return "FSpatialGrid"; }
+
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::getBounds() const noexcept -> const FRect&
+{ return bounds; }
+
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::getCount() const noexcept -> std::size_t
+{ return count; }
+
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::isEmpty() const noexcept -> bool
+{ return cell_entries.empty(); }
+
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::getColumn (int x) const noexcept -> std::size_t
+{ return std::size_t(x - bounds.getX1()) / cell_width; }
+
+//----------------------------------------------------------------------
+inline auto FSpatialGrid::getRow (int y) const noexcept -> std::size_t
+{ return std::size_t(y - bounds.getY1()) / cell_height; }
+
+}  // namespace finalcut
+
+#endif  // FSPATIALGRID_H
@@ -28,6 +28,7 @@
 #include "final/fapplication.h"
 #include "final/util/flog.h"
 #include "final/util/fstring.h"
+#include "final/util/fstringview.h"
 
 namespace finalcut
 {
@@ -126,6 +127,13 @@ FString::FString (const char c)
     internal_assign(std::wstring{wchar_t(uChar(c))});
 }
 
+//----------------------------------------------------------------------
+FString::FString (const FStringView& s)
+{
+  if ( ! s.isEmpty() )
+    internal_assign(s.toWString());
+}
+
 //----------------------------------------------------------------------
 FString::~FString() = default;  // destructor
 
@@ -673,6 +681,13 @@ auto FString::split (const FString& delimiter) const -> FStringList
   return string_list;
 }
 
+//----------------------------------------------------------------------
+auto FString::tokenize (const FStringView& delimiter) const -> FStringTokenizer
+{
+  // Allocation-free alternative to split()
+  return {*this, delimiter};
+}
+
 //----------------------------------------------------------------------
 auto FString::setString (const FString& s) -> FString&
 {
@@ -1030,6 +1045,18 @@ auto FString::remove (std::size_t pos, std::size_t len) -> const FString&
   return *this;
 }
 
+//----------------------------------------------------------------------
+auto FString::startsWith (const FStringView& s) const -> bool
+{
+  return FStringView{*this}.startsWith(s);
+}
+
+//----------------------------------------------------------------------
+auto FString::endsWith (const FStringView& s) const -> bool
+{
+  return FStringView{*this}.endsWith(s);
+}
+
 //----------------------------------------------------------------------
 auto FString::includes (const FString& s) const -> bool
 {
@@ -1172,27 +1199,7 @@ auto FStringCaseCompare (const FString& s1, const FString& s2) -> int
   if ( &s1 == &s2 )
     return 0;
 
-  auto iter1 = s1.cbegin();
-  auto iter2 = s2.cbegin();
-
-  while ( iter1 != s1.cend() )
-  {
-    if ( iter2 != s2.cend() )
-    {
-      int cmp = int(std::tolower(*iter1)) - int(std::tolower(*iter2));
-
-      if ( cmp != 0 )
-        return cmp;
-
-      ++iter2;
-    }
-    else
-      return int(std::tolower(*iter1));
-
-    ++iter1;
-  }
-
-  return -int(std::tolower(*iter2));
+  return FStringView{s1}.caseCompare(s2);
 }
 
 
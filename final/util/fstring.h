@@ -67,6 +67,8 @@ namespace finalcut
 
 // class forward declaration
 class FString;
+class FStringTokenizer;
+class FStringView;
 
 // Global using-declaration
 using FStringList = std::vector<FString>;
@@ -102,6 +104,7 @@ class FString
     FString (const UniChar&);        // implicit conversion constructor
     FString (const wchar_t);         // implicit conversion constructor
     FString (const char);            // implicit conversion constructor
+    explicit FString (const FStringView&);
 
     // Destructor
     virtual ~FString ();
@@ -235,6 +238,8 @@ class FString
 
     // inquiries
     auto isEmpty() const noexcept -> bool;
+    auto startsWith (const FStringView&) const -> bool;
+    auto endsWith (const FStringView&) const -> bool;
 
     // Methods
     auto getLength() const noexcept -> std::size_t;
@@ -283,6 +288,7 @@ class FString
     auto mid (std::size_t, std::size_t) const -> FString;
 
     auto split (const FString&) const -> FStringList;
+    auto tokenize (const FStringView&) const -> FStringTokenizer;
     auto setString (const FString&) -> FString&;
 
     template <typename NumT>
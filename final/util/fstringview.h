@@ -0,0 +1,559 @@
+/***********************************************************************
+* fstringview.h - Non-owning read-only view of a wide string           *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏       ▕▔▔▔▔▔▔▔▔▔▏
+ * ▕ FStringView ▏- - - -▕ FString ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▏
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FStringTokenizer ▏- - - -▕ FStringView ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FSTRINGVIEW_H
+#define FSTRINGVIEW_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cwchar>
+#include <cwctype>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FStringView
+//----------------------------------------------------------------------
+
+class FStringView
+{
+  public:
+    // Using-declarations
+    using const_iterator  = const wchar_t*;
+    using const_reference = const wchar_t&;
+    using size_type       = std::size_t;
+
+    // Constants
+    static constexpr auto npos = static_cast<std::size_t>(-1);
+
+    // Constructors
+    constexpr FStringView () noexcept = default;
+    constexpr FStringView (const wchar_t*, std::size_t) noexcept;
+    FStringView (const wchar_t[]) noexcept;         // implicit conversion constructor
+    FStringView (const std::wstring&) noexcept;     // implicit conversion constructor
+    FStringView (const FString&) noexcept;          // implicit conversion constructor
+
+    // Overloaded operator
+    template <typename IndexT>
+    auto operator [] (const IndexT) const -> const_reference;
+
+    // Accessor
+    auto getClassName() const -> FString;
+
+    // Inquiries
+    constexpr auto isEmpty() const noexcept -> bool;
+    auto startsWith (FStringView) const noexcept -> bool;
+    auto endsWith (FStringView) const noexcept -> bool;
+    auto includes (FStringView) const noexcept -> bool;
+
+    // Methods
+    constexpr auto getLength() const noexcept -> std::size_t;
+    constexpr auto data() const noexcept -> const wchar_t*;
+    constexpr auto begin() const noexcept -> const_iterator;
+    constexpr auto end() const noexcept -> const_iterator;
+    constexpr auto cbegin() const noexcept -> const_iterator;
+    constexpr auto cend() const noexcept -> const_iterator;
+    auto front() const -> const_reference;
+    auto back() const -> const_reference;
+
+    auto toFString() const -> FString;
+    auto toWString() const -> std::wstring;
+
+    auto ltrim() const noexcept -> FStringView;
+    auto rtrim() const noexcept -> FStringView;
+    auto trim() const noexcept -> FStringView;
+
+    auto left (std::size_t) const noexcept -> FStringView;
+    auto right (std::size_t) const noexcept -> FStringView;
+    auto mid (std::size_t, std::size_t) const noexcept -> FStringView;
+
+    auto find (wchar_t, std::size_t = 0) const noexcept -> std::size_t;
+    auto find (FStringView, std::size_t = 0) const noexcept -> std::size_t;
+    auto compare (FStringView) const noexcept -> int;
+    auto caseCompare (FStringView) const noexcept -> int;
+    auto caseStartsWith (FStringView) const noexcept -> bool;
+
+  private:
+    // Data members
+    const wchar_t* str{L""};
+    std::size_t    length{0};
+};
+
+
+//----------------------------------------------------------------------
+// class FStringTokenizer
+//----------------------------------------------------------------------
+
+class FStringTokenizer
+{
+  public:
+    // Forward declaration
+    class const_iterator;
+
+    // Constructor
+    FStringTokenizer (FStringView, FStringView) noexcept;
+
+    // Accessor
+    auto getClassName() const -> FString;
+
+    // Methods
+    auto begin() const noexcept -> const_iterator;
+    auto end() const noexcept -> const_iterator;
+
+  private:
+    // Data members
+    FStringView string{};
+    FStringView delimiter{};
+};
+
+
+//----------------------------------------------------------------------
+// class FStringTokenizer::const_iterator
+//----------------------------------------------------------------------
+
+class FStringTokenizer::const_iterator
+{
+  public:
+    // Using-declarations
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = FStringView;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const FStringView*;
+    using reference         = const FStringView&;
+
+    // Constructors
+    const_iterator() noexcept = default;
+    const_iterator (FStringView, FStringView) noexcept;
+
+    // Overloaded operators
+    auto operator * () const noexcept -> reference;
+    auto operator -> () const noexcept -> pointer;
+    auto operator ++ () noexcept -> const_iterator&;
+    auto operator ++ (int) noexcept -> const_iterator;
+    auto operator == (const const_iterator&) const noexcept -> bool;
+    auto operator != (const const_iterator&) const noexcept -> bool;
+
+  private:
+    // Method
+    void nextToken() noexcept;
+
+    // Data members
+    FStringView  string{};
+    FStringView  delimiter{};
+    FStringView  token{};
+    std::size_t  next_pos{0};
+    bool         at_end{true};
+};
+
+
+// FStringView inline functions
+//----------------------------------------------------------------------
+constexpr FStringView::FStringView (const wchar_t* s, std::size_t len) noexcept
+  : str{s ? s : L""}
+  , length{s ? len : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const wchar_t s[]) noexcept
+  : str{s ? s : L""}
+  , length{s ? std::wcslen(s) : 0}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const std::wstring& s) noexcept
+  : str{s.data()}
+  , length{s.length()}
+{ }
+
+//----------------------------------------------------------------------
+inline FStringView::FStringView (const FString& s) noexcept
+  : str{s.wc_str()}
+  , length{s.getLength()}
+{ }
+
+//----------------------------------------------------------------------
+template <typename IndexT>
+inline auto FStringView::operator [] (const IndexT pos) const -> const_reference
+{
+  if ( isNegative(pos) || std::size_t(pos) >= length )
+    throw std::out_of_range("");  // Invalid index position
+
+  return str[std::size_t(pos)];
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::getClassName() const -> FString
+{ return "FStringView"; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::isEmpty() const noexcept -> bool
+{ return length == 0; }
+
+//----------------------------------------------------------------------
+inline auto FStringView::startsWith (FStringView s) const noexcept -> bool
+{
+  return s.length <= length
+      && std::equal(s.cbegin(), s.cend(), cbegin());
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::endsWith (FStringView s) const noexcept -> bool
+{
+  return s.length <= length
+      && std::equal(s.cbegin(), s.cend(), cend() - s.length);
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::includes (FStringView s) const noexcept -> bool
+{
+  if ( s.isEmpty() )
+    return false;
+
+  return find(s) != npos;
+}
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::getLength() const noexcept -> std::size_t
+{ return length; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::data() const noexcept -> const wchar_t*
+{ return str; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::begin() const noexcept -> const_iterator
+{ return str; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::end() const noexcept -> const_iterator
+{ return str + length; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::cbegin() const noexcept -> const_iterator
+{ return str; }
+
+//----------------------------------------------------------------------
+constexpr auto FStringView::cend() const noexcept -> const_iterator
+{ return str + length; }
+
+//----------------------------------------------------------------------
+inline auto FStringView::front() const -> const_reference
+{
+  assert ( ! isEmpty() );
+  return str[0];
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::back() const -> const_reference
+{
+  assert ( ! isEmpty() );
+  return str[length - 1];
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::toFString() const -> FString
+{ return FString{toWString()}; }
+
+//----------------------------------------------------------------------
+inline auto FStringView::toWString() const -> std::wstring
+{ return {str, length}; }
+
+//----------------------------------------------------------------------
+inline auto FStringView::ltrim() const noexcept -> FStringView
+{
+  auto iter = cbegin();
+
+  while ( iter != cend() && std::iswspace(std::wint_t(*iter)) )
+    ++iter;
+
+  return { iter, std::size_t(cend() - iter) };
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::rtrim() const noexcept -> FStringView
+{
+  auto last = cend();
+
+  while ( last != cbegin() && std::iswspace(std::wint_t(*(last - 1))) )
+    --last;
+
+  return { str, std::size_t(last - cbegin()) };
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::trim() const noexcept -> FStringView
+{ return ltrim().rtrim(); }
+
+//----------------------------------------------------------------------
+inline auto FStringView::left (std::size_t len) const noexcept -> FStringView
+{
+  // Same semantics as FString::left()
+  return { str, std::min(len, length) };
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::right (std::size_t len) const noexcept -> FStringView
+{
+  // Same semantics as FString::right()
+  if ( len > length )
+    return *this;
+
+  return { str + length - len, len };
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::mid (std::size_t pos, std::size_t len) const noexcept -> FStringView
+{
+  // Same semantics as FString::mid() (the first character has pos 1)
+
+  if ( pos == 0 )
+    pos = 1;
+
+  if ( pos > length || len == 0 )
+    return {};
+
+  len = std::min(len, length - pos + 1);
+  return { str + pos - 1, len };
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::find (wchar_t c, std::size_t pos) const noexcept -> std::size_t
+{
+  if ( pos >= length )
+    return npos;
+
+  const auto iter = std::find(cbegin() + pos, cend(), c);
+  return iter == cend() ? npos : std::size_t(iter - cbegin());
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::find (FStringView s, std::size_t pos) const noexcept -> std::size_t
+{
+  if ( pos > length || s.length > length - pos )
+    return npos;
+
+  const auto iter = std::search(cbegin() + pos, cend(), s.cbegin(), s.cend());
+  return iter == cend() && ! s.isEmpty() ? npos : std::size_t(iter - cbegin());
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::compare (FStringView s) const noexcept -> int
+{
+  const auto len = std::min(length, s.length);
+  const int cmp = len > 0 ? std::wmemcmp(str, s.str, len) : 0;
+
+  if ( cmp != 0 )
+    return cmp;
+
+  if ( length == s.length )
+    return 0;
+
+  return length < s.length ? -1 : 1;
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::caseCompare (FStringView s) const noexcept -> int
+{
+  // Case-insensitive compare without allocating lowercase copies
+
+  auto iter1 = cbegin();
+  auto iter2 = s.cbegin();
+
+  while ( iter1 != cend() && iter2 != s.cend() )
+  {
+    const int cmp = int(std::towlower(std::wint_t(*iter1)))
+                  - int(std::towlower(std::wint_t(*iter2)));
+
+    if ( cmp != 0 )
+      return cmp;
+
+    ++iter1;
+    ++iter2;
+  }
+
+  if ( iter1 != cend() )
+    return int(std::towlower(std::wint_t(*iter1)));
+
+  if ( iter2 != s.cend() )
+    return -int(std::towlower(std::wint_t(*iter2)));
+
+  return 0;
+}
+
+//----------------------------------------------------------------------
+inline auto FStringView::caseStartsWith (FStringView prefix) const noexcept -> bool
+{
+  if ( prefix.length > length )
+    return false;
+
+  auto is_equal = [] (wchar_t c1, wchar_t c2)
+  {
+    return std::towlower(std::wint_t(c1)) == std::towlower(std::wint_t(c2));
+  };
+
+  return std::equal(prefix.cbegin(), prefix.cend(), cbegin(), is_equal);
+}
+
+//----------------------------------------------------------------------
+inline auto operator == (FStringView lhs, FStringView rhs) noexcept -> bool
+{
+  return lhs.getLength() == rhs.getLength()
+      && lhs.compare(rhs) == 0;
+}
+
+//----------------------------------------------------------------------
+inline auto operator != (FStringView lhs, FStringView rhs) noexcept -> bool
+{ return ! (lhs == rhs); }
+
+//----------------------------------------------------------------------
+inline auto operator < (FStringView lhs, FStringView rhs) noexcept -> bool
+{ return lhs.compare(rhs) < 0; }
+
+//----------------------------------------------------------------------
+inline auto operator > (FStringView lhs, FStringView rhs) noexcept -> bool
+{ return lhs.compare(rhs) > 0; }
+
+
+// FStringTokenizer inline functions
+//----------------------------------------------------------------------
+inline FStringTokenizer::FStringTokenizer ( FStringView s
+                                          , FStringView delim ) noexcept
+  : string{s}
+  , delimiter{delim}
+{ }
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::getClassName() const -> FString
+{ return "FStringTokenizer"; }
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::begin() const noexcept -> const_iterator
+{
+  // Same token semantics as FString::split()
+  if ( string.isEmpty() )
+    return {};
+
+  return {string, delimiter};
+}
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::end() const noexcept -> const_iterator
+{ return {}; }
+
+
+// FStringTokenizer::const_iterator inline functions
+//----------------------------------------------------------------------
+inline FStringTokenizer::const_iterator::const_iterator ( FStringView s
+                                                        , FStringView delim ) noexcept
+  : string{s}
+  , delimiter{delim}
+  , at_end{false}
+{
+  nextToken();
+}
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator * () const noexcept -> reference
+{ return token; }
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator -> () const noexcept -> pointer
+{ return &token; }
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator ++ () noexcept -> const_iterator&
+{
+  nextToken();
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator ++ (int) noexcept -> const_iterator
+{
+  const_iterator tmp = *this;
+  nextToken();
+  return tmp;
+}
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator == (const const_iterator& rhs) const noexcept -> bool
+{
+  if ( at_end || rhs.at_end )
+    return at_end == rhs.at_end;
+
+  return token.data() == rhs.token.data()
+      && token.getLength() == rhs.token.getLength();
+}
+
+//----------------------------------------------------------------------
+inline auto FStringTokenizer::const_iterator::operator != (const const_iterator& rhs) const noexcept -> bool
+{ return ! (*this == rhs); }
+
+//----------------------------------------------------------------------
+inline void FStringTokenizer::const_iterator::nextToken() noexcept
+{
+  if ( next_pos > string.getLength() )  // Past the last token
+  {
+    at_end = true;
+    return;
+  }
+
+  const auto pos = delimiter.isEmpty()
+                 ? FStringView::npos
+                 : string.find(delimiter, next_pos);
+
+  if ( pos == FStringView::npos )
+  {
+    token = { string.data() + next_pos, string.getLength() - next_pos };
+    next_pos = string.getLength() + 1;
+    return;
+  }
+
+  token = { string.data() + next_pos, pos - next_pos };
+  next_pos = pos + delimiter.getLength();
+}
+
+}  // namespace finalcut
+
+#endif  // FSTRINGVIEW_H
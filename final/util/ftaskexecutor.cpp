@@ -0,0 +1,219 @@
+/***********************************************************************
+* ftaskexecutor.cpp - Work-stealing thread pool for background tasks   *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+#include "final/util/ftaskexecutor.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+// The executor and queue index of the current worker thread
+thread_local const FTaskExecutor* current_executor{nullptr};
+thread_local std::size_t current_worker{0};
+
+}  // namespace internal
+
+//----------------------------------------------------------------------
+// class FTaskExecutor::WorkQueue
+//----------------------------------------------------------------------
+
+class FTaskExecutor::WorkQueue
+{
+  public:
+    // Methods
+    void push (FTask&& task)
+    {
+      std::lock_guard<std::mutex> lock_guard(mutex);
+      tasks.emplace_back(std::move(task));
+    }
+
+    auto popBack (FTask& task) -> bool
+    {
+      // The owning worker takes its newest task
+      std::lock_guard<std::mutex> lock_guard(mutex);
+
+      if ( tasks.empty() )
+        return false;
+
+      task = std::move(tasks.back());
+      tasks.pop_back();
+      return true;
+    }
+
+    auto popFront (FTask& task) -> bool
+    {
+      // Other workers steal the oldest task
+      std::lock_guard<std::mutex> lock_guard(mutex);
+
+      if ( tasks.empty() )
+        return false;
+
+      task = std::move(tasks.front());
+      tasks.pop_front();
+      return true;
+    }
+
+  private:
+    // Data members
+    std::deque<FTask>  tasks{};
+    std::mutex         mutex{};
+};
+
+
+//----------------------------------------------------------------------
+// class FTaskExecutor
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FTaskExecutor::FTaskExecutor (std::size_t threads)
+{
+  if ( threads == 0 )
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  queues.reserve(threads);
+  workers.reserve(threads);
+
+  for (std::size_t i{0}; i < threads; i++)
+    queues.emplace_back(std::make_unique<WorkQueue>());
+
+  for (std::size_t i{0}; i < threads; i++)
+    workers.emplace_back([this, i] () { workerLoop(i); });
+}
+
+//----------------------------------------------------------------------
+FTaskExecutor::~FTaskExecutor() noexcept  // destructor
+{
+  // Running tasks are completed, waiting tasks are discarded
+  {
+    std::lock_guard<std::mutex> lock_guard(wakeup_mutex);
+    running = false;
+  }
+
+  wakeup_cv.notify_all();
+  idle_cv.notify_all();
+
+  for (auto&& worker : workers)
+    if ( worker.joinable() )
+      worker.join();
+}
+
+
+// public methods of FTaskExecutor
+//----------------------------------------------------------------------
+void FTaskExecutor::submit (FTask&& task)
+{
+  // Can be called from any thread, also from a running task
+
+  if ( ! task )
+    return;
+
+  // The counters are raised before the push, because another
+  // worker can take and finish the task right after the push
+  const auto index = getCurrentWorker();
+  ++unfinished;
+
+  {
+    std::lock_guard<std::mutex> lock_guard(wakeup_mutex);
+    ++queued;
+  }
+
+  queues[index]->push(std::move(task));
+  wakeup_cv.notify_one();
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutor::waitUntilIdle()
+{
+  // Blocks until all submitted tasks are finished
+  // (must not be called from a task)
+
+  std::unique_lock<std::mutex> lock(wakeup_mutex);
+  idle_cv.wait (lock, [this] () { return unfinished == 0 || ! running; });
+}
+
+
+// private methods of FTaskExecutor
+//----------------------------------------------------------------------
+auto FTaskExecutor::getCurrentWorker() noexcept -> std::size_t
+{
+  // A worker thread puts new tasks into its own queue
+  if ( internal::current_executor == this )
+    return internal::current_worker;
+
+  return next_queue++ % queues.size();
+}
+
+//----------------------------------------------------------------------
+auto FTaskExecutor::takeTask (std::size_t index, FTask& task) -> bool
+{
+  const auto count = queues.size();
+  bool found = queues[index]->popBack(task);
+
+  for (std::size_t i{1}; ! found && i < count; i++)
+    found = queues[(index + i) % count]->popFront(task);
+
+  if ( found )
+    --queued;
+
+  return found;
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutor::workerLoop (std::size_t index)
+{
+  internal::current_executor = this;
+  internal::current_worker = index;
+  FTask task{};
+
+  while ( running )
+  {
+    if ( takeTask(index, task) )
+    {
+      task();
+      task = nullptr;  // Destroys the captured objects in this thread
+      taskFinished();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(wakeup_mutex);
+    wakeup_cv.wait (lock, [this] () { return queued > 0 || ! running; });
+  }
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutor::taskFinished()
+{
+  if ( --unfinished > 0 )
+    return;
+
+  std::lock_guard<std::mutex> lock_guard(wakeup_mutex);
+  idle_cv.notify_all();
+}
+
+}  // namespace finalcut
@@ -0,0 +1,130 @@
+/***********************************************************************
+* ftaskexecutor.h - Work-stealing thread pool for background tasks     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTaskExecutor ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// Every worker thread has its own task queue. A worker takes its
+// newest task first and steals the oldest task of another worker
+// when its own queue is empty. Tasks submitted by a worker thread
+// go into its own queue, tasks from other threads are distributed
+// round-robin. FApplication::runAsync() uses an executor to run
+// work off the UI thread.
+
+#ifndef FTASKEXECUTOR_H
+#define FTASKEXECUTOR_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "final/ftypes.h"
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTaskExecutor
+//----------------------------------------------------------------------
+
+class FTaskExecutor final
+{
+  public:
+    // Using-declaration
+    using FTask = std::function<void()>;
+
+    // Constructor
+    explicit FTaskExecutor (std::size_t = 0);  // 0 = number of CPU cores
+
+    // Disable copy constructor
+    FTaskExecutor (const FTaskExecutor&) = delete;
+
+    // Destructor
+    ~FTaskExecutor() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FTaskExecutor&) -> FTaskExecutor& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getThreadCount() const noexcept -> std::size_t;
+    auto getPendingCount() const noexcept -> std::size_t;
+
+    // Methods
+    void submit (FTask&&);
+    void waitUntilIdle();
+
+  private:
+    // Forward declaration
+    class WorkQueue;
+
+    // Using-declaration
+    using WorkQueuePtr = std::unique_ptr<WorkQueue>;
+
+    // Methods
+    auto getCurrentWorker() noexcept -> std::size_t;
+    auto takeTask (std::size_t, FTask&) -> bool;
+    void workerLoop (std::size_t);
+    void taskFinished();
+
+    // Data members
+    std::vector<WorkQueuePtr>  queues{};
+    std::vector<std::thread>   workers{};
+    std::atomic<std::size_t>   next_queue{0};
+    std::atomic<std::size_t>   queued{0};    // Waiting tasks
+    std::atomic<std::size_t>   unfinished{0};
+    std::atomic<bool>          running{true};
+    std::mutex                 wakeup_mutex{};
+    std::condition_variable    wakeup_cv{};
+    std::condition_variable    idle_cv{};
+};
+
+// FTaskExecutor inline functions
+//----------------------------------------------------------------------
+inline auto FTaskExecutor::getClassName() const -> FString
+{ return "FTaskExecutor"; }
+
+//----------------------------------------------------------------------
+inline auto FTaskExecutor::getThreadCount() const noexcept -> std::size_t
+{ return workers.size(); }
+
+//----------------------------------------------------------------------
+inline auto FTaskExecutor::getPendingCount() const noexcept -> std::size_t
+{ return unfinished; }
+
+}  // namespace finalcut
+
+#endif  // FTASKEXECUTOR_H
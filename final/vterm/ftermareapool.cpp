@@ -0,0 +1,164 @@
+/***********************************************************************
+* ftermareapool.cpp - Recycles the buffers of virtual windows          *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+#include <algorithm>
+
+#include "final/vterm/ftermareapool.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+//----------------------------------------------------------------------
+inline auto getCapacity (const FTermAreaPool::FTermAreaPtr& area) noexcept -> std::size_t
+{
+  return area->data.capacity();
+}
+
+}  // namespace internal
+
+//----------------------------------------------------------------------
+// class FTermAreaPool
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FTermAreaPool::FTermAreaPool()
+{
+  areas.reserve(MAX_AREAS);  // Insertions do not reallocate
+}
+
+
+// public methods of FTermAreaPool
+//----------------------------------------------------------------------
+auto FTermAreaPool::getInstance() -> FTermAreaPool&
+{
+  static const auto& area_pool = std::make_unique<FTermAreaPool>();
+  return *area_pool;
+}
+
+//----------------------------------------------------------------------
+void FTermAreaPool::reserve (std::size_t count, const FSize& size)
+{
+  // Pre-allocates areas for windows up to the given size
+  // (including the shadow), e.g. at program start. Areas are
+  // added until the pool holds count areas in total.
+
+  count = std::min(count, MAX_AREAS);
+
+  while ( areas.size() < count )
+  {
+    auto area = std::make_unique<FTermArea>();
+    area->data.reserve(size.getArea());
+    area->changes.reserve(size.getHeight());
+    area->setOwner<FVTerm*>(nullptr);  // Owner data object for reuse
+    insert (std::move(area));
+  }
+}
+
+//----------------------------------------------------------------------
+auto FTermAreaPool::acquire (std::size_t cell_count) -> FTermAreaPtr
+{
+  // Returns the area with the smallest buffer for cell_count
+  // characters, or the largest area if none is big enough
+
+  if ( areas.empty() )
+    return {};
+
+  auto iter = std::lower_bound ( areas.begin(), areas.end(), cell_count
+                               , [] (const FTermAreaPtr& area, std::size_t cells)
+                                 {
+                                   return internal::getCapacity(area) < cells;
+                                 } );
+
+  if ( iter == areas.end() )
+    --iter;
+
+  auto area = std::move(*iter);
+  areas.erase(iter);
+  return area;
+}
+
+//----------------------------------------------------------------------
+void FTermAreaPool::release (FTermAreaPtr&& area)
+{
+  // Takes over the area of a closed window
+
+  if ( ! area || area->tiled )
+    return;  // Tiled areas release their memory anyway
+
+  if ( areas.size() >= MAX_AREAS )
+  {
+    // Keep the larger buffers
+    if ( internal::getCapacity(area) <= internal::getCapacity(areas.front()) )
+      return;
+
+    areas.erase(areas.begin());
+  }
+
+  resetArea (area.get());
+  insert (std::move(area));
+}
+
+
+// private methods of FTermAreaPool
+//----------------------------------------------------------------------
+void FTermAreaPool::resetArea (FTermArea* area) noexcept
+{
+  // Resets everything except the memory of the buffers and the owner
+  // data object, which can be reassigned without a new allocation
+
+  area->position = {0, 0};
+  area->size = {-1, -1};
+  area->shadow = {0, 0};
+  area->min_size = {-1, -1};
+  area->cursor = {0, 0};
+  area->input_cursor = {-1, -1};
+  area->layer = -1;
+  area->encoding = Encoding::Unknown;
+  area->input_cursor_visible = false;
+  area->has_changes = false;
+  area->visible = false;
+  area->minimized = false;
+  area->preproc_list.clear();
+  area->changes.clear();
+  area->data.clear();
+}
+
+//----------------------------------------------------------------------
+void FTermAreaPool::insert (FTermAreaPtr&& area)
+{
+  // Keeps the areas sorted by their buffer capacity
+
+  auto iter = std::upper_bound ( areas.begin(), areas.end(), area
+                               , [] (const FTermAreaPtr& lhs, const FTermAreaPtr& rhs)
+                                 {
+                                   return internal::getCapacity(lhs)
+                                        < internal::getCapacity(rhs);
+                                 } );
+  areas.insert (iter, std::move(area));
+}
+
+}  // namespace finalcut
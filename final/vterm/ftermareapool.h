@@ -0,0 +1,119 @@
+/***********************************************************************
+* ftermareapool.h - Recycles the buffers of virtual windows            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTermAreaPool ▏- - - -▕ FTermArea ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// The pool keeps the term areas of closed virtual windows together
+// with their character buffers. Short-lived windows like menus,
+// tooltips, drop-down lists or message boxes thereby get an already
+// allocated buffer when they are opened again. The areas are sorted
+// by their buffer capacity, and an area request gets the smallest
+// buffer into which the requested size fits. FVTerm reserves a few
+// areas at startup for the first tooltips and menus. The count of
+// reserve() is the total number of areas in the pool, so only the
+// missing areas are added.
+// Not thread-safe - use it only in the main thread.
+
+#ifndef FTERMAREAPOOL_H
+#define FTERMAREAPOOL_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <memory>
+#include <vector>
+
+#include "final/util/fsize.h"
+#include "final/util/fstring.h"
+#include "final/vterm/fvterm.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FTermAreaPool
+//----------------------------------------------------------------------
+
+class FTermAreaPool final
+{
+  public:
+    // Using-declarations
+    using FTermArea = FVTerm::FTermArea;
+    using FTermAreaPtr = std::unique_ptr<FTermArea>;
+
+    // Constants
+    static constexpr std::size_t MAX_AREAS = 16;
+
+    // Constructor
+    FTermAreaPool();
+
+    // Accessors
+    auto getClassName() const -> FString;
+    static auto getInstance() -> FTermAreaPool&;
+    auto getAreaCount() const noexcept -> std::size_t;
+
+    // Inquiry
+    auto isEmpty() const noexcept -> bool;
+
+    // Methods
+    void reserve (std::size_t, const FSize&);
+    auto acquire (std::size_t) -> FTermAreaPtr;
+    void release (FTermAreaPtr&&);
+    void clear() noexcept;
+
+  private:
+    // Methods
+    static void resetArea (FTermArea*) noexcept;
+    void insert (FTermAreaPtr&&);
+
+    // Data member
+    std::vector<FTermAreaPtr>  areas{};
+};
+
+// FTermAreaPool inline functions
+//----------------------------------------------------------------------
+inline auto FTermAreaPool::getClassName() const -> FString
+{ return "FTermAreaPool"; }
+
+//----------------------------------------------------------------------
+inline auto FTermAreaPool::getAreaCount() const noexcept -> std::size_t
+{ return areas.size(); }
+
+//----------------------------------------------------------------------
+inline auto FTermAreaPool::isEmpty() const noexcept -> bool
+{ return areas.empty(); }
+
+//----------------------------------------------------------------------
+inline void FTermAreaPool::clear() noexcept
+{ areas.clear(); }
+
+}  // namespace finalcut
+
+#endif  // FTERMAREAPOOL_H
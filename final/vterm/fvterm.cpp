@@ -20,22 +20,27 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
+#include <memory>
 #include <numeric>
 #include <string>
-#include <unordered_set>
+#include <thread>
 #include <vector>
 
 #include "final/fapplication.h"
 #include "final/fc.h"
 #include "final/ftypes.h"
 #include "final/output/tty/ftermoutput.h"
+#include "final/util/fframeprofiler.h"
 #include "final/util/flog.h"
 #include "final/util/fpoint.h"
 #include "final/util/frect.h"
 #include "final/util/fsize.h"
 #include "final/util/fsystem.h"
+#include "final/util/ftaskexecutor.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fstyle.h"
+#include "final/vterm/ftermareapool.h"
 #include "final/vterm/fvterm.h"
 
 namespace finalcut
@@ -48,10 +53,12 @@ struct var
 {
   static bool  fvterm_initialized;  // Global init state
   static uInt8 b1_transparent_mask;
+  static std::unique_ptr<FTaskExecutor> compositing_executor;
 };
 
 bool  var::fvterm_initialized{false};
 uInt8 var::b1_transparent_mask{};
+std::unique_ptr<FTaskExecutor> var::compositing_executor{};
 
 }  // namespace internal
 
@@ -64,26 +71,61 @@ FVTerm::FTermArea*   FVTerm::active_area{nullptr};
 uInt8                FVTerm::b1_print_trans_mask{};
 int                  FVTerm::tabstop{8};
 
-using TransparentInvisibleLookupMap = std::unordered_set<wchar_t>;
+//----------------------------------------------------------------------
+template <typename T>
+static void resizeBuffer (std::vector<T>& buffer, std::size_t size)
+{
+  // The capacity grows geometrically and is kept when the buffer
+  // shrinks, so that resizing back and forth does not reallocate.
+  // The memory is only returned when less than a quarter is used.
+
+  const auto capacity = buffer.capacity();
+
+  if ( size > capacity )
+    buffer.reserve (std::max(size, capacity + capacity / 2));
+
+  buffer.resize(size);
+
+  if ( size < capacity / 4 )
+    buffer.shrink_to_fit();
+}
+
+//----------------------------------------------------------------------
+static inline auto getTransparencyBits (const FChar& fchar) noexcept -> uInt8
+{
+  return fchar.attr.byte[1] & internal::var::b1_transparent_mask;
+}
+
+//----------------------------------------------------------------------
+static inline auto getEqualTransparencyRunLength ( const FChar* begin
+                                                 , const FChar* end ) noexcept -> std::size_t
+{
+  // Number of characters at the beginning that have the
+  // same kind of transparency as the first character
+
+  const auto bits = getTransparencyBits(*begin);
+  auto iter = begin + 1;
+
+  while ( iter < end && getTransparencyBits(*iter) == bits )
+    ++iter;
+
+  return std::size_t(iter - begin);
+}
 
 //----------------------------------------------------------------------
-static auto getTransparentInvisibleLookupMap() -> TransparentInvisibleLookupMap
+static inline auto getTransparentRunLength ( const FChar* begin
+                                           , const FChar* end ) noexcept -> std::size_t
 {
-  // Encapsulate global unordered_map object
-  static const auto& trans_inv_lookup = std::make_unique<TransparentInvisibleLookupMap>
-  (
-    std::initializer_list<wchar_t>
-    ({
-      wchar_t(UniChar::LowerHalfBlock),
-      wchar_t(UniChar::UpperHalfBlock),
-      wchar_t(UniChar::LeftHalfBlock),
-      wchar_t(UniChar::RightHalfBlock),
-      wchar_t(UniChar::MediumShade),
-      wchar_t(UniChar::FullBlock)
-    })
-  );
+  // Number of characters at the beginning that are either
+  // all (partially) transparent or all non-transparent
+
+  const bool is_transparent = getTransparencyBits(*begin) != 0;
+  auto iter = begin + 1;
 
-  return *trans_inv_lookup;
+  while ( iter < end && (getTransparencyBits(*iter) != 0) == is_transparent )
+    ++iter;
+
+  return std::size_t(iter - begin);
 }
 
 //----------------------------------------------------------------------
@@ -100,6 +142,9 @@ FVTerm::FVTerm()
 //----------------------------------------------------------------------
 FVTerm::~FVTerm()  // destructor
 {
+  if ( vwin )  // Keep the window buffers for the next window
+    FTermAreaPool::getInstance().release(std::move(vwin));
+
   if ( getGlobalFVTermInstance() == this )
     finish();
 }
@@ -173,6 +218,30 @@ void FVTerm::setNonBlockingRead (bool enable)
   init_object->foutput->setNonBlockingRead (enable);
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::getCompositingThreads() -> std::size_t
+{
+  const auto& executor = internal::var::compositing_executor;
+  return executor ? executor->getThreadCount() + 1 : 1;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::setCompositingThreads (std::size_t threads)
+{
+  // Number of threads that composite the layers of large terminals
+  // (1 = single-threaded, 0 = one thread per CPU core)
+
+  if ( threads == 0 )
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  auto& executor = internal::var::compositing_executor;
+
+  if ( threads < 2 )
+    executor.reset();
+  else if ( ! executor || executor->getThreadCount() != threads - 1 )
+    executor = std::make_unique<FTaskExecutor>(threads - 1);
+}
+
 //----------------------------------------------------------------------
 void FVTerm::clearArea (wchar_t fillchar)
 {
@@ -353,8 +422,8 @@ auto FVTerm::print (const FString& string) noexcept -> int
   if ( string.isEmpty() )
     return 0;
 
-  vterm_buffer.print(string);
-  return print (vterm_buffer);
+  auto area = getPrintArea();
+  return area ? print (area, string) : -1;
 }
 
 //----------------------------------------------------------------------
@@ -363,8 +432,56 @@ auto FVTerm::print (FTermArea* area, const FString& string) noexcept -> int
   if ( ! area || string.isEmpty() )
     return -1;
 
-  vterm_buffer.print(string);
-  return print (area, vterm_buffer);
+  // Runs of printable ASCII characters are written directly into
+  // the area. All other characters (control codes, combining and
+  // full-width characters) are printed via the FVTermBuffer.
+
+  const auto is_ascii = [] (wchar_t ch)
+  {
+    return ch >= L' ' && ch < L'\x7f';
+  };
+
+  const auto end = string.cend();
+  auto iter = string.cbegin();
+  int len{0};
+
+  while ( iter != end )
+  {
+    auto run_end = std::find_if_not(iter, end, is_ascii);
+
+    // A following zero-width character belongs to the last character
+    if ( run_end != end && run_end != iter )
+      --run_end;
+
+    if ( run_end != iter )
+    {
+      const auto run_length = run_end - iter;
+      const auto printed = printAsciiRun (area, iter, run_end);
+      len += printed;
+
+      if ( printed < run_length )
+        return len;  // End of area reached
+
+      iter = run_end;
+    }
+
+    if ( iter == end )
+      break;
+
+    // The other characters up to the next ASCII character
+    const auto other_end = std::find_if(iter + 1, end, is_ascii);
+    vterm_buffer.print(FString(std::wstring(iter, other_end)));
+    const auto size = int(vterm_buffer.getLength());
+    const auto printed = print (area, vterm_buffer);
+    len += std::max(printed, 0);
+
+    if ( printed < size )
+      return len;  // End of area reached
+
+    iter = other_end;
+  }
+
+  return len;
 }
 
 //----------------------------------------------------------------------
@@ -539,8 +656,20 @@ auto FVTerm::createArea (const FShadowBox& shadowbox) -> std::unique_ptr<FTermAr
 {
   // initialize virtual window
 
-  auto area = std::make_unique<FTermArea>();
-  area->setOwner<FVTerm*>(this);
+  const auto cell_count = ( shadowbox.box.getWidth()
+                          + shadowbox.shadow.getWidth() )
+                        * ( shadowbox.box.getHeight()
+                          + shadowbox.shadow.getHeight() );
+  auto area = FTermAreaPool::getInstance().acquire(cell_count);
+
+  if ( ! area )
+    area = std::make_unique<FTermArea>();
+
+  if ( area->hasOwner() )
+    area->getOwner<FVTerm*>() = this;  // Reuse the recycled owner data
+  else
+    area->setOwner<FVTerm*>(this);
+
   area->encoding = foutput->getEncoding();
   resizeArea (shadowbox, area.get());
   return area;
@@ -555,6 +684,20 @@ auto FVTerm::createArea (const FRect& box) -> std::unique_ptr<FTermArea>
   return createArea ({box, no_shadow});
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::createTiledArea (const FRect& box) -> std::unique_ptr<FTermArea>
+{
+  // initialize a virtual area whose lines are stored in tiles
+  // that are allocated on the first write access
+
+  auto area = std::make_unique<FTermArea>();
+  area->setOwner<FVTerm*>(this);
+  area->encoding = foutput->getEncoding();
+  area->tiled = true;
+  resizeArea (box, area.get());
+  return area;
+}
+
 //----------------------------------------------------------------------
 void FVTerm::resizeArea ( const FShadowBox& shadowbox
                         , FTermArea* area ) const
@@ -740,61 +883,10 @@ void FVTerm::addLayer (FTermArea* area) const noexcept
   if ( ! area || ! area->visible )
     return;
 
-  const int ax = std::max(area->position.x, 0);
-  const int ol = std::max(0, -area->position.x);  // Outside left
-  const int ay = area->position.y;
-  const int width = getFullAreaWidth(area);
-  const int height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
-  const int y_end = std::min(vterm->size.height - ay, height);
-
   // Call the preprocessing handler methods (child area change handling)
   callPreprocessingHandler(area);
 
-  for (auto y{0}; y < y_end; y++)  // Line loop
-  {
-    auto& line_changes = area->changes[unsigned(y)];
-    auto line_xmin = int(line_changes.xmin);
-    auto line_xmax = int(line_changes.xmax);
-    line_xmin = std::max(line_xmin, ol);
-    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
-
-    if ( line_xmin > line_xmax )
-      continue;
-
-    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
-    const int tx = ax - ol;  // Global terminal positions for x
-    const int ty = ay + y;  // Global terminal positions for y
-
-    if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
-      continue;
-
-    // Area character
-    const auto& ac = area->getFChar(line_xmin, y);
-
-    // Terminal character
-    auto& tc = vterm->getFChar(tx + line_xmin, ty);
-
-    if ( line_changes.trans_count > 0 )
-    {
-      // Line with hidden and transparent characters
-      addAreaLineWithTransparency (&ac, &tc, length);
-    }
-    else
-    {
-      // Line has only covered characters
-      putAreaLine (ac, tc, length);
-    }
-
-    int new_xmin = ax + line_xmin - ol;
-    int new_xmax = ax + line_xmax;
-    auto& vterm_changes = vterm->changes[unsigned(ty)];
-    vterm_changes.xmin = std::min(vterm_changes.xmin, uInt(new_xmin));
-    new_xmax = std::min(new_xmax, vterm->size.width - 1);
-    vterm_changes.xmax = std::max (vterm_changes.xmax, uInt(new_xmax));
-    line_changes.xmin = uInt(width);
-    line_changes.xmax = 0;
-  }
-
+  addLayerLines (area, 0, vterm->size.height);
   vterm->has_changes = true;
   updateVTermCursor(area);
 }
@@ -973,7 +1065,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
   nc.ch[1] = L'\0';
   nc.attr.bit.char_width = getColumnWidth(nc.ch[0]) & 0x03;
 
-  if ( ! area || area->data.empty() )
+  if ( ! area || (area->data.empty() && ! area->tiled) )
   {
     foutput->clearTerminal (fillchar);
     return;
@@ -1123,7 +1215,11 @@ inline void FVTerm::resetTextAreaToDefault ( FTermArea* area
     FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
   };
-  std::fill (area->data.begin(), area->data.end(), default_char);
+
+  if ( area->tiled )
+    area->resetTiles (default_char);
+  else
+    std::fill (area->data.begin(), area->data.end(), default_char);
 
   FLineChanges unchanged { uInt(size.getWidth()), 0, 0 };
   std::fill (area->changes.begin(), area->changes.end(), unchanged);
@@ -1137,7 +1233,7 @@ inline auto FVTerm::resizeTextArea ( FTermArea* area
   // Set the number of lines for changes to "height"
   // and resize the text area to "size" elements
 
-  area->changes.resize(height);
+  resizeBuffer (area->changes, height);
   resizeTextArea (area, size);
   return true;
 }
@@ -1147,7 +1243,9 @@ inline auto FVTerm::resizeTextArea (FTermArea* area, std::size_t size) const ->
 {
   // Resize text area to "size" FChar elements
 
-  area->data.resize(size);
+  if ( ! area->tiled )  // Tiles are allocated on demand
+    resizeBuffer (area->data, size);
+
   return true;
 }
 
@@ -1363,35 +1461,196 @@ void FVTerm::updateVTerm() const
 {
   // Updates the character data from all areas to VTerm
 
+  std::vector<FTermArea*> layers{};
+
   if ( hasPendingUpdates(vdesktop.get()) )
   {
-    addLayer(vdesktop.get());  // Add vdesktop changes to vterm
+    prepareLayer(vdesktop.get(), layers);  // Add vdesktop changes to vterm
     vdesktop->has_changes = false;
   }
 
-  if ( ! window_list || window_list->empty() )
+  if ( window_list )
+  {
+    for (auto&& window : *window_list)  // List from bottom to top
+    {
+      auto v_win = window->getVWin();
+
+      if ( ! (v_win && v_win->visible && v_win->layer > 0) )
+        continue;
+
+      if ( hasPendingUpdates(v_win) )
+      {
+        passChangesToOverlap(v_win);
+        prepareLayer(v_win, layers);  // Add v_win changes to vterm
+        v_win->has_changes = false;
+      }
+      else if ( hasChildAreaChanges(v_win) )
+      {
+        passChangesToOverlap(v_win);
+        prepareLayer(v_win, layers);  // and call the child area processing handler there
+        clearChildAreaChanges(v_win);
+      }
+    }
+  }
+
+  if ( layers.empty() )
     return;
 
-  for (auto&& window : *window_list)  // List from bottom to top
+  static auto& profiler = FFrameProfiler::getInstance();
+
+  if ( profiler.isRecording() )
   {
-    auto v_win = window->getVWin();
+    for (const auto& layer : layers)
+      profiler.addCells (getChangedCellCount(layer));
+  }
+
+  // Composite the line data of all layers (from bottom to top)
+  if ( ! addLayersInParallel(layers) )
+  {
+    for (const auto& layer : layers)
+      addLayerLines (layer, 0, vterm->size.height);
+  }
+
+  vterm->has_changes = true;
+
+  for (const auto& layer : layers)
+    updateVTermCursor(layer);
+}
 
-    if ( ! (v_win && v_win->visible && v_win->layer > 0) )
+//----------------------------------------------------------------------
+inline void FVTerm::prepareLayer ( FTermArea* area
+                                 , std::vector<FTermArea*>& layers ) const
+{
+  if ( ! area->visible )
+    return;
+
+  // Call the preprocessing handler methods (child area change handling)
+  callPreprocessingHandler(area);
+  layers.push_back(area);
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::addLayerLines ( FTermArea* area
+                                   , int y_begin, int y_end ) const noexcept
+{
+  // Transmits the changed area lines within the terminal lines
+  // y_begin to y_end - 1. Different terminal lines can be
+  // processed simultaneously in several threads.
+
+  const int ax = std::max(area->position.x, 0);
+  const int ol = std::max(0, -area->position.x);  // Outside left
+  const int ay = area->position.y;
+  const int width = getFullAreaWidth(area);
+  const int height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
+  const int y_first = std::max(0, y_begin - ay);
+  const int y_last = std::min({vterm->size.height - ay, height, y_end - ay});
+
+  for (auto y{y_first}; y < y_last; y++)  // Line loop
+  {
+    auto& line_changes = area->changes[unsigned(y)];
+    auto line_xmin = int(line_changes.xmin);
+    auto line_xmax = int(line_changes.xmax);
+    line_xmin = std::max(line_xmin, ol);
+    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
+
+    if ( line_xmin > line_xmax )
+      continue;
+
+    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
+    const int tx = ax - ol;  // Global terminal positions for x
+    const int ty = ay + y;  // Global terminal positions for y
+
+    if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
       continue;
 
-    if ( hasPendingUpdates(v_win) )
+    // Area character
+    const auto& ac = area->getFChar(line_xmin, y);
+
+    // Terminal character
+    auto& tc = vterm->getFChar(tx + line_xmin, ty);
+
+    if ( line_changes.trans_count > 0 )
     {
-      passChangesToOverlap(v_win);
-      addLayer(v_win);  // Add v_win changes to vterm
-      v_win->has_changes = false;
+      // Line with hidden and transparent characters
+      addAreaLineWithTransparency (&ac, &tc, length);
     }
-    else if ( hasChildAreaChanges(v_win) )
+    else
     {
-      passChangesToOverlap(v_win);
-      addLayer(v_win);  // and call the child area processing handler there
-      clearChildAreaChanges(v_win);
+      // Line has only covered characters
+      putAreaLine (ac, tc, length);
     }
+
+    int new_xmin = ax + line_xmin - ol;
+    int new_xmax = ax + line_xmax;
+    auto& vterm_changes = vterm->changes[unsigned(ty)];
+    vterm_changes.xmin = std::min(vterm_changes.xmin, uInt(new_xmin));
+    new_xmax = std::min(new_xmax, vterm->size.width - 1);
+    vterm_changes.xmax = std::max (vterm_changes.xmax, uInt(new_xmax));
+    line_changes.xmin = uInt(width);
+    line_changes.xmax = 0;
+  }
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::addLayersInParallel (const std::vector<FTermArea*>& layers) const -> bool
+{
+  // Splits the terminal into horizontal bands. Every band is composited
+  // from all layers in z-order, so the bands are independent of each other.
+
+  auto& executor = internal::var::compositing_executor;
+
+  if ( ! executor )
+    return false;
+
+  const int height = vterm->size.height;
+  std::size_t changed_cells{0};
+
+  for (const auto& layer : layers)
+    changed_cells += getChangedCellCount(layer);
+
+  if ( changed_cells < MIN_PARALLEL_COMPOSITING_CELLS )
+    return false;  // Not worth the synchronization
+
+  const auto threads = int(executor->getThreadCount()) + 1;
+  const int bands = std::min(threads, height / MIN_COMPOSITING_BAND_HEIGHT);
+
+  if ( bands < 2 )
+    return false;
+
+  const int band_height = (height + bands - 1) / bands;
+
+  for (auto band{1}; band < bands; band++)
+  {
+    const int y_begin = band * band_height;
+    const int y_end = std::min(height, y_begin + band_height);
+
+    executor->submit ( [this, &layers, y_begin, y_end] ()
+                       {
+                         for (const auto& layer : layers)
+                           addLayerLines (layer, y_begin, y_end);
+                       } );
   }
+
+  // The first band is composited in the current thread
+  for (const auto& layer : layers)
+    addLayerLines (layer, 0, std::min(height, band_height));
+
+  executor->waitUntilIdle();
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getChangedCellCount (const FTermArea* area) const noexcept -> std::size_t
+{
+  std::size_t count{0};
+  const int height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
+  const auto end = area->changes.cbegin() + std::min(height, int(area->changes.size()));
+
+  for (auto iter = area->changes.cbegin(); iter != end; ++iter)
+    if ( iter->xmin <= iter->xmax )
+      count += iter->xmax - iter->xmin + 1;
+
+  return count;
 }
 
 //----------------------------------------------------------------------
@@ -1510,9 +1769,19 @@ inline auto FVTerm::isFCharTransparent (const FChar& fchar) const -> bool
 //----------------------------------------------------------------------
 inline auto FVTerm::isTransparentInvisible (const FChar& fchar) const -> bool
 {
-  static const auto& trans_inv_chars = getTransparentInvisibleLookupMap();
-  const auto& fist_char = fchar.ch[0];
-  return trans_inv_chars.find(fist_char) != trans_inv_chars.end();
+  switch ( fchar.ch[0] )
+  {
+    case wchar_t(UniChar::LowerHalfBlock):
+    case wchar_t(UniChar::UpperHalfBlock):
+    case wchar_t(UniChar::LeftHalfBlock):
+    case wchar_t(UniChar::RightHalfBlock):
+    case wchar_t(UniChar::MediumShade):
+    case wchar_t(UniChar::FullBlock):
+      return true;
+
+    default:
+      return false;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1543,6 +1812,12 @@ void FVTerm::initSettings()
   createVDesktop (term_size);
   active_area = vdesktop.get();
 
+  // Pre-allocate window areas (including the shadow),
+  // so that the first tooltips and menus open without allocation
+  auto& area_pool = FTermAreaPool::getInstance();
+  area_pool.reserve (2, FSize{40, 5});   // 2 tooltips and small menus
+  area_pool.reserve (6, FSize{40, 20});  // 4 menus (6 areas in total)
+
   // fvterm is now initialized
   internal::var::fvterm_initialized = true;
 }
@@ -1554,6 +1829,7 @@ void FVTerm::finish() const
   setNormal();
   foutput->finishTerminal();
   forceTerminalUpdate();
+  internal::var::compositing_executor.reset();
   internal::var::fvterm_initialized = false;
   setGlobalFVTermInstance(nullptr);
 }
@@ -1581,50 +1857,22 @@ inline void FVTerm::putAreaLineWithTransparency ( const FChar* src_char
                                                 , const int length
                                                 , FPoint pos ) const
 {
-  const int end_char = pos.getX() + length;
-  const FChar* start_char{nullptr};
-  std::size_t trans_count{0};
-  std::size_t non_trans_count{0};
-
   // Line has one or more transparent characters
-  while ( pos.getX() < end_char )  // column loop
-  {
-    const auto is_transparent = isFCharTransparent(*src_char);
 
-    if ( is_transparent )
-    {
-      putNonTransparent(non_trans_count, start_char, dst_char);
+  const auto end_char = src_char + length;
 
-      if ( trans_count == 0 )
-        start_char = src_char;
+  while ( src_char < end_char )  // run loop
+  {
+    const auto run_length = getTransparentRunLength(src_char, end_char);
+    pos.x_ref() += int(run_length);
 
-      trans_count++;
-    }
+    if ( getTransparencyBits(*src_char) != 0 )
+      putTransparentAreaLine (pos, run_length);
     else
-    {
-      putTransparent(trans_count, pos, dst_char);
-
-      if ( non_trans_count == 0 )
-        start_char = src_char;
-
-      non_trans_count++;
-    }
-
-    pos.x_ref()++;
+      putAreaLine (*src_char, *dst_char, run_length);
 
-    if ( pos.getX() == end_char )
-    {
-      if ( trans_count != 0 )
-      {
-        putTransparentAreaLine (pos, trans_count);
-      }
-      else if ( non_trans_count != 0 )
-        putAreaLine (*start_char, *dst_char, non_trans_count);
-
-      break;
-    }
-
-    ++src_char;  // src character
+    src_char += run_length;
+    dst_char += run_length;
   }
 }
 
@@ -1641,46 +1889,17 @@ inline void FVTerm::addAreaLineWithTransparency ( const FChar* src_char
                                                 , FChar* dst_char
                                                 , const std::size_t length ) const
 {
+  // Splits the line into runs of characters with the same
+  // kind of transparency and adds each run as a whole
+
   const auto end_char = src_char + length;
-  const auto last_char = end_char - 1;
-  const FChar* start_char{nullptr};
-  std::size_t trans_count{0};
-  std::size_t non_trans_count{0};
 
-  while ( src_char < end_char )  // column loop
+  while ( src_char < end_char )  // run loop
   {
-    const auto is_transparent = isFCharTransparent(*src_char);
-
-    if ( is_transparent )
-    {
-      putNonTransparent(non_trans_count, start_char, dst_char);
-
-      if ( trans_count == 0 )
-        start_char = src_char;
-
-      trans_count++;
-    }
-    else
-    {
-      addTransparent(trans_count, start_char, dst_char);
-
-      if ( non_trans_count == 0 )
-        start_char = src_char;
-
-      non_trans_count++;
-    }
-
-    if ( src_char == last_char )
-    {
-      if ( trans_count != 0 )
-        addTransparentAreaLine (*start_char, *dst_char, trans_count);
-      else if ( non_trans_count != 0 )
-        putAreaLine (*start_char, *dst_char, non_trans_count);
-
-      break;
-    }
-
-    src_char++;
+    const auto run_length = getEqualTransparencyRunLength(src_char, end_char);
+    addTransparentAreaLine (*src_char, *dst_char, run_length);
+    src_char += run_length;
+    dst_char += run_length;
   }
 }
 
@@ -1689,55 +1908,68 @@ inline void FVTerm::addTransparentAreaLine ( const FChar& src_char
                                            , FChar& dst_char
                                            , const std::size_t length ) const
 {
-  auto src = &src_char;
-  auto dst = &dst_char;
-  const auto end = src + length;
+  // All "length" characters have the same kind of transparency
 
-  for (; src < end; ++src)  // column loop
-  {
-    addTransparentAreaChar (*src, *dst);
-    ++dst;  // dst character
-  }
+  if ( src_char.attr.bit.transparent )  // Transparent
+    return;  // Leave characters on vterm untouched
+
+  if ( src_char.attr.bit.color_overlay )  // Color overlay
+    addColorOverlayAreaLine (&src_char, &dst_char, length);
+  else if ( src_char.attr.bit.inherit_background )
+    addInheritBackgroundAreaLine (&src_char, &dst_char, length);
+  else  // Default
+    putAreaLine (src_char, dst_char, length);
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::addTransparentAreaChar (const FChar& src_char, FChar& dst_char) const
+inline void FVTerm::addColorOverlayAreaLine ( const FChar* src_char
+                                            , FChar* dst_char
+                                            , const std::size_t length ) const
 {
-  if ( src_char.attr.bit.transparent )  // Transparent
-    return;  // Leave character on vterm untouched
+  const auto end_char = src_char + length;
 
-  if ( src_char.attr.bit.color_overlay )  // Color overlay
+  for (; src_char < end_char; ++src_char, ++dst_char)  // column loop
   {
     // Get covered character + add the current color
-    dst_char.fg_color = src_char.fg_color;
-    dst_char.bg_color = src_char.bg_color;
-    dst_char.attr.byte[0] = src_char.attr.byte[0];
-    dst_char.attr.byte[1] = src_char.attr.byte[1];
-    dst_char.attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
-    dst_char.attr.bit.color_overlay  = false;
-    dst_char.attr.bit.reverse  = false;
-    dst_char.attr.bit.standout = false;
-
-    if ( isTransparentInvisible(dst_char) )
-      dst_char.ch[0] = L' ';
+    dst_char->fg_color = src_char->fg_color;
+    dst_char->bg_color = src_char->bg_color;
+    dst_char->attr.byte[0] = src_char->attr.byte[0];
+    dst_char->attr.byte[1] = src_char->attr.byte[1];
+    dst_char->attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
+    dst_char->attr.bit.color_overlay  = false;
+    dst_char->attr.bit.reverse  = false;
+    dst_char->attr.bit.standout = false;
+
+    if ( isTransparentInvisible(*dst_char) )
+      dst_char->ch[0] = L' ';
   }
-  else if ( src_char.attr.bit.inherit_background )
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::addInheritBackgroundAreaLine ( const FChar* src_char
+                                                 , FChar* dst_char
+                                                 , const std::size_t length ) const
+{
+  const auto end_char = src_char + length;
+
+  for (; src_char < end_char; ++src_char, ++dst_char)  // column loop
   {
     // Add the covered background to this character
-    auto bg_color = dst_char.bg_color;
-    dst_char = src_char;
-    dst_char.bg_color = bg_color;
-    dst_char.attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
+    const auto bg_color = dst_char->bg_color;
+    *dst_char = *src_char;
+    dst_char->bg_color = bg_color;
+    dst_char->attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
   }
-  else  // Default
-    dst_char = src_char;
 }
 
 //----------------------------------------------------------------------
 auto FVTerm::clearFullArea (FTermArea* area, FChar& fillchar) const -> bool
 {
   // Clear area
-  std::fill (area->data.begin(), area->data.end(), fillchar);
+  if ( area->tiled )
+    area->resetTiles (fillchar);
+  else
+    std::fill (area->data.begin(), area->data.end(), fillchar);
 
   if ( area != vdesktop.get() )  // Is the area identical to the desktop?
     return false;
@@ -1920,39 +2152,77 @@ inline void FVTerm::printPaddingCharacter (FTermArea* area, const FChar& term_ch
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::putNonTransparent ( std::size_t& non_trans_count
-                                      , const FChar* start_char, FChar*& dst_char ) const
+auto FVTerm::printAsciiRun ( FTermArea* area
+                           , FString::const_iterator first
+                           , FString::const_iterator last ) const noexcept -> int
 {
-  if ( non_trans_count == 0 )
-    return;
+  // Prints a run of printable ASCII characters with the current
+  // attributes row by row into the area. Each row segment is clipped
+  // once and the changed columns are added to the line changes once.
 
-  putAreaLine(*start_char, *dst_char, non_trans_count);
-  dst_char += non_trans_count;  // dst character
-  non_trans_count = 0;
-}
+  static const auto& next_attr = getAttribute();
+  FChar fchar{};
+  fchar.fg_color     = next_attr.fg_color;
+  fchar.bg_color     = next_attr.bg_color;
+  fchar.attr.byte[0] = next_attr.attr.byte[0];
+  fchar.attr.byte[1] = next_attr.attr.byte[1];
+  fchar.attr.bit.char_width = 1;
+  const int full_width  = getFullAreaWidth(area);
+  const int full_height = getFullAreaHeight(area);
+  int len{0};
 
-//----------------------------------------------------------------------
-inline void FVTerm::addTransparent ( std::size_t& trans_count
-                                   , const FChar* start_char, FChar*& dst_char ) const
-{
-  if ( trans_count == 0 )
-    return;
+  while ( first != last )
+  {
+    if ( ! area->checkPrintPos() || printWrap(area) )
+      break;  // Cursor position out of range or end of area reached
+
+    const int ax = area->cursor.x - 1;
+    const int ay = area->cursor.y - 1;
+    const auto count = int(std::min(last - first, std::ptrdiff_t(full_width - ax)));
+    auto* ac = &area->getFChar(ax, ay);  // area character
+    auto& line_changes = area->changes[unsigned(ay)];
+    auto xmin = line_changes.xmin;
+    auto xmax = line_changes.xmax;
+
+    for (auto x{0}; x < count; x++, ac++)
+    {
+      fchar.ch[0] = first[x];
 
-  addTransparentAreaLine (*start_char, *dst_char, trans_count);
-  dst_char += trans_count;  // dst character
-  trans_count = 0;
-}
+      if ( *ac == fchar )
+        continue;
 
-//----------------------------------------------------------------------
-inline void FVTerm::putTransparent ( std::size_t& trans_count
-                                   , const FPoint& pos, FChar*& dst_char ) const
-{
-  if ( trans_count == 0 )
-    return;
+      if ( changedToTransparency(*ac, fchar) )
+        line_changes.trans_count++;
+
+      if ( changedFromTransparency(*ac, fchar) )
+        line_changes.trans_count--;
+
+      *ac = fchar;
+      xmin = std::min(xmin, uInt(ax + x));
+      xmax = std::max(xmax, uInt(ax + x));
+    }
+
+    line_changes.xmin = xmin;
+    line_changes.xmax = xmax;
 
-  putTransparentAreaLine(pos, trans_count);
-  dst_char += trans_count;  // dst character
-  trans_count = 0;
+    first += count;
+    len += count;
+    area->cursor.x += count;
+    area->has_changes = true;
+
+    // Line break at right margin
+    if ( area->cursor.x > full_width )
+    {
+      area->cursor.x = 1;
+      area->cursor.y++;
+    }
+
+    // Prevent up scrolling
+    if ( area->cursor.y > full_height )
+      area->cursor.y--;
+  }
+
+  return len;
 }
 
 //----------------------------------------------------------------------
@@ -173,6 +173,7 @@ class FVTerm : public FVTermAttribute
     auto  getVWin() const noexcept -> const FTermArea*;
     auto  getPrintCursor() -> FPoint;
     static auto  getWindowList() -> FVTermList*;
+    static auto  getCompositingThreads() -> std::size_t;
 
     // Mutators
     void  setTerminalUpdates (TerminalUpdate) const;
@@ -180,6 +181,7 @@ class FVTerm : public FVTermAttribute
     void  setVWin (std::unique_ptr<FTermArea>&&) noexcept;
     static void  setNonBlockingRead (bool = true);
     static void  unsetNonBlockingRead();
+    static void  setCompositingThreads (std::size_t);
 
     // Inquiries
     static auto  isDrawingFinished() noexcept -> bool;
@@ -246,6 +248,7 @@ class FVTerm : public FVTermAttribute
     // Methods
     auto  createArea (const FShadowBox&) -> std::unique_ptr<FTermArea>;
     auto  createArea (const FRect&) -> std::unique_ptr<FTermArea>;
+    auto  createTiledArea (const FRect&) -> std::unique_ptr<FTermArea>;
     void  resizeArea (const FShadowBox&, FTermArea*) const;
     void  resizeArea (const FRect&, FTermArea*) const;
     void  restoreVTerm (const FRect&) const noexcept;
@@ -271,6 +274,8 @@ class FVTerm : public FVTermAttribute
   private:
     // Constants
     static constexpr int DEFAULT_MINIMIZED_HEIGHT = 1;
+    static constexpr int MIN_COMPOSITING_BAND_HEIGHT = 8;
+    static constexpr std::size_t MIN_PARALLEL_COMPOSITING_CELLS = 8192;
 
     // Enumeration
     enum class CoveredState
@@ -304,6 +309,10 @@ class FVTerm : public FVTermAttribute
     int   calculateEndCoordinate (int, int, int, int) const noexcept;
     void  restoreOverlaidWindows (const FTermArea* area) const noexcept;
     void  updateVTerm() const;
+    void  prepareLayer (FTermArea*, std::vector<FTermArea*>&) const;
+    void  addLayerLines (FTermArea*, int, int) const noexcept;
+    auto  addLayersInParallel (const std::vector<FTermArea*>&) const -> bool;
+    auto  getChangedCellCount (const FTermArea*) const noexcept -> std::size_t;
     void  scrollTerminalForward() const;
     void  scrollTerminalReverse() const;
     void  callPreprocessingHandler (const FTermArea*) const;
@@ -323,7 +332,8 @@ class FVTerm : public FVTermAttribute
     void  putTransparentAreaLine (const FPoint&, const std::size_t) const;
     void  addAreaLineWithTransparency (const FChar*, FChar*, const std::size_t) const;
     void  addTransparentAreaLine (const FChar&, FChar&, const std::size_t) const;
-    void  addTransparentAreaChar (const FChar&, FChar&) const;
+    void  addColorOverlayAreaLine (const FChar*, FChar*, const std::size_t) const;
+    void  addInheritBackgroundAreaLine (const FChar*, FChar*, const std::size_t) const;
     auto  clearFullArea (FTermArea*, FChar&) const -> bool;
     void  clearAreaWithShadow (FTermArea*, const FChar&) const noexcept;
     auto  printWrap (FTermArea*) const -> bool;
@@ -333,9 +343,8 @@ class FVTerm : public FVTermAttribute
     auto  printCharacterOnCoordinate ( FTermArea*
                                      , const FChar&) const noexcept -> std::size_t;
     void  printPaddingCharacter (FTermArea*, const FChar&) const;
-    void  putNonTransparent (std::size_t&, const FChar*, FChar*&) const;
-    void  addTransparent (std::size_t&, const FChar*, FChar*&) const;
-    void  putTransparent (std::size_t&, const FPoint&, FChar*&) const;
+    auto  printAsciiRun ( FTermArea*, FString::const_iterator
+                        , FString::const_iterator ) const noexcept -> int;
     auto  isInsideTerminal (const FPoint&) const noexcept -> bool;
     auto  canUpdateTerminalNow() const -> bool;
     static auto hasPendingUpdates (const FTermArea*) noexcept -> bool;
@@ -375,6 +384,10 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   using FDataAccessPtr  = std::shared_ptr<FDataAccess>;
   using FLineChangesPtr = std::vector<FLineChanges>;
   using FCharPtr        = std::vector<FChar>;
+  using FTileList       = std::vector<FCharPtr>;
+
+  // Constants
+  static constexpr int TILE_HEIGHT{16};  // Lines per tile of a tiled area
 
   // Constructor
   FTermArea() = default;
@@ -413,11 +426,17 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
 
   inline auto getFChar (int x, int y) const noexcept -> const FChar&
   {
+    if ( tiled )
+      return getTileFChar(x, y);
+
     return data[unsigned(y) * unsigned(size.width + shadow.width) + unsigned(x)];
   }
 
   inline auto getFChar (int x, int y) noexcept -> FChar&
   {
+    if ( tiled )
+      return getTileFChar(x, y);
+
     return data[unsigned(y) * unsigned(size.width + shadow.width) + unsigned(x)];
   }
 
@@ -452,6 +471,11 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
     return -1;
   }
 
+  auto getTileFChar (int, int) const noexcept -> const FChar&;
+  auto getTileFChar (int, int) noexcept -> FChar&;
+  auto getAllocatedTileCount() const noexcept -> std::size_t;
+  void resetTiles (const FChar&);
+
   // Data members
   struct Coordinate
   {
@@ -477,10 +501,13 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   bool            has_changes{false};
   bool            visible{false};
   bool            minimized{false};
+  bool            tiled{false};          // Lazily allocated tiles instead of data
   FDataAccessPtr  owner{nullptr};        // Object that owns this FTermArea
   FPreprocVector  preproc_list{};
   FLineChangesPtr changes{};
   FCharPtr        data{};                // FChar data of the drawing area
+  FTileList       tiles{};               // Tiles of TILE_HEIGHT full-width lines
+  FCharPtr        blank_line{};          // Content of unallocated tiles
 };
 
 //----------------------------------------------------------------------
@@ -532,6 +559,59 @@ inline auto FVTerm::FTermArea::isOverlapped (const FTermArea* area) const noexce
         && std::max(y1, area_y1) <= std::min(y2, area_y2) );
 }
 
+//----------------------------------------------------------------------
+inline auto FVTerm::FTermArea::getTileFChar (int x, int y) const noexcept -> const FChar&
+{
+  // Reading an unallocated tile does not allocate it
+
+  const auto& tile = tiles[unsigned(y / TILE_HEIGHT)];
+
+  if ( tile.empty() )
+    return blank_line[unsigned(x)];
+
+  const auto width = unsigned(size.width + shadow.width);
+  return tile[unsigned(y % TILE_HEIGHT) * width + unsigned(x)];
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FTermArea::getTileFChar (int x, int y) noexcept -> FChar&
+{
+  // A tile is allocated on the first write access
+
+  auto& tile = tiles[unsigned(y / TILE_HEIGHT)];
+  const auto width = unsigned(size.width + shadow.width);
+
+  if ( tile.empty() )
+  {
+    tile.reserve(width * unsigned(TILE_HEIGHT));
+
+    for (auto i{0}; i < TILE_HEIGHT; i++)
+      tile.insert(tile.end(), blank_line.cbegin(), blank_line.cend());
+  }
+
+  return tile[unsigned(y % TILE_HEIGHT) * width + unsigned(x)];
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FTermArea::getAllocatedTileCount() const noexcept -> std::size_t
+{
+  return std::size_t(std::count_if ( tiles.cbegin(), tiles.cend()
+                                   , [] (const FCharPtr& tile)
+                                     { return ! tile.empty(); } ));
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::FTermArea::resetTiles (const FChar& fillchar)
+{
+  // Releases all tiles, unallocated tiles read as fillchar
+
+  const auto width = std::size_t(size.width + shadow.width);
+  const auto height = std::size_t(size.height + shadow.height);
+  const auto tile_count = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+  blank_line.assign(width, fillchar);
+  FTileList(tile_count).swap(tiles);
+}
+
 //----------------------------------------------------------------------
 inline auto FVTerm::FTermArea::checkPrintPos() const noexcept -> bool
 {
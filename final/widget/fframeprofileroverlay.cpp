@@ -0,0 +1,129 @@
+/***********************************************************************
+* fframeprofileroverlay.cpp - On-screen frame profiler statistics      *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+#include <algorithm>
+
+#include "final/fevent.h"
+#include "final/util/fframeprofiler.h"
+#include "final/widget/fframeprofileroverlay.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FFrameProfilerOverlay
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FFrameProfilerOverlay::FFrameProfilerOverlay (FWidget* parent)
+  : FToolTip{parent}
+{
+  init();
+}
+
+//----------------------------------------------------------------------
+FFrameProfilerOverlay::~FFrameProfilerOverlay() noexcept  // destructor
+{
+  FFrameProfiler::getInstance().setEnable(was_enabled);
+}
+
+
+// public methods of FFrameProfilerOverlay
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::setUpdateInterval (int interval)
+{
+  if ( interval <= 0 )
+    return;
+
+  update_interval = interval;
+  delOwnTimers();
+  addTimer(update_interval);
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::updateStatistics()
+{
+  const auto& profiler = FFrameProfiler::getInstance();
+  const auto average = profiler.getAverage(AVERAGE_FRAMES);
+  FString txt{};
+  txt << "Frame " << profiler.getFrameCount() << "\n";
+
+  for (std::size_t i{0}; i < FFrameProfiler::PHASE_COUNT; i++)
+  {
+    const auto phase = FFrameProfiler::Phase(i);
+    txt << FString().sprintf ( L"%-11s %8.3f ms\n"
+                             , FFrameProfiler::getPhaseName(phase)
+                             , double(average.phase_time[i]) / 1.0e6 );
+  }
+
+  txt << FString().sprintf (L"%-11s %8.3f ms\n", "total", double(average.total_time) / 1.0e6)
+      << FString().sprintf (L"%-11s %8lu\n", "cells", static_cast<unsigned long>(average.cell_count))
+      << FString().sprintf (L"%-11s %8lu\n", "bytes", static_cast<unsigned long>(average.byte_count))
+      << FString().sprintf (L"%-11s %8lu", "events", static_cast<unsigned long>(average.event_count));
+  setText(txt);
+  placeInCorner();
+}
+
+
+// private methods of FFrameProfilerOverlay
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::init()
+{
+  auto& profiler = FFrameProfiler::getInstance();
+  was_enabled = profiler.isEnabled();
+  profiler.setEnable();
+  disableAutoTrim();
+  updateStatistics();
+  addTimer(update_interval);
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::placeInCorner()
+{
+  // Moves the overlay to the upper right corner of the terminal
+
+  if ( const auto& r = getRootWidget() )
+  {
+    const int x = std::max(1, int(r->getWidth()) - int(getWidth()) + 1);
+    setPos (FPoint{x, 1}, false);
+  }
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::adjustSize()
+{
+  FWindow::adjustSize();
+  placeInCorner();
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerOverlay::onTimer (FTimerEvent*)
+{
+  updateStatistics();
+
+  if ( isShown() )
+    redraw();
+}
+
+}  // namespace finalcut
@@ -0,0 +1,123 @@
+/***********************************************************************
+* fframeprofileroverlay.h - On-screen frame profiler statistics        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▏
+ * ▕ FVTerm  ▏ ▕ FObject ▏
+ * ▕▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▏
+ *      ▲           ▲
+ *      │           │
+ *      └─────┬─────┘
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FWidget ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FWindow ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FToolTip ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *  ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *  ▕ FFrameProfilerOverlay ▏
+ *  ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+// Shows the average frame phase durations and counters of the
+// frame profiler in the upper right corner of the terminal.
+// The profiler is enabled as long as the overlay exists.
+
+#ifndef FFRAMEPROFILEROVERLAY_H
+#define FFRAMEPROFILEROVERLAY_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include "final/widget/ftooltip.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FFrameProfilerOverlay
+//----------------------------------------------------------------------
+
+class FFrameProfilerOverlay : public FToolTip
+{
+  public:
+    // Constants
+    static constexpr int DEFAULT_INTERVAL = 500;  // ms
+    static constexpr std::size_t AVERAGE_FRAMES = 32;
+
+    // Constructor
+    explicit FFrameProfilerOverlay (FWidget* = nullptr);
+
+    // Destructor
+    ~FFrameProfilerOverlay() noexcept override;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getUpdateInterval() const noexcept -> int;
+
+    // Mutator
+    void setUpdateInterval (int);
+
+    // Methods
+    void updateStatistics();
+
+  private:
+    // Methods
+    void init();
+    void placeInCorner();
+    void adjustSize() override;
+
+    // Event handler
+    void onTimer (FTimerEvent*) override;
+
+    // Data members
+    int   update_interval{DEFAULT_INTERVAL};
+    bool  was_enabled{false};
+};
+
+
+// FFrameProfilerOverlay inline functions
+//----------------------------------------------------------------------
+inline auto FFrameProfilerOverlay::getClassName() const -> FString
+{ return "FFrameProfilerOverlay"; }
+
+//----------------------------------------------------------------------
+inline auto FFrameProfilerOverlay::getUpdateInterval() const noexcept -> int
+{ return update_interval; }
+
+}  // namespace finalcut
+
+#endif  // FFRAMEPROFILEROVERLAY_H
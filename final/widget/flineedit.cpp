@@ -21,6 +21,8 @@
 ***********************************************************************/
 
 #include <array>
+#include <cwctype>
+#include <memory>
 #include <regex>
 
 #include "final/fapplication.h"
@@ -181,6 +183,77 @@ void FLineEdit::inputText (const FString& input)
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FLineEdit::setInputFilter (const FString& regex_string)
+{
+  // Only characters that match the regular expression are accepted.
+  // The expression is compiled only once.
+
+  if ( regex_string.isEmpty() )
+  {
+    clearInputFilter();
+    return;
+  }
+
+  const auto regex = std::make_shared<std::wregex>(regex_string.toWString());
+
+  setInputFilter ( [regex] (wchar_t c)
+                   {
+                     const wchar_t str[2]{c, L'\0'};
+                     return std::regex_match(str, *regex);
+                   } );
+}
+
+//----------------------------------------------------------------------
+void FLineEdit::setInputFilter (CharClass char_class, const FString& extra_chars)
+{
+  // Accepts the characters of a character class and
+  // the additional characters in extra_chars
+
+  const auto is_in_class = [char_class] (wchar_t c) -> bool
+  {
+    const auto ch = std::wint_t(c);
+
+    switch ( char_class )
+    {
+      case CharClass::Digit:
+        return c >= L'0' && c <= L'9';
+
+      case CharClass::XDigit:
+        return std::iswxdigit(ch) != 0;
+
+      case CharClass::Alpha:
+        return std::iswalpha(ch) != 0;
+
+      case CharClass::Alnum:
+        return std::iswalnum(ch) != 0;
+
+      case CharClass::Upper:
+        return std::iswupper(ch) != 0;
+
+      case CharClass::Lower:
+        return std::iswlower(ch) != 0;
+
+      case CharClass::Space:
+        return std::iswspace(ch) != 0;
+
+      case CharClass::Punct:
+        return std::iswpunct(ch) != 0;
+
+      case CharClass::Print:
+        return std::iswprint(ch) != 0;
+    }
+
+    return false;
+  };
+
+  setInputFilter ( [is_in_class, extra = extra_chars.toWString()] (wchar_t c)
+                   {
+                     return is_in_class(c)
+                         || extra.find(c) != std::wstring::npos;
+                   } );
+}
+
 //----------------------------------------------------------------------
 void FLineEdit::deletesCharacter()
 {
@@ -373,6 +446,44 @@ void FLineEdit::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FLineEdit::onPaste (FPasteEvent* ev)
+{
+  // Inserts the filtered text in one step and draws the field only once
+
+  if ( isReadOnly() )
+    return;
+
+  ev->accept();
+  const auto length = text.getLength();
+  const auto free_space = ( length < max_length ) ? max_length - length : 0;
+  FString input{};
+
+  for (const auto& ch : ev->getText())
+  {
+    if ( input.getLength() >= free_space )
+    {
+      FVTerm::getFOutput()->beep();
+      break;
+    }
+
+    if ( ch < L' ' )  // Skip line breaks and other control characters
+      continue;
+
+    const auto filtered_char = characterFilter(ch);
+
+    if ( filtered_char != L'\0' )
+      input += filtered_char;
+  }
+
+  if ( input.isEmpty() )
+    return;
+
+  inputText (input);
+  drawInputField();
+  forceTerminalUpdate();
+}
+
 //----------------------------------------------------------------------
 void FLineEdit::onMouseDown (FMouseEvent* ev)
 {
@@ -1161,13 +1272,27 @@ inline auto FLineEdit::keyInput (FKey key) -> bool
   return false;
 }
 
+//----------------------------------------------------------------------
+void FLineEdit::setInputFilter (FilterFunction&& filter)
+{
+  // The filter results for ASCII characters are determined in advance
+
+  input_filter.match = std::move(filter);
+
+  for (std::size_t c{0}; c < input_filter.ascii.size(); c++)
+    input_filter.ascii[c] = input_filter.match(wchar_t(c));
+}
+
 //----------------------------------------------------------------------
 inline auto FLineEdit::characterFilter (const wchar_t c) const -> wchar_t
 {
-  if ( input_filter.empty() )
+  if ( ! input_filter.match )
     return c;
 
-  if ( std::regex_match(std::wstring(1, c), std::wregex(input_filter)) )
+  if ( c >= 0 && std::size_t(c) < input_filter.ascii.size() )
+    return input_filter.ascii[std::size_t(c)] ? c : L'\0';
+
+  if ( input_filter.match(c) )
     return c;
 
   return L'\0';
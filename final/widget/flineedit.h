@@ -47,6 +47,8 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <bitset>
+#include <functional>
 #include <limits>
 #include <tuple>
 #include <unordered_map>
@@ -83,6 +85,19 @@ class FLineEdit : public FWidget
       Password  = 1
     };
 
+    enum class CharClass
+    {
+      Digit  = 0,  // 0-9
+      XDigit = 1,  // 0-9, a-f, A-F
+      Alpha  = 2,  // Letters
+      Alnum  = 3,  // Letters and digits
+      Upper  = 4,  // Uppercase letters
+      Lower  = 5,  // Lowercase letters
+      Space  = 6,  // Whitespace characters
+      Punct  = 7,  // Punctuation characters
+      Print  = 8   // Printable characters
+    };
+
     // Constructor
     explicit FLineEdit (FWidget* = nullptr);
     explicit FLineEdit (const FString&, FWidget* = nullptr);
@@ -125,6 +140,7 @@ class FLineEdit : public FWidget
     void inputText (const FString&);
     void deletesCharacter();
     void setInputFilter (const FString&);
+    void setInputFilter (CharClass, const FString& = FString{});
     void clearInputFilter();
     void setMaxLength (std::size_t);
     void setCursorPosition (std::size_t);
@@ -159,6 +175,7 @@ class FLineEdit : public FWidget
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onPaste (FPasteEvent*) override;
     void onMouseDown (FMouseEvent*) override;
     void onMouseUp (FMouseEvent*) override;
     void onMouseMove (FMouseEvent*) override;
@@ -177,6 +194,13 @@ class FLineEdit : public FWidget
     // Using-declaration
     using offsetPair = std::pair<std::size_t, std::size_t>;
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
+    using FilterFunction = std::function<bool(wchar_t)>;
+
+    struct InputFilter
+    {
+      std::bitset<128>  ascii{};  // Precomputed results for ASCII characters
+      FilterFunction    match{};  // Filter for all other characters
+    };
 
     // Constants
     static constexpr auto NOT_SET = static_cast<std::size_t>(-1);
@@ -218,6 +242,7 @@ class FLineEdit : public FWidget
     void switchInsertMode();
     void acceptInput();
     auto keyInput (FKey) -> bool;
+    void setInputFilter (FilterFunction&&);
     auto characterFilter (const wchar_t) const -> wchar_t;
     void processActivate();
     void processChanged() const;
@@ -228,7 +253,7 @@ class FLineEdit : public FWidget
     FString          label_text{""};
     FLabel*          label{};
     FWidget*         label_associated_widget{this};
-    std::wstring     input_filter{};
+    InputFilter      input_filter{};
     KeyMap           key_map{};
     DragScrollMode   drag_scroll{DragScrollMode::None};
     LabelOrientation label_orientation{LabelOrientation::Left};
@@ -285,13 +310,9 @@ inline auto FLineEdit::getLabelObject() const -> FLabel*
 inline auto FLineEdit::getLabelOrientation() const -> LabelOrientation
 { return label_orientation; }
 
-//----------------------------------------------------------------------
-inline void FLineEdit::setInputFilter (const FString& regex_string)
-{ input_filter = regex_string.toWString(); }
-
 //----------------------------------------------------------------------
 inline void FLineEdit::clearInputFilter()
-{ input_filter.clear(); }
+{ input_filter = InputFilter{}; }
 
 //----------------------------------------------------------------------
 inline void FLineEdit::setInputType (const InputType type)
@@ -27,6 +27,7 @@
 #include "final/fevent.h"
 #include "final/fwidgetcolors.h"
 #include "final/util/fstring.h"
+#include "final/util/fstringview.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/widget/flistbox.h"
 #include "final/widget/fstatusbar.h"
@@ -1471,8 +1472,7 @@ inline auto FListBox::spacebarProcessing() -> bool
     while ( iter != data.itemlist.end() )
     {
       if ( ! inc_found
-        && data.inc_search.toLower()
-        == iter->getText().left(inc_len + 1).toLower() )
+        && FStringView{iter->text}.caseStartsWith(data.inc_search) )
       {
         setCurrentItem(iter);
         inc_found = true;
@@ -1546,8 +1546,7 @@ inline auto FListBox::deletePreviousCharacter() -> bool
 
     while ( iter != data.itemlist.end() )
     {
-      if ( data.inc_search.toLower()
-           == iter->getText().left(inc_len - 1).toLower() )
+      if ( FStringView{iter->text}.caseStartsWith(data.inc_search) )
       {
         setCurrentItem(iter);
         break;
@@ -1579,8 +1578,7 @@ inline auto FListBox::keyIncSearchInput (FKey key) -> bool
   while ( iter != data.itemlist.end() )
   {
     if ( ! inc_found
-      && data.inc_search.toLower()
-      == iter->getText().left(inc_len).toLower() )
+      && FStringView{iter->text}.caseStartsWith(data.inc_search) )
     {
       setCurrentItem(iter);
       inc_found = true;
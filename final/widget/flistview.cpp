@@ -21,8 +21,13 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <cwctype>
+#include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -32,6 +37,7 @@
 #include "final/fwidgetcolors.h"
 #include "final/util/emptyfstring.h"
 #include "final/util/fstring.h"
+#include "final/util/ftaskexecutor.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fvtermbuffer.h"
 #include "final/widget/flistview.h"
@@ -42,12 +48,12 @@ namespace finalcut
 
 // Function prototypes
 auto firstNumberFromString (const FString&) -> uInt64;
-auto sortByName (const FObject*, const FObject*) -> int;
-auto sortAscendingByName (const FObject*, const FObject*) -> bool;
-auto sortDescendingByName (const FObject*, const FObject*) -> bool;
-auto sortByNumber (const FObject* lhs, const FObject* rhs) -> int;
-auto sortAscendingByNumber (const FObject*, const FObject*) -> bool;
-auto sortDescendingByNumber (const FObject*, const FObject*) -> bool;
+auto caseFoldedString (const FString&) -> std::wstring;
+auto getSortExecutor (std::size_t) -> FTaskExecutor&;
+template <typename Iter, typename Compare>
+void parallelSort (Iter, Iter, Compare);
+template <typename KeyFunc, typename Compare>
+void sortListByKey (FObject::FObjectList&, KeyFunc, Compare);
 
 // non-member functions
 //----------------------------------------------------------------------
@@ -83,89 +89,143 @@ auto firstNumberFromString (const FString& str) -> uInt64
 
   auto last_pos = iter;
 
-  if ( last_pos == str.cend() )
+  if ( last_pos == str.cend() || first_pos == last_pos )
     return 0;
 
-  uInt64 number;
-  const auto pos = std::size_t(std::distance(str.cbegin(), first_pos)) + 1;
-  const auto length = std::size_t(std::distance(first_pos, last_pos));
-  const auto& num_str = str.mid(pos, length);
+  // Convert the digits in place without a substring and exceptions
+  constexpr auto max = uInt64(std::numeric_limits<long>::max());
+  uInt64 number{0};
 
-  try
-  {
-    number = uInt64(num_str.toLong());
-  }
-  catch (const std::invalid_argument&)
+  for (iter = first_pos; iter != last_pos; ++iter)
   {
-    return 0;
-  }
-  catch (const std::underflow_error&)
-  {
-    return std::numeric_limits<uInt64>::min();
-  }
-  catch (const std::overflow_error&)
-  {
-    return std::numeric_limits<uInt64>::max();
+    const auto digit = uInt64(*iter - L'0');
+
+    if ( number > (max - digit) / 10 )
+      return std::numeric_limits<uInt64>::max();
+
+    number = 10 * number + digit;
   }
 
   return number;
 }
 
 //----------------------------------------------------------------------
-auto sortByName (const FObject* lhs, const FObject* rhs) -> int
+auto caseFoldedString (const FString& str) -> std::wstring
 {
-  const auto& l_item = static_cast<const FListViewItem*>(lhs);
-  const auto& r_item = static_cast<const FListViewItem*>(rhs);
-  const int column = l_item->getSortColumn();
-  const auto& l_string = l_item->getText(column);
-  const auto& r_string = r_item->getText(column);
+  // Sort key with the same order as FStringCaseCompare()
 
-  // Compare lhs with rhs
-  return FStringCaseCompare(l_string, r_string);
+  std::wstring folded(str.getLength(), L'\0');
+  std::transform ( str.cbegin(), str.cend(), folded.begin()
+                 , [] (wchar_t ch)
+                   {
+                     return wchar_t(std::towlower(std::wint_t(ch)));
+                   } );
+  return folded;
 }
 
 //----------------------------------------------------------------------
-auto sortAscendingByName (const FObject* lhs, const FObject* rhs) -> bool
+auto getSortExecutor (std::size_t threads) -> FTaskExecutor&
 {
-  // lhs < rhs
-  return sortByName(lhs, rhs) < 0;
-}
+  // The worker threads are started at the first large sort and are
+  // reused by all following sorts with the same number of threads
 
-//----------------------------------------------------------------------
-auto sortDescendingByName (const FObject* lhs, const FObject* rhs) -> bool
-{
-  // lhs > rhs
-  return sortByName(lhs, rhs) > 0;
+  static std::unique_ptr<FTaskExecutor> executor{};
+
+  if ( ! executor || executor->getThreadCount() != threads )
+  {
+    executor.reset();  // Joins the previous worker threads
+    executor = std::make_unique<FTaskExecutor>(threads);
+  }
+
+  return *executor;
 }
 
 //----------------------------------------------------------------------
-auto sortByNumber (const FObject* lhs, const FObject* rhs) -> int
+template <typename Iter, typename Compare>
+void parallelSort (Iter first, Iter last, Compare cmp)
 {
-  const auto& l_item = static_cast<const FListViewItem*>(lhs);
-  const auto& r_item = static_cast<const FListViewItem*>(rhs);
-  const int column = l_item->getSortColumn();
-  const auto& l_number = firstNumberFromString(l_item->getText(column));
-  const auto& r_number = firstNumberFromString(r_item->getText(column));
+  // Large ranges are split into blocks that are sorted by the
+  // worker threads and then merged together in pairs
 
-  // Compare lhs with rhs
-  if ( l_number < r_number )
-    return -1;
+  const auto size = std::size_t(std::distance(first, last));
+  auto threads = FListView::getSortThreadCount();
 
-  return l_number == r_number ? 0 : 1;
-}
+  if ( threads == 0 )  // Automatic: up to 8 blocks
+  {
+    const auto hw_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    threads = std::min(std::size_t(hw_threads), std::size_t(8)) - 1;
+  }
 
-//----------------------------------------------------------------------
-auto sortAscendingByNumber (const FObject* lhs, const FObject* rhs) -> bool
-{
-  // lhs < rhs
-  return sortByNumber(lhs, rhs) < 0;
+  if ( size < FListView::getParallelSortThreshold() || threads == 0 || size < 2 )
+  {
+    std::sort(first, last, cmp);
+    return;
+  }
+
+  auto& executor = getSortExecutor(threads);
+  const auto blocks = threads + 1;
+
+  std::vector<Iter> bounds{};
+  bounds.reserve(blocks + 1);
+
+  for (std::size_t i{0}; i < blocks; i++)
+    bounds.push_back(first + std::ptrdiff_t(size * i / blocks));
+
+  bounds.push_back(last);
+
+  const auto run_parallel = [&executor] (std::size_t count, const auto& func)
+  {
+    for (std::size_t i{1}; i < count; i++)
+      executor.submit ([&func, i] () { func(i); });
+
+    func(0);  // The calling thread does the first part
+    executor.waitUntilIdle();
+  };
+
+  run_parallel ( blocks
+               , [&bounds, &cmp] (std::size_t i)
+                 { std::sort(bounds[i], bounds[i + 1], cmp); } );
+
+  for (std::size_t step{1}; step < blocks; step *= 2)
+  {
+    const auto merges = (blocks + 2 * step - 1) / (2 * step);
+    run_parallel ( merges
+                 , [&bounds, &cmp, step, blocks] (std::size_t i)
+                   {
+                     const auto lo = 2 * step * i;
+                     const auto mid = lo + step;
+
+                     if ( mid >= blocks )
+                       return;  // Nothing to merge
+
+                     const auto hi = std::min(mid + step, blocks);
+                     std::inplace_merge(bounds[lo], bounds[mid], bounds[hi], cmp);
+                   } );
+  }
 }
 
 //----------------------------------------------------------------------
-auto sortDescendingByNumber (const FObject* lhs, const FObject* rhs) -> bool
+template <typename KeyFunc, typename Compare>
+void sortListByKey (FObject::FObjectList& list, KeyFunc get_key, Compare cmp)
 {
-  // lhs > rhs
-  return sortByNumber(lhs, rhs) > 0;
+  // The sort key is determined only once per item
+
+  if ( list.size() < 2 )
+    return;
+
+  using KeyType = decltype(get_key(std::declval<const FListViewItem*>()));
+  using KeyItem = std::pair<KeyType, FObject*>;
+  std::vector<KeyItem> key_items{};
+  key_items.reserve(list.size());
+
+  for (auto&& obj : list)
+    key_items.emplace_back(get_key(static_cast<const FListViewItem*>(obj)), obj);
+
+  parallelSort ( key_items.begin(), key_items.end()
+               , [&cmp] (const KeyItem& lhs, const KeyItem& rhs)
+                 { return cmp(lhs.first, rhs.first); } );
+  std::transform ( key_items.cbegin(), key_items.cend(), list.begin()
+                 , [] (const KeyItem& key_item) { return key_item.second; } );
 }
 
 
@@ -410,6 +470,22 @@ void FListViewItem::sort (Compare cmp)
     static_cast<FListViewItem*>(item)->sort(cmp);
 }
 
+//----------------------------------------------------------------------
+template <typename KeyFunc, typename Compare>
+void FListViewItem::sortByKey (KeyFunc get_key, Compare cmp)
+{
+  if ( ! isExpandable() )
+    return;
+
+  // Sort the top level
+  auto& children = getChildren();
+  sortListByKey (children, get_key, cmp);
+
+  // Sort the sublevels
+  for (auto&& item : children)
+    static_cast<FListViewItem*>(item)->sortByKey(get_key, cmp);
+}
+
 //----------------------------------------------------------------------
 auto FListViewItem::appendItem (FListViewItem* child) -> FObject::iterator
 {
@@ -664,10 +740,250 @@ auto operator - (const FListViewIterator& lhs, int n) -> FListViewIterator
 }
 
 
+//----------------------------------------------------------------------
+// class FListViewModel
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FListViewModel::~FListViewModel() noexcept = default;
+
+
+//----------------------------------------------------------------------
+// class FListView::ModelRows
+//----------------------------------------------------------------------
+
+// Maps the row numbers of a model view to model nodes. Only the
+// expanded nodes are stored, each with the number of visible rows
+// below it, so that a row is found without visiting the rows in
+// front of it. The rows of the visible area are cached.
+
+class FListView::ModelRows
+{
+  public:
+    // Using-declaration
+    using Node = FListViewModel::Node;
+
+    // Constants
+    static constexpr auto NOT_FOUND = static_cast<std::size_t>(-1);
+
+    // Constructor
+    explicit ModelRows (FListViewModel* m)
+      : model{m}
+    {
+      reset();
+    }
+
+    // Accessors
+    auto getCount() const -> std::size_t
+    {
+      return root.visible;
+    }
+
+    auto getParentRow (std::size_t row) -> std::size_t
+    {
+      return locate(row).parent_row;
+    }
+
+    // Methods
+    auto find (std::size_t row, std::size_t columns) const -> const ModelRow*
+    {
+      const auto iter = cache.find(row);
+
+      if ( iter == cache.end() || iter->second.columns.size() != columns )
+        return nullptr;
+
+      return &iter->second;
+    }
+
+    auto fetch (std::size_t row, std::size_t columns) -> const ModelRow&
+    {
+      const auto location = locate(row);
+      const auto* parent = location.path.back();
+      auto& line = cache[row];
+      line.node = model->getChild(parent->node, location.index);
+      line.state.depth = location.path.size() - 1;
+      line.state.expandable = model->isExpandable(line.node);
+      line.state.expanded = parent->children.count(location.index) > 0;
+      line.columns.clear();
+      line.columns.reserve(columns);
+
+      for (std::size_t col{1}; col <= columns; col++)
+        line.columns.emplace_back(model->getText(line.node, int(col)).replaceControlCodes());
+
+      return line;
+    }
+
+    auto expand (std::size_t row) -> bool
+    {
+      const auto location = locate(row);
+      auto* parent = location.path.back();
+
+      if ( parent->children.count(location.index) > 0 )
+        return false;  // Already expanded
+
+      const auto node = model->getChild(parent->node, location.index);
+
+      if ( ! model->isExpandable(node) )
+        return false;
+
+      model->expand(node);  // Gives the model a chance to load the children
+      auto expanded = std::make_unique<Expanded>();
+      expanded->node = node;
+      expanded->visible = model->getChildCount(node);
+
+      for (auto* ancestor : location.path)
+        ancestor->visible += expanded->visible;
+
+      parent->children[location.index] = std::move(expanded);
+      dropCachedRows(row);
+      return true;
+    }
+
+    auto collapse (std::size_t row) -> bool
+    {
+      const auto location = locate(row);
+      auto* parent = location.path.back();
+      const auto iter = parent->children.find(location.index);
+
+      if ( iter == parent->children.end() )
+        return false;  // Not expanded
+
+      for (auto* ancestor : location.path)
+        ancestor->visible -= iter->second->visible;
+
+      // The expand state of the descendants is not kept
+      collapseNode (*iter->second);
+      parent->children.erase(iter);
+      dropCachedRows(row);
+      return true;
+    }
+
+    void reset()
+    {
+      root.node = FListViewModel::ROOT;
+      root.visible = model->getChildCount(FListViewModel::ROOT);
+      root.children.clear();
+      cache.clear();
+    }
+
+    void clearCache()
+    {
+      cache.clear();
+    }
+
+    void trimCache (std::size_t first, std::size_t page_size)
+    {
+      trimPageCache (cache, first, page_size);
+    }
+
+  private:
+    // An expanded node with its expanded children (key = child index)
+    struct Expanded
+    {
+      Node         node{FListViewModel::ROOT};
+      std::size_t  visible{0};
+      std::map<std::size_t, std::unique_ptr<Expanded>> children{};
+    };
+
+    struct Location
+    {
+      std::vector<Expanded*>  path{};  // From the root to the parent
+      std::size_t             index{0};
+      std::size_t             parent_row{NOT_FOUND};
+    };
+
+    // Methods
+    auto locate (std::size_t row) -> Location
+    {
+      Location location{};
+      auto* expanded = &root;
+      location.path.push_back(expanded);
+      std::size_t first_child_row{0};
+      bool descend{true};
+
+      while ( descend )
+      {
+        descend = false;
+        const std::size_t offset = row - first_child_row;
+        std::size_t skipped{0};  // Rows of the expanded children in front
+
+        for (const auto& child : expanded->children)
+        {
+          const std::size_t child_row = child.first + skipped;
+
+          if ( offset <= child_row )
+            break;
+
+          if ( offset <= child_row + child.second->visible )
+          {
+            // The row is below this child
+            location.parent_row = first_child_row + child_row;
+            first_child_row = location.parent_row + 1;
+            expanded = child.second.get();
+            location.path.push_back(expanded);
+            descend = true;
+            break;
+          }
+
+          skipped += child.second->visible;
+        }
+
+        if ( ! descend )
+          location.index = offset - skipped;
+      }
+
+      return location;
+    }
+
+    void collapseNode (const Expanded& expanded)
+    {
+      for (const auto& child : expanded.children)
+        collapseNode (*child.second);
+
+      model->collapse(expanded.node);
+    }
+
+    void dropCachedRows (std::size_t row)
+    {
+      // The rows from the changed row onwards have moved
+
+      for (auto iter = cache.begin(); iter != cache.end(); )
+      {
+        if ( iter->first >= row )
+          iter = cache.erase(iter);
+        else
+          ++iter;
+      }
+    }
+
+    // Data members
+    FListViewModel*                           model;
+    Expanded                                  root{};
+    std::unordered_map<std::size_t, ModelRow> cache{};
+};
+
+
+//----------------------------------------------------------------------
+// struct FListView::ModelViewState
+//----------------------------------------------------------------------
+
+// constructor and destructor
+//----------------------------------------------------------------------
+FListView::ModelViewState::ModelViewState() = default;
+
+//----------------------------------------------------------------------
+FListView::ModelViewState::~ModelViewState() = default;
+
+
 //----------------------------------------------------------------------
 // class FListView
 //----------------------------------------------------------------------
 
+// static class attributes
+std::size_t FListView::sort_thread_count{0};
+std::size_t FListView::parallel_sort_threshold{16384};
+
 // constructor and destructor
 //----------------------------------------------------------------------
 FListView::FListView (FWidget* parent)
@@ -686,6 +1002,9 @@ FListView::~FListView()  // destructor
 //----------------------------------------------------------------------
 auto FListView::getCount() const -> std::size_t
 {
+  if ( hasModel() )
+    return model_view.rows->getCount();
+
   std::size_t n{0};
 
   for (auto&& item : data.itemlist)
@@ -741,6 +1060,15 @@ auto FListView::getColumnSortType (int column) const -> SortType
   return s_type;
 }
 
+//----------------------------------------------------------------------
+auto FListView::getCurrentNode() -> FListViewModel::Node
+{
+  if ( ! hasModel() || isItemListEmpty() )
+    return FListViewModel::ROOT;
+
+  return getModelRow(model_view.current_row).node;
+}
+
 //----------------------------------------------------------------------
 void FListView::setSize (const FSize& size, bool adjust)
 {
@@ -860,6 +1188,48 @@ auto FListView::isColumnHidden (int column) const -> bool
   return ! data.header[index].visible;
 }
 
+//----------------------------------------------------------------------
+void FListView::setModel (std::shared_ptr<FListViewModel> model)
+{
+  // The rows of the model replace the inserted items
+
+  if ( ! model )
+  {
+    unsetModel();
+    return;
+  }
+
+  // Delete the inserted items
+  auto items = std::move(data.itemlist);
+  data.itemlist.clear();
+
+  for (auto&& item : items)
+  {
+    delChild(item);
+    delete item;
+  }
+
+  selection.current_iter = getNullIterator();
+  scroll.first_visible_line = getNullIterator();
+  scroll.last_visible_line = getNullIterator();
+  model_view.model = std::move(model);
+  model_view.rows = std::make_unique<ModelRows>(model_view.model.get());
+  resetModel();
+}
+
+//----------------------------------------------------------------------
+void FListView::unsetModel()
+{
+  if ( ! hasModel() )
+    return;
+
+  model_view.model.reset();
+  model_view.rows.reset();
+  model_view.current_row = 0;
+  model_view.first_row = 0;
+  clear();
+}
+
 //----------------------------------------------------------------------
 auto FListView::addColumn (const FString& label, int width) -> int
 {
@@ -899,7 +1269,7 @@ auto FListView::removeColumn (int column) -> int
   {
     const auto& item = static_cast<FListViewItem*>(*iter);
     item->column_list.erase (item->column_list.begin() + column - 1);
-    std::size_t line_width = determineLineWidth (item);
+    std::size_t line_width = determineLineWidth (item->column_list);
     recalculateHorizontalBar (line_width);
     ++iter;
   }
@@ -939,7 +1309,8 @@ auto FListView::insert ( FListViewItem* item
 {
   iterator item_iter;
 
-  if ( parent_iter == getNullIterator() )
+  // A list view with a model has no items
+  if ( parent_iter == getNullIterator() || hasModel() )
     return getNullIterator();
 
   beforeInsertion(item);  // preprocessing
@@ -1001,6 +1372,32 @@ void FListView::clear()
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FListView::resetModel()
+{
+  // Reads the model again after its rows have changed.
+  // All rows are collapsed.
+
+  if ( ! hasModel() )
+    return;
+
+  model_view.rows->reset();
+  model_view.current_row = 0;
+  model_view.first_row = 0;
+  scroll.first_line_position_before = -1;
+  scroll.xoffset = 0;
+  recalculateVerticalBar (getCount());
+  scroll.vbar->setValue(0);
+  scroll.hbar->setValue(0);
+
+  if ( isItemListEmpty() )
+    clearList();
+  else if ( isShown() )
+    draw();
+
+  processChanged();
+}
+
 //----------------------------------------------------------------------
 void FListView::sort()
 {
@@ -1009,35 +1406,64 @@ void FListView::sort()
   if ( sorting.column < 1 || sorting.column > int(data.header.size()) )
     return;
 
-  SortType column_sort_type = getColumnSortType(sorting.column);
-  std::function<bool(const FObject*, const FObject*)> comparator;
+  const int column = sorting.column;
+  const bool ascending = sorting.order == SortOrder::Ascending;
+  SortType column_sort_type = getColumnSortType(column);
+
+  if ( hasModel() )
+  {
+    // The model sorts its rows, the expanded rows are collapsed
+    model_view.model->sort (column, column_sort_type, sorting.order);
+    resetModel();
+    return;
+  }
 
   switch ( column_sort_type )
   {
     case SortType::Unknown:
     case SortType::Name:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? sortAscendingByName
-                 : sortDescendingByName;
+    {
+      const auto get_key = [column] (const FListViewItem* item)
+      {
+        return caseFoldedString(item->getText(column));
+      };
+
+      if ( ascending )
+        sortByKey (get_key, std::less<std::wstring>());
+      else
+        sortByKey (get_key, std::greater<std::wstring>());
+
       break;
+    }
 
     case SortType::Number:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? sortAscendingByNumber
-                 : sortDescendingByNumber;
+    {
+      const auto get_key = [column] (const FListViewItem* item)
+      {
+        return firstNumberFromString(item->getText(column));
+      };
+
+      if ( ascending )
+        sortByKey (get_key, std::less<uInt64>());
+      else
+        sortByKey (get_key, std::greater<uInt64>());
+
       break;
+    }
 
     case SortType::UserDefined:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? user_defined_ascending
-                 : user_defined_descending;
+    {
+      std::function<bool(const FObject*, const FObject*)> comparator;
+      comparator = ascending ? user_defined_ascending
+                             : user_defined_descending;
+      sort(std::move(comparator));
       break;
+    }
 
     default:
       throw std::invalid_argument{"Invalid sort type"};
   }
 
-  sort(std::move(comparator));
   selection.current_iter = data.itemlist.begin();
   scroll.first_visible_line = data.itemlist.begin();
   processChanged();
@@ -1046,19 +1472,19 @@ void FListView::sort()
 //----------------------------------------------------------------------
 void FListView::onKeyPress (FKeyEvent* ev)
 {
-  const int position_before = selection.current_iter.getPosition();
+  const int position_before = getCurrentLinePosition();
   const int xoffset_before = scroll.xoffset;
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  scroll.first_line_position_before = getFirstLinePosition();
   selection.clicked_expander_pos.setPoint(-1, -1);
   processKeyAction(ev);  // Process the keystrokes
 
-  if ( position_before != selection.current_iter.getPosition() )
+  if ( position_before != getCurrentLinePosition() )
     processRowChanged();
 
   if ( ev->isAccepted() )
   {
     const bool draw_vbar( scroll.first_line_position_before
-                       != scroll.first_visible_line.getPosition() );
+                       != getFirstLinePosition() );
     const bool draw_hbar(xoffset_before != scroll.xoffset);
     updateDrawing (draw_vbar, draw_hbar);
   }
@@ -1074,7 +1500,7 @@ void FListView::onMouseDown (FMouseEvent* ev)
   }
 
   setWidgetFocus(this);
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  scroll.first_line_position_before = getFirstLinePosition();
 
   if ( isWithinHeaderBounds(ev->getPos()) )
   {
@@ -1130,11 +1556,11 @@ void FListView::onMouseMove (FMouseEvent* ev)
   }
 
   const int mouse_y = ev->getY();
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  scroll.first_line_position_before = getFirstLinePosition();
 
   if ( isWithinListBounds(ev->getPos()) )
   {
-    const int new_pos = scroll.first_visible_line.getPosition() + mouse_y - 2;
+    const int new_pos = getFirstLinePosition() + mouse_y - 2;
 
     if ( new_pos < int(getCount()) )
       setRelativePosition (mouse_y - 2);
@@ -1142,9 +1568,9 @@ void FListView::onMouseMove (FMouseEvent* ev)
     if ( isShown() )
       drawList();
 
-    scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+    scroll.vbar->setValue (getFirstLinePosition());
 
-    if ( scroll.first_line_position_before != scroll.first_visible_line.getPosition() )
+    if ( scroll.first_line_position_before != getFirstLinePosition() )
       scroll.vbar->drawBar();
 
     forceTerminalUpdate();
@@ -1167,17 +1593,15 @@ void FListView::onMouseDoubleClick (FMouseEvent* ev)
 
   if ( isWithinListBounds(ev->getPos()) )
   {
-    if ( scroll.first_visible_line.getPosition() + ev->getY() - 1 > int(getCount()) )
+    if ( getFirstLinePosition() + ev->getY() - 1 > int(getCount()) )
       return;
 
     if ( isItemListEmpty() )
       return;
 
-    auto item = getCurrentItem();
-
-    if ( isTreeView() && item->isExpandable() )
+    if ( isTreeView() && getCurrentLineState().expandable )
     {
-      toggleItemExpandState(item);
+      toggleCurrentExpandState();
       adjustScrollbars (getCount());  // after expand or collapse
 
       if ( isShown() )
@@ -1193,8 +1617,8 @@ void FListView::onMouseDoubleClick (FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::onTimer (FTimerEvent*)
 {
-  const int position_before = selection.current_iter.getPosition();
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  const int position_before = getCurrentLinePosition();
+  scroll.first_line_position_before = getFirstLinePosition();
 
   if ( ( drag_scroll == DragScrollMode::Upward
       || drag_scroll == DragScrollMode::SelectUpward )
@@ -1213,9 +1637,9 @@ void FListView::onTimer (FTimerEvent*)
   if ( isShown() )
     drawList();
 
-  scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+  scroll.vbar->setValue (getFirstLinePosition());
 
-  if ( scroll.first_line_position_before != scroll.first_visible_line.getPosition() )
+  if ( scroll.first_line_position_before != getFirstLinePosition() )
     scroll.vbar->drawBar();
 
   forceTerminalUpdate();
@@ -1224,10 +1648,10 @@ void FListView::onTimer (FTimerEvent*)
 //----------------------------------------------------------------------
 void FListView::onWheel (FWheelEvent* ev)
 {
-  const int position_before = selection.current_iter.getPosition();
+  const int position_before = getCurrentLinePosition();
   static constexpr int wheel_distance = 4;
   const auto& wheel = ev->getWheel();
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  scroll.first_line_position_before = getFirstLinePosition();
 
   if ( isDragging(drag_scroll) )
     stopDragScroll();
@@ -1241,15 +1665,15 @@ void FListView::onWheel (FWheelEvent* ev)
   else if ( wheel == MouseWheel::Right )
     wheelRight (wheel_distance);
 
-  if ( position_before != selection.current_iter.getPosition() )
+  if ( position_before != getCurrentLinePosition() )
     processRowChanged();
 
   if ( isShown() )
     drawList();
 
-  scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+  scroll.vbar->setValue (getFirstLinePosition());
 
-  if ( scroll.first_line_position_before != scroll.first_visible_line.getPosition() )
+  if ( scroll.first_line_position_before != getFirstLinePosition() )
     scroll.vbar->drawBar();
 
   forceTerminalUpdate();
@@ -1282,6 +1706,12 @@ void FListView::adjustViewport (const int element_count)
   if ( height <= 0 || element_count == 0 )
     return;
 
+  if ( hasModel() )
+  {
+    setModelPosition (model_view.current_row, model_view.first_row);
+    return;
+  }
+
   if ( element_count < height )
   {
     scroll.first_visible_line = data.itemlist.begin();
@@ -1356,6 +1786,45 @@ auto FListView::getNullIterator() -> FObject::iterator&
   return null_iter;
 }
 
+//----------------------------------------------------------------------
+auto FListView::getCurrentLinePosition() -> int
+{
+  if ( hasModel() )
+    return model_view.current_row;
+
+  return selection.current_iter.getPosition();
+}
+
+//----------------------------------------------------------------------
+auto FListView::getFirstLinePosition() -> int
+{
+  if ( hasModel() )
+    return model_view.first_row;
+
+  return scroll.first_visible_line.getPosition();
+}
+
+//----------------------------------------------------------------------
+auto FListView::getCurrentLineState() -> LineState
+{
+  if ( hasModel() )
+    return getModelRow(model_view.current_row).state;
+
+  return getLineState(getCurrentItem());
+}
+
+//----------------------------------------------------------------------
+auto FListView::getLineState (const FListViewItem* item) -> LineState
+{
+  LineState line_state{};
+  line_state.depth = item->getDepth();
+  line_state.expandable = item->isExpandable();
+  line_state.expanded = item->isExpand();
+  line_state.checkable = item->isCheckable();
+  line_state.checked = item->isChecked();
+  return line_state;
+}
+
 //----------------------------------------------------------------------
 void FListView::setNullIterator (const iterator& null_iter)
 {
@@ -1437,6 +1906,18 @@ void FListView::sort (Compare cmp)
     static_cast<FListViewItem*>(item)->sort(cmp);
 }
 
+//----------------------------------------------------------------------
+template <typename KeyFunc, typename Compare>
+void FListView::sortByKey (KeyFunc get_key, Compare cmp)
+{
+  // Sort the top level
+  sortListByKey (data.itemlist, get_key, cmp);
+
+  // Sort the sublevels
+  for (auto&& item : data.itemlist)
+    static_cast<FListViewItem*>(item)->sortByKey(get_key, cmp);
+}
+
 //----------------------------------------------------------------------
 auto FListView::getAlignOffset ( const Align align
                                , const std::size_t column_width
@@ -1557,6 +2038,12 @@ void FListView::drawHeadlines()
 //----------------------------------------------------------------------
 void FListView::drawList()
 {
+  if ( hasModel() )
+  {
+    drawModelList();
+    return;
+  }
+
   if ( canSkipListDrawing() )
     return;
 
@@ -1570,14 +2057,16 @@ void FListView::drawList()
   {
     const auto is_current_line = bool( iter == selection.current_iter );
     const auto& item = static_cast<FListViewItem*>(*iter);
+    const auto line_state = getLineState(item);
     path_end = getListEnd(item);
     print() << FPoint{2, 2 + y};
 
     // Draw one FListViewItem
-    drawListLine (item, getFlags().focus.focus, is_current_line);
+    drawListLine ( item->column_list, line_state
+                 , getFlags().focus.focus, is_current_line );
 
     // Place the input cursor at the beginning of the line
-    setInputCursor (item, y, is_current_line);
+    setInputCursor (line_state, y, is_current_line);
 
     scroll.last_visible_line = iter;
     y++;
@@ -1588,20 +2077,56 @@ void FListView::drawList()
 }
 
 //----------------------------------------------------------------------
-inline void FListView::setInputCursor ( const FListViewItem* item
+void FListView::drawModelList()
+{
+  if ( canSkipListDrawing() )
+    return;
+
+  const auto page_height = int(getHeight()) - 2;
+  const int first = model_view.first_row;
+  const int last = std::min(first + page_height, int(getCount()));
+  const std::size_t line_width_before = max_line_width;
+
+  // Request the visible rows first, so that all lines
+  // are drawn with the final column widths
+  for (auto row = first; row < last; row++)
+    getModelRow(row);
+
+  if ( max_line_width != line_width_before )
+    drawHeadlines();
+
+  int y{0};
+
+  for (auto row = first; row < last; row++)
+  {
+    const auto is_current_line = bool( row == model_view.current_row );
+    const auto& line = getModelRow(row);
+    print() << FPoint{2, 2 + y};
+    drawListLine ( line.columns, line.state
+                 , getFlags().focus.focus, is_current_line );
+    setInputCursor (line.state, y, is_current_line);
+    y++;
+  }
+
+  model_view.rows->trimCache (std::size_t(first), std::size_t(page_height));
+  finalizeListDrawing(y);
+}
+
+//----------------------------------------------------------------------
+inline void FListView::setInputCursor ( const LineState& line_state
                                       , int y, bool is_current_line )
 {
   if ( ! (getFlags().focus.focus && is_current_line) )
     return;
 
-  const int tree_offset = isTreeView() ? int(item->getDepth() << 1u) + 1 : 0;
-  const int checkbox_offset = item->isCheckable() ? 1 : 0;
+  const int tree_offset = isTreeView() ? int(line_state.depth << 1u) + 1 : 0;
+  const int checkbox_offset = line_state.checkable ? 1 : 0;
   int xpos = 3 + tree_offset + checkbox_offset - scroll.xoffset;
 
   if ( xpos < 2 )  // Hide the cursor
     xpos = -9999;  // by moving it outside the visible area
 
-  setVisibleCursor (item->isCheckable());
+  setVisibleCursor (line_state.checkable);
   setCursorPos ({xpos, 2 + y});  // first character
 }
 
@@ -1635,7 +2160,8 @@ inline void FListView::adjustWidthForTreeView ( std::size_t& width
 }
 
 //----------------------------------------------------------------------
-void FListView::drawListLine ( const FListViewItem* item
+void FListView::drawListLine ( const FStringList& column_list
+                             , const LineState& line_state
                              , bool is_focus
                              , bool is_current )
 {
@@ -1643,23 +2169,24 @@ void FListView::drawListLine ( const FListViewItem* item
   setLineAttributes (is_current, is_focus);
 
   // Create a string that contains the columns
-  FString line = createColumnsString(item);
+  FString line = createColumnsString(column_list, line_state);
 
   // Print the entry
   printColumnsString (line);
 }
 
 //----------------------------------------------------------------------
-auto FListView::createColumnsString (const FListViewItem* item) -> FString
+auto FListView::createColumnsString ( const FStringList& column_list
+                                    , const LineState& line_state ) -> FString
 {
-  if ( item->column_list.empty() )
+  if ( column_list.empty() )
     return {};
 
   // Get prefix
-  const std::size_t indent = item->getDepth() << 1u;  // indent = 2 * depth
-  FString line{getLinePrefix (item, indent)};
+  const std::size_t indent = line_state.depth << 1u;  // indent = 2 * depth
+  FString line{getLinePrefix (line_state, indent)};
 
-  for (std::size_t col{0}; col < item->column_list.size(); )
+  for (std::size_t col{0}; col < column_list.size(); )
   {
     if ( ! data.header[col].visible )
     {
@@ -1668,7 +2195,7 @@ auto FListView::createColumnsString (const FListViewItem* item) -> FString
     }
 
     static constexpr std::size_t ellipsis_length = 2;
-    const auto& text = item->column_list[col];
+    const auto& text = column_list[col];
     auto width = std::size_t(data.header[col].width);
     const std::size_t column_width = getColumnWidth(text);
     // Increment the value of col for the column position
@@ -1678,7 +2205,7 @@ auto FListView::createColumnsString (const FListViewItem* item) -> FString
     const std::size_t align_offset = getAlignOffset (align, column_width, width);
 
     if ( isTreeView() && col == 1 )
-      adjustWidthForTreeView (width, indent, item->isCheckable());
+      adjustWidthForTreeView (width, indent, line_state.checkable);
 
     // Insert alignment spaces
     if ( align_offset > 0 )
@@ -1797,20 +2324,20 @@ inline void FListView::setLineAttributes ( bool is_current
 }
 
 //----------------------------------------------------------------------
-inline auto FListView::getCheckBox (const FListViewItem* item) const -> FString
+inline auto FListView::getCheckBox (const LineState& line_state) const -> FString
 {
   FString checkbox{""};
 
   if ( FVTerm::getFOutput()->isNewFont() )
   {
-    checkbox = ( item->isChecked() ) ? CHECKBOX_ON : CHECKBOX;
+    checkbox = ( line_state.checked ) ? CHECKBOX_ON : CHECKBOX;
     checkbox += L' ';
   }
   else
   {
     checkbox.setString("[ ] ");
 
-    if ( item->isChecked() )
+    if ( line_state.checked )
     {
       try
       {
@@ -1827,7 +2354,7 @@ inline auto FListView::getCheckBox (const FListViewItem* item) const -> FString
 }
 
 //----------------------------------------------------------------------
-inline auto FListView::getLinePrefix ( const FListViewItem* item
+inline auto FListView::getLinePrefix ( const LineState& line_state
                                      , std::size_t indent ) const -> FString
 {
   FString line{""};
@@ -1837,9 +2364,9 @@ inline auto FListView::getLinePrefix ( const FListViewItem* item
     if ( indent > 0 )
       line = FString{indent, L' '};
 
-    if ( item->isExpandable()  )
+    if ( line_state.expandable )
     {
-      if ( item->isExpand() )
+      if ( line_state.expanded )
       {
         line += UniChar::BlackDownPointingTriangle;  // ▼
         line += L' ';
@@ -1856,8 +2383,8 @@ inline auto FListView::getLinePrefix ( const FListViewItem* item
   else
     line.setString(" ");
 
-  if ( item->isCheckable() )
-    line += getCheckBox(item);
+  if ( line_state.checkable )
+    line += getCheckBox(line_state);
 
   return line;
 }
@@ -2072,12 +2599,16 @@ void FListView::updateLayout()
 {
   max_line_width = 0;
   scroll.xoffset = 0;
+
+  if ( hasModel() )
+    model_view.rows->clearCache();  // Column widths of the next drawing
+
   std::for_each ( data.itemlist.begin()
                 , data.itemlist.end()
                 , [this] (FObject* obj_item)
                   {
                     const auto& item = static_cast<FListViewItem*>(obj_item);
-                    std::size_t line_width = determineLineWidth (item);
+                    std::size_t line_width = determineLineWidth (item->column_list);
                     recalculateHorizontalBar (line_width);
                   }
                 );
@@ -2094,7 +2625,7 @@ void FListView::updateDrawing (bool draw_vbar, bool draw_hbar)
   if ( isShown() )
     draw();
 
-  scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+  scroll.vbar->setValue (getFirstLinePosition());
 
   if ( draw_vbar )
     scroll.vbar->drawBar();
@@ -2108,12 +2639,12 @@ void FListView::updateDrawing (bool draw_vbar, bool draw_hbar)
 }
 
 //----------------------------------------------------------------------
-auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
+auto FListView::determineLineWidth (const FStringList& column_list) -> std::size_t
 {
   std::size_t padding_space = 1;
   std::size_t line_width = padding_space;  // leading space
   std::size_t column_idx{0};
-  const auto entries = std::size_t(item->column_list.size());
+  const auto entries = std::size_t(column_list.size());
 
   if ( hasCheckableItems() )
     line_width += checkbox_space;
@@ -2128,7 +2659,7 @@ auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
       std::size_t len{0};
 
       if ( column_idx < entries )
-        len = getColumnWidth(item->column_list[column_idx]);
+        len = getColumnWidth(column_list[column_idx]);
 
       if ( len > width )
         header_item.width = int(len);
@@ -2150,7 +2681,7 @@ auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
 //----------------------------------------------------------------------
 inline void FListView::beforeInsertion (FListViewItem* item)
 {
-  std::size_t line_width = determineLineWidth (item);
+  std::size_t line_width = determineLineWidth (item->column_list);
   recalculateHorizontalBar (line_width);
 }
 
@@ -2339,14 +2870,12 @@ void FListView::mouseHeaderClicked()
 //----------------------------------------------------------------------
 void FListView::handleTreeExpanderClick (const FMouseEvent* ev)
 {
-  const auto& item = getCurrentItem();
-
   if ( ! isTreeView()
-    || ! item->isExpandable()
+    || ! getCurrentLineState().expandable
     || selection.clicked_expander_pos != ev->getPos() )
     return;
 
-  toggleItemExpandState(item);
+  toggleCurrentExpandState();
   adjustScrollbars (getCount());
 
   if ( isShown() )
@@ -2356,6 +2885,9 @@ void FListView::handleTreeExpanderClick (const FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::handleCheckboxClick (const FMouseEvent* ev)
 {
+  if ( hasModel() )  // The rows of a model have no checkbox
+    return;
+
   const auto& item = getCurrentItem();
   int indent = isTreeView() ? int(item->getDepth() << 1u)  // indent = 2 * depth
                             : 0;
@@ -2374,6 +2906,14 @@ void FListView::handleCheckboxClick (const FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::wheelUp (int pagesize)
 {
+  if ( hasModel() )
+  {
+    const int distance = std::min(pagesize, model_view.first_row);
+    setModelPosition ( model_view.current_row - distance
+                     , model_view.first_row - distance );
+    return;
+  }
+
   if ( isItemListEmpty() || selection.current_iter.getPosition() == 0 )
     return;
 
@@ -2403,6 +2943,16 @@ void FListView::wheelDown (int pagesize)
 
   const auto element_count = int(getCount());
 
+  if ( hasModel() )
+  {
+    const int last = std::min ( model_view.first_row + int(getClientHeight())
+                              , element_count ) - 1;
+    const int distance = std::max(0, std::min(pagesize, element_count - last - 1));
+    setModelPosition ( model_view.current_row + distance
+                     , model_view.first_row + distance );
+    return;
+  }
+
   if ( selection.current_iter.getPosition() + 1 == element_count )
     return;
 
@@ -2483,7 +3033,7 @@ void FListView::dragUp (MouseButton mouse_button)
     && scroll.distance < int(getClientHeight()) )
     scroll.distance++;
 
-  if ( ! scroll.timer && selection.current_iter.getPosition() > 0 )
+  if ( ! scroll.timer && getCurrentLinePosition() > 0 )
   {
     scroll.timer = true;
     addTimer(scroll.repeat);
@@ -2494,7 +3044,7 @@ void FListView::dragUp (MouseButton mouse_button)
       drag_scroll = DragScrollMode::Upward;
   }
 
-  if ( selection.current_iter.getPosition() == 0 )
+  if ( getCurrentLinePosition() == 0 )
   {
     delOwnTimers();
     drag_scroll = DragScrollMode::None;
@@ -2508,7 +3058,7 @@ void FListView::dragDown (MouseButton mouse_button)
     && scroll.distance < int(getClientHeight()) )
     scroll.distance++;
 
-  if ( ! scroll.timer && selection.current_iter.getPosition() <= int(getCount()) )
+  if ( ! scroll.timer && getCurrentLinePosition() <= int(getCount()) )
   {
     scroll.timer = true;
     addTimer(scroll.repeat);
@@ -2519,7 +3069,7 @@ void FListView::dragDown (MouseButton mouse_button)
       drag_scroll = DragScrollMode::Downward;
   }
 
-  if ( selection.current_iter.getPosition() - 1 == int(getCount()) )
+  if ( getCurrentLinePosition() - 1 == int(getCount()) )
   {
     delOwnTimers();
     drag_scroll = DragScrollMode::None;
@@ -2544,6 +3094,19 @@ inline void FListView::toggleItemExpandState (FListViewItem* item) const
     item->expand();
 }
 
+//----------------------------------------------------------------------
+void FListView::toggleCurrentExpandState()
+{
+  if ( ! hasModel() )
+  {
+    toggleItemExpandState (getCurrentItem());
+    return;
+  }
+
+  if ( ! expandModelRow() )
+    collapseModelRow();
+}
+
 //----------------------------------------------------------------------
 inline auto FListView::isCheckboxClicked (int mouse_x, int indent) const -> bool
 {
@@ -2592,18 +3155,18 @@ auto FListView::appendItem (FListViewItem* item) -> FObject::iterator
 void FListView::handleListEvent (const FMouseEvent* ev)
 {
   int indent = 0;
-  const int new_pos = scroll.first_visible_line.getPosition() + ev->getY() - 2;
+  const int new_pos = getFirstLinePosition() + ev->getY() - 2;
 
   if ( new_pos < int(getCount()) )
     setRelativePosition (ev->getY() - 2);
 
-  const auto& item = getCurrentItem();
+  const auto line_state = getCurrentLineState();
 
   if ( isTreeView() )  // Handle tree view events
   {
-    indent = int(item->getDepth() << 1u);  // indent = 2 * depth
+    indent = int(line_state.depth << 1u);  // indent = 2 * depth
 
-    if ( item->isExpandable() && ev->getX() - 2 == indent - scroll.xoffset )
+    if ( line_state.expandable && ev->getX() - 2 == indent - scroll.xoffset )
       selection.clicked_expander_pos = ev->getPos();
   }
 
@@ -2612,9 +3175,9 @@ void FListView::handleListEvent (const FMouseEvent* ev)
     if ( isTreeView() )
       indent++;  // Plus one space
 
-    if ( item->isCheckable() && isCheckboxClicked(ev->getX(), indent) )
+    if ( line_state.checkable && isCheckboxClicked(ev->getX(), indent) )
     {
-      selection.clicked_checkbox_item = item;
+      selection.clicked_checkbox_item = getCurrentItem();
     }
   }
 
@@ -2622,9 +3185,9 @@ void FListView::handleListEvent (const FMouseEvent* ev)
   if ( isShown() )
     drawList();
 
-  scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+  scroll.vbar->setValue (getFirstLinePosition());
 
-  if ( scroll.first_line_position_before != scroll.first_visible_line.getPosition() )
+  if ( scroll.first_line_position_before != getFirstLinePosition() )
     scroll.vbar->drawBar();
 
   forceTerminalUpdate();
@@ -2669,7 +3232,7 @@ void FListView::changeOnResize() const
 //----------------------------------------------------------------------
 inline void FListView::toggleCheckbox()
 {
-  if ( isItemListEmpty() )
+  if ( isItemListEmpty() || hasModel() )
     return;
 
   const auto item = getCurrentItem();
@@ -2681,6 +3244,23 @@ inline void FListView::toggleCheckbox()
 //----------------------------------------------------------------------
 inline void FListView::collapseAndScrollLeft()
 {
+  if ( hasModel() )
+  {
+    if ( scroll.xoffset > 0 )  // Scroll left
+      scroll.xoffset--;
+    else if ( collapseModelRow() )
+    {
+      adjustSize();
+      scroll.vbar->calculateSliderValues();
+      // Force vertical scrollbar redraw
+      scroll.first_line_position_before = -1;
+    }
+    else
+      jumpToModelParent();
+
+    return;
+  }
+
   const auto item = getCurrentItem();
 
   if ( scroll.xoffset != 0 || ! item || isItemListEmpty() )
@@ -2737,6 +3317,21 @@ inline void FListView::jumpToParentElement (const FListViewItem* item)
 inline void FListView::expandAndScrollRight()
 {
   const int xoffset_end = int(max_line_width) - int(getClientWidth());
+
+  if ( hasModel() )
+  {
+    if ( expandModelRow() )
+    {
+      adjustScrollbars (getCount());
+      // Force vertical scrollbar redraw
+      scroll.first_line_position_before = -1;
+    }
+    else if ( scroll.xoffset < xoffset_end )  // Scroll right
+      scroll.xoffset++;
+
+    return;
+  }
+
   const auto item = getCurrentItem();
 
   if ( isTreeView() && ! isItemListEmpty() && item
@@ -2765,6 +3360,12 @@ inline void FListView::firstPos()
   if ( isItemListEmpty() )
     return;
 
+  if ( hasModel() )
+  {
+    setModelPosition (0, 0);
+    return;
+  }
+
   selection.current_iter -= selection.current_iter.getPosition();
   const int difference = scroll.first_visible_line.getPosition();
   scroll.first_visible_line -= difference;
@@ -2778,6 +3379,13 @@ inline void FListView::lastPos()
     return;
 
   const auto element_count = int(getCount());
+
+  if ( hasModel() )
+  {
+    setModelPosition (element_count - 1, element_count - 1);
+    return;
+  }
+
   selection.current_iter += element_count - selection.current_iter.getPosition() - 1;
   const int difference = element_count - scroll.last_visible_line.getPosition() - 1;
   scroll.first_visible_line += difference;
@@ -2790,6 +3398,15 @@ inline auto FListView::expandSubtree() -> bool
   if ( isItemListEmpty() )
     return false;
 
+  if ( hasModel() )
+  {
+    if ( ! expandModelRow() )
+      return false;
+
+    adjustScrollbars (getCount());
+    return true;
+  }
+
   auto item = getCurrentItem();
 
   if ( isTreeView() && item->isExpandable() && ! item->isExpand() )
@@ -2808,6 +3425,15 @@ inline auto FListView::collapseSubtree() -> bool
   if ( isItemListEmpty() )
     return false;
 
+  if ( hasModel() )
+  {
+    if ( ! collapseModelRow() )
+      return false;
+
+    adjustScrollbars (getCount());
+    return true;
+  }
+
   auto item = getCurrentItem();
 
   if ( isTreeView() && item->isExpandable() && item->isExpand() )
@@ -2823,6 +3449,12 @@ inline auto FListView::collapseSubtree() -> bool
 //----------------------------------------------------------------------
 void FListView::setRelativePosition (int ry)
 {
+  if ( hasModel() )
+  {
+    setModelPosition (model_view.first_row + ry, model_view.first_row);
+    return;
+  }
+
   selection.current_iter = scroll.first_visible_line + ry;
 }
 
@@ -2832,6 +3464,12 @@ void FListView::stepForward()
   if ( isItemListEmpty() )
     return;
 
+  if ( hasModel() )
+  {
+    stepForward(1);
+    return;
+  }
+
   if ( selection.current_iter == scroll.last_visible_line )
   {
     ++scroll.last_visible_line;
@@ -2854,6 +3492,12 @@ void FListView::stepBackward()
   if ( isItemListEmpty() )
     return;
 
+  if ( hasModel() )
+  {
+    stepBackward(1);
+    return;
+  }
+
   if ( selection.current_iter == scroll.first_visible_line
     && selection.current_iter != data.itemlist.begin() )
   {
@@ -2871,6 +3515,15 @@ void FListView::stepForward (int distance)
   if ( isItemListEmpty() )
     return;
 
+  if ( hasModel() )
+  {
+    const int current = model_view.current_row + distance;
+    const int last = model_view.first_row + int(getClientHeight()) - 1;
+    const int first = model_view.first_row + ( current > last ? distance : 0 );
+    setModelPosition (current, first);
+    return;
+  }
+
   const auto element_count = int(getCount());
 
   if ( selection.current_iter.getPosition() + 1 == element_count )
@@ -2904,6 +3557,15 @@ void FListView::stepForward (int distance)
 //----------------------------------------------------------------------
 void FListView::stepBackward (int distance)
 {
+  if ( hasModel() )
+  {
+    const int current = model_view.current_row - distance;
+    const int first = model_view.first_row
+                    - ( current < model_view.first_row ? distance : 0 );
+    setModelPosition (current, first);
+    return;
+  }
+
   if ( isItemListEmpty() || selection.current_iter.getPosition() == 0 )
     return;
 
@@ -2949,6 +3611,15 @@ void FListView::scrollToY (int y)
   const int pagesize = int(getClientHeight()) - 1;
   const auto element_count = int(getCount());
 
+  if ( hasModel() )
+  {
+    // Keep the relative position from the top line
+    const int ry = model_view.current_row - model_view.first_row;
+    const int first = std::max(0, std::min(y, element_count - pagesize - 1));
+    setModelPosition (first + ry, first);
+    return;
+  }
+
   if ( scroll.first_visible_line.getPosition() == y )
     return;
 
@@ -2989,6 +3660,88 @@ void FListView::scrollBy (int dx, int dy)
     stepBackward(-dy);
 }
 
+//----------------------------------------------------------------------
+auto FListView::getModelRow (int row) -> const ModelRow&
+{
+  // Requests a row from the model if it is not in the cache
+
+  const auto column_count = getColumnCount();
+  const auto* cached_line = model_view.rows->find(std::size_t(row), column_count);
+
+  if ( cached_line )
+    return *cached_line;
+
+  const auto& line = model_view.rows->fetch(std::size_t(row), column_count);
+  recalculateHorizontalBar (determineLineWidth(line.columns));
+  return line;
+}
+
+//----------------------------------------------------------------------
+void FListView::setModelPosition (int current, int first)
+{
+  // Sets the current row and the first visible row of the model view.
+  // The current row always stays in the visible area.
+
+  const auto element_count = int(getCount());
+  const int height = std::max(int(getClientHeight()), 1);
+
+  if ( element_count == 0 )
+  {
+    model_view.current_row = 0;
+    model_view.first_row = 0;
+    return;
+  }
+
+  current = std::max(0, std::min(current, element_count - 1));
+  first = std::max(0, std::min(first, element_count - height));
+
+  if ( current < first )
+    first = current;
+  else if ( current >= first + height )
+    first = current - height + 1;
+
+  model_view.current_row = current;
+  model_view.first_row = first;
+}
+
+//----------------------------------------------------------------------
+auto FListView::expandModelRow() -> bool
+{
+  if ( ! isTreeView() || isItemListEmpty() )
+    return false;
+
+  return model_view.rows->expand(std::size_t(model_view.current_row));
+}
+
+//----------------------------------------------------------------------
+auto FListView::collapseModelRow() -> bool
+{
+  if ( ! isTreeView() || isItemListEmpty() )
+    return false;
+
+  return model_view.rows->collapse(std::size_t(model_view.current_row));
+}
+
+//----------------------------------------------------------------------
+void FListView::jumpToModelParent()
+{
+  if ( ! isTreeView() || isItemListEmpty() )
+    return;
+
+  const auto parent_row = model_view.rows->getParentRow(std::size_t(model_view.current_row));
+
+  if ( parent_row == ModelRows::NOT_FOUND )
+    return;
+
+  const int distance = model_view.current_row - int(parent_row);
+  int first = model_view.first_row;
+
+  if ( int(parent_row) < scroll.first_line_position_before )
+    first -= distance;
+
+  setModelPosition (int(parent_row), first);
+}
+
 //----------------------------------------------------------------------
 inline auto FListView::getScrollBarMaxHorizontal() const noexcept -> int
 {
@@ -3016,9 +3769,9 @@ inline void FListView::updateViewAfterVBarChange (const FScrollbar::ScrollType s
   if ( scroll_type >= FScrollbar::ScrollType::StepBackward
     && scroll_type <= FScrollbar::ScrollType::PageForward )
   {
-    scroll.vbar->setValue (scroll.first_visible_line.getPosition());
+    scroll.vbar->setValue (getFirstLinePosition());
 
-    if ( scroll.first_line_position_before != scroll.first_visible_line.getPosition() )
+    if ( scroll.first_line_position_before != getFirstLinePosition() )
       scroll.vbar->drawBar();
 
     forceTerminalUpdate();
@@ -3052,7 +3805,7 @@ void FListView::cb_vbarChange (const FWidget*)
   const FScrollbar::ScrollType scroll_type = scroll.vbar->getScrollType();
   static constexpr int wheel_distance = 4;
   int distance{1};
-  scroll.first_line_position_before = scroll.first_visible_line.getPosition();
+  scroll.first_line_position_before = getFirstLinePosition();
 
   switch ( scroll_type )
   {
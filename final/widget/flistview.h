@@ -36,8 +36,12 @@
  *            ▲                     ▲
  *            │                     │
  *      ▕▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▏
- *      ▕ FListView ▏- - - -▕ FListViewItem ▏- - - -▕ FData ▏
- *      ▕▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▏
+ *      ▕ FListView ▏-┬- - -▕ FListViewItem ▏- - - -▕ FData ▏
+ *      ▕▁▁▁▁▁▁▁▁▁▁▁▏ :     ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▏
+ *                    :
+ *                    :      1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                    └- - - -▕ FListViewModel ▏
+ *                            ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
  */
 
 #ifndef FLISTVIEW_H
@@ -127,6 +131,8 @@ class FListViewItem : public FObject
     // Methods
     template <typename Compare>
     void sort (Compare);
+    template <typename KeyFunc, typename Compare>
+    void sortByKey (KeyFunc, Compare);
     auto appendItem (FListViewItem*) -> iterator;
     void replaceControlCodes();
     auto getVisibleLines() -> std::size_t;
@@ -306,6 +312,69 @@ inline auto FListViewIterator::getPosition() -> int&
 { return position; }
 
 
+//----------------------------------------------------------------------
+// class FListViewModel
+//----------------------------------------------------------------------
+
+// A data model supplies the rows of a FListView on demand. The list
+// view only requests the rows that are visible (plus a small cache),
+// so a model can provide millions of rows without any FListViewItem.
+// A node is an opaque id chosen by the model, ROOT is the invisible
+// parent of the top-level rows. Columns are numbered from 1. After
+// changing its rows, the owner calls FListView::resetModel().
+
+class FListViewModel
+{
+  public:
+    // Using-declaration
+    using Node = uInt64;
+
+    // Constants
+    static constexpr Node ROOT{0};
+
+    // Constructor
+    FListViewModel() = default;
+
+    // Destructor
+    virtual ~FListViewModel() noexcept;
+
+    // Accessors
+    virtual auto getClassName() const -> FString;
+    virtual auto getChildCount (Node) const -> std::size_t = 0;
+    virtual auto getChild (Node, std::size_t) const -> Node = 0;
+    virtual auto getText (Node, int) const -> FString = 0;
+
+    // Inquiry
+    virtual auto isExpandable (Node) const -> bool;
+
+    // Methods
+    virtual void expand (Node);
+    virtual void collapse (Node);
+    virtual void sort (int, SortType, SortOrder);
+};
+
+// FListViewModel inline functions
+//----------------------------------------------------------------------
+inline auto FListViewModel::getClassName() const -> FString
+{ return "FListViewModel"; }
+
+//----------------------------------------------------------------------
+inline auto FListViewModel::isExpandable (Node node) const -> bool
+{ return getChildCount(node) > 0; }
+
+//----------------------------------------------------------------------
+inline void FListViewModel::expand (Node)
+{ }
+
+//----------------------------------------------------------------------
+inline void FListViewModel::collapse (Node)
+{ }
+
+//----------------------------------------------------------------------
+inline void FListViewModel::sort (int, SortType, SortOrder)
+{ }
+
+
 //----------------------------------------------------------------------
 // class FListView
 //----------------------------------------------------------------------
@@ -345,6 +414,10 @@ class FListView : public FWidget
     auto getSortOrder() const -> SortOrder;
     auto getSortColumn() const -> int;
     auto getCurrentItem() -> FListViewItem*;
+    auto getModel() const -> const std::shared_ptr<FListViewModel>&;
+    auto getCurrentNode() -> FListViewModel::Node;
+    static auto getSortThreadCount() noexcept -> std::size_t;
+    static auto getParallelSortThreshold() noexcept -> std::size_t;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
@@ -363,9 +436,14 @@ class FListView : public FWidget
     void hideColumn (int);
     void setTreeView (bool = true);
     void unsetTreeView();
+    void setModel (std::shared_ptr<FListViewModel>);
+    void unsetModel();
+    static void setSortThreadCount (std::size_t) noexcept;
+    static void setParallelSortThreshold (std::size_t) noexcept;
 
     // Inquiries
     auto isColumnHidden (int) const -> bool;
+    auto hasModel() const -> bool;
 
     // Methods
     virtual auto addColumn (const FString&, int = USE_MAX_SIZE) -> int;
@@ -399,6 +477,7 @@ class FListView : public FWidget
     void clear();
     auto getData() & -> FListViewItems&;
     auto getData() const & -> const FListViewItems&;
+    void resetModel();
 
     virtual void sort();
 
@@ -421,6 +500,7 @@ class FListView : public FWidget
 
   private:
     struct Header;  // forward declaration
+    class ModelRows;  // forward declaration
 
     // Using-declaration
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
@@ -455,6 +535,36 @@ class FListView : public FWidget
       bool       hide_sort_indicator{false};
     };
 
+    struct ModelViewState
+    {
+      // Constructor
+      ModelViewState();
+
+      // Destructor
+      ~ModelViewState();
+
+      std::shared_ptr<FListViewModel>  model{};
+      std::unique_ptr<ModelRows>       rows{};
+      int                              current_row{0};
+      int                              first_row{0};
+    };
+
+    struct LineState
+    {
+      std::size_t  depth{0};
+      bool         expandable{false};
+      bool         expanded{false};
+      bool         checkable{false};
+      bool         checked{false};
+    };
+
+    struct ModelRow
+    {
+      FListViewModel::Node  node{FListViewModel::ROOT};
+      LineState             state{};
+      FStringList           columns{};
+    };
+
     struct ScrollingState
     {
       FScrollbarPtr      vbar{nullptr};
@@ -476,6 +586,10 @@ class FListView : public FWidget
 
     // Accessors
     static auto getNullIterator() -> iterator&;
+    auto getCurrentLinePosition() -> int;
+    auto getFirstLinePosition() -> int;
+    auto getCurrentLineState() -> LineState;
+    static auto getLineState (const FListViewItem*) -> LineState;
 
     // Mutators
     static void setNullIterator (const iterator&);
@@ -491,6 +605,8 @@ class FListView : public FWidget
     void processKeyAction (FKeyEvent*);
     template <typename Compare>
     void sort (Compare);
+    template <typename KeyFunc, typename Compare>
+    void sortByKey (KeyFunc, Compare);
     auto getAlignOffset ( const Align
                         , const std::size_t
                         , const std::size_t ) const -> std::size_t;
@@ -500,16 +616,17 @@ class FListView : public FWidget
     void drawScrollbars() const;
     void drawHeadlines();
     void drawList();
-    void setInputCursor (const FListViewItem*, int, bool);
+    void drawModelList();
+    void setInputCursor (const LineState&, int, bool);
     void finalizeListDrawing (int);
     void adjustWidthForTreeView (std::size_t&, std::size_t, bool) const;
-    void drawListLine (const FListViewItem*, bool, bool);
-    auto createColumnsString (const FListViewItem*) -> FString;
+    void drawListLine (const FStringList&, const LineState&, bool, bool);
+    auto createColumnsString (const FStringList&, const LineState&) -> FString;
     void printColumnsString (FString&);
     void clearList();
     void setLineAttributes (bool, bool) const;
-    auto getCheckBox (const FListViewItem* item) const -> FString;
-    auto getLinePrefix (const FListViewItem*, std::size_t) const -> FString;
+    auto getCheckBox (const LineState&) const -> FString;
+    auto getLinePrefix (const LineState&, std::size_t) const -> FString;
     void drawSortIndicator (std::size_t&, std::size_t);
     void drawHeadlineLabel (const HeaderItems::const_iterator&);
     void drawHeaderBorder (std::size_t);
@@ -520,7 +637,7 @@ class FListView : public FWidget
                             , const FString& );
     void updateLayout();
     void updateDrawing (bool, bool);
-    auto determineLineWidth (FListViewItem*) -> std::size_t;
+    auto determineLineWidth (const FStringList&) -> std::size_t;
     void beforeInsertion (FListViewItem*);
     void afterInsertion();
     void adjustListBeforeRemoval (const FListViewItem*);
@@ -541,6 +658,7 @@ class FListView : public FWidget
     void dragDown (MouseButton);
     void stopDragScroll();
     void toggleItemExpandState (FListViewItem*) const;
+    void toggleCurrentExpandState();
     void toggleItemCheckState (FListViewItem*) const;
     auto isCheckboxClicked (int, int) const -> bool;
     void resetClickedPositions();
@@ -570,6 +688,11 @@ class FListView : public FWidget
     void scrollTo (const FPoint&);
     void scrollTo (int, int);
     void scrollBy (int, int);
+    auto getModelRow (int) -> const ModelRow&;
+    void setModelPosition (int, int);
+    auto expandModelRow() -> bool;
+    auto collapseModelRow() -> bool;
+    void jumpToModelParent();
     auto isItemListEmpty() const -> bool;
     auto isTreeView() const -> bool;
     auto isColumnIndexInvalid (int) const -> bool;
@@ -592,7 +715,10 @@ class FListView : public FWidget
     SortState       sorting{};
     ScrollingState  scroll{};
     SelectionState  selection{};
+    ModelViewState  model_view{};
     DragScrollMode  drag_scroll{DragScrollMode::None};
+    static std::size_t  sort_thread_count;  // 0 = automatic
+    static std::size_t  parallel_sort_threshold;
 
     // Function Pointer
     bool (*user_defined_ascending) (const FObject*, const FObject*){nullptr};
@@ -635,7 +761,32 @@ inline auto FListView::getSortColumn() const -> int
 
 //----------------------------------------------------------------------
 inline auto FListView::getCurrentItem() -> FListViewItem*
-{ return static_cast<FListViewItem*>(*selection.current_iter); }
+{
+  if ( hasModel() )  // The rows of a model have no items
+    return nullptr;
+
+  return static_cast<FListViewItem*>(*selection.current_iter);
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::getModel() const -> const std::shared_ptr<FListViewModel>&
+{ return model_view.model; }
+
+//----------------------------------------------------------------------
+inline auto FListView::getSortThreadCount() noexcept -> std::size_t
+{ return sort_thread_count; }
+
+//----------------------------------------------------------------------
+inline auto FListView::getParallelSortThreshold() noexcept -> std::size_t
+{ return parallel_sort_threshold; }
+
+//----------------------------------------------------------------------
+inline void FListView::setSortThreadCount (std::size_t count) noexcept
+{ sort_thread_count = count; }
+
+//----------------------------------------------------------------------
+inline void FListView::setParallelSortThreshold (std::size_t size) noexcept
+{ parallel_sort_threshold = size; }
 
 //----------------------------------------------------------------------
 template <typename Compare>
@@ -683,7 +834,7 @@ inline auto FListView::insert ( const FStringList& cols
 {
   FListViewItem* item;
 
-  if ( cols.empty() || parent_iter == getNullIterator() )
+  if ( cols.empty() || parent_iter == getNullIterator() || hasModel() )
     return getNullIterator();
 
   if ( ! *parent_iter )
@@ -818,12 +969,16 @@ inline void FListView::scrollTo (const FPoint& pos)
 
 //----------------------------------------------------------------------
 inline auto FListView::isItemListEmpty() const -> bool
-{ return data.itemlist.empty(); }
+{ return hasModel() ? getCount() == 0 : data.itemlist.empty(); }
 
 //----------------------------------------------------------------------
 inline auto FListView::isTreeView() const -> bool
 { return tree_view; }
 
+//----------------------------------------------------------------------
+inline auto FListView::hasModel() const -> bool
+{ return bool(model_view.model); }
+
 //----------------------------------------------------------------------
 inline auto FListView::isColumnIndexInvalid (int column) const -> bool
 {
@@ -705,6 +705,7 @@ void FScrollView::copy2area()
     return;
 
   auto printarea = getCurrentPrintArea();
+  const auto& vp = static_cast<const FTermArea&>(*viewport);
   const auto& area_owner = printarea->getOwner<FVTerm*>();
   const auto& area_widget = static_cast<FWidget*>(area_owner);
   const int ax = area_widget->getLeftPadding() + getX();
@@ -724,8 +725,8 @@ void FScrollView::copy2area()
 
   for (auto y{0}; y < y_end; y++)  // line loop
   {
-    // viewport character
-    const auto& vc = viewport->getFChar(dx, dy + y);
+    // viewport character (reading does not allocate viewport tiles)
+    const auto& vc = vp.getFChar(dx, dy + y);
     // area character
     auto& ac = printarea->getFChar(ax, ay + y);
     std::memcpy (&ac, &vc, sizeof(FChar) * unsigned(x_end));
@@ -789,10 +790,11 @@ void FScrollView::init()
 //----------------------------------------------------------------------
 inline void FScrollView::createViewport (const FSize& size) noexcept
 {
-  // Initialization of the scrollable viewport
+  // Initialization of the scrollable viewport. Its lines are kept
+  // in tiles, so only the parts that have been drawn use memory.
 
   scroll_geometry.setSize(size);
-  viewport = createArea(scroll_geometry);
+  viewport = createTiledArea(scroll_geometry);
   setColor();
   FScrollView::clearArea();
 }
@@ -185,6 +185,15 @@ void FSpinBox::onKeyPress (FKeyEvent* ev)
     updateInputField();
 }
 
+//----------------------------------------------------------------------
+void FSpinBox::onPaste (FPasteEvent* ev)
+{
+  if ( ! isEnabled() )
+    return;
+
+  input_field.onPaste(ev);
+}
+
 //----------------------------------------------------------------------
 void FSpinBox::onMouseDown (FMouseEvent* ev)
 {
@@ -314,7 +323,7 @@ void FSpinBox::init()
   label->setForegroundColor (parent_widget->getForegroundColor());
   label->setBackgroundColor (parent_widget->getBackgroundColor());
   input_field.setLabelAssociatedWidget(this);
-  input_field.setInputFilter("[-[:digit:]]");  // Only numbers
+  input_field.setInputFilter (FLineEdit::CharClass::Digit, L"-");  // Only numbers
   input_field.setAlignment (Align::Right);
   input_field.unsetShadow();
   input_field << value;
@@ -438,8 +447,9 @@ void FSpinBox::cb_inputFieldChange (const FLineEdit& lineedit)
     value = 0;
   else
   {
+    // The regular expression is compiled only once
+    static const std::wregex regex{LR"([-]?[[:xdigit:]]+)"};
     std::wsmatch match;
-    const auto& regex = std::wregex(LR"([-]?[[:xdigit:]]+)");
     const auto& text = lineedit.getText().toWString();
 
     if ( std::regex_search(text, match, regex) )
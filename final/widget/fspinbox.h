@@ -107,6 +107,7 @@ class FSpinBox : public FWidget
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onPaste (FPasteEvent*) override;
     void onMouseDown (FMouseEvent*) override;
     void onMouseUp (FMouseEvent*) override;
     void onWheel (FWheelEvent*) override;
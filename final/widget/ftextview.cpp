@@ -20,7 +20,19 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cwchar>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
 #include "final/dialog/fdialog.h"
 #include "final/fapplication.h"
@@ -36,6 +48,266 @@
 namespace finalcut
 {
 
+//----------------------------------------------------------------------
+// class FTextView::MappedText
+//----------------------------------------------------------------------
+
+// A read-only memory mapping of a text file. A background thread
+// counts the lines and stores the offset of every 64th line, so a
+// line is found by a short forward search from its checkpoint.
+// Decoded lines are cached around the visible area.
+
+class FTextView::MappedText
+{
+  public:
+    // Constants
+    static constexpr std::size_t LINES_PER_CHECKPOINT{64};
+    static constexpr std::size_t INDEX_CHUNK_SIZE{1024 * 1024};
+
+    // Constructor
+    MappedText (const char* addr, std::size_t length, int tab)
+      : text{addr}
+      , size{length}
+      , tabstop{tab}
+    {
+      if ( size > 0 )
+        checkpoints.push_back(0);
+
+      indexer = std::thread([this] () { buildIndex(); });
+    }
+
+    // Disable copy constructor
+    MappedText (const MappedText&) = delete;
+
+    // Destructor
+    ~MappedText()
+    {
+      running = false;
+
+      if ( indexer.joinable() )
+        indexer.join();
+
+      if ( size > 0 )
+        ::munmap (const_cast<char*>(text), size);
+    }
+
+    // Disable copy assignment operator (=)
+    auto operator = (const MappedText&) -> MappedText& = delete;
+
+    // Accessors
+    auto getLineCount() const -> std::size_t
+    {
+      return line_count;
+    }
+
+    auto getText() const -> FString
+    {
+      return FString{decode(text, size)};
+    }
+
+    // Inquiry
+    auto isIndexed() const -> bool
+    {
+      return ! indexing;
+    }
+
+    // Methods
+    static auto map (const std::string& filename, int tab) -> MappedTextPtr
+    {
+      const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+
+      if ( fd < 0 )
+        return nullptr;
+
+      struct stat file_stat{};
+
+      if ( ::fstat(fd, &file_stat) != 0 || ! S_ISREG(file_stat.st_mode) )
+      {
+        ::close(fd);
+        return nullptr;
+      }
+
+      const auto length = std::size_t(file_stat.st_size);
+      void* addr{nullptr};
+
+      if ( length > 0 )
+        addr = ::mmap (nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      ::close(fd);  // The mapping stays valid (until the file is truncated)
+
+      if ( addr == MAP_FAILED )
+        return nullptr;
+
+      return std::make_unique<MappedText>(static_cast<const char*>(addr), length, tab);
+    }
+
+    auto find (std::size_t n) -> FTextViewLine*
+    {
+      const auto iter = cache.find(n);
+      return ( iter != cache.end() ) ? &iter->second : nullptr;
+    }
+
+    auto fetch (std::size_t n) -> FTextViewLine&
+    {
+      // Decodes line n like FTextView::processLine()
+
+      auto range = getLineRange(n);
+
+      if ( range.second > range.first && text[range.second - 1] == '\r' )
+        range.second--;  // Line ending CR LF
+
+      FString line{decode(text + range.first, range.second - range.first)};
+      line = line.expandTabs(tabstop)
+                 .removeBackspaces()
+                 .removeDel()
+                 .replaceControlCodes()
+                 .rtrim();
+      std::vector<FTextHighlight> highlight{};
+      const auto hgl_iter = highlights.find(n);
+
+      if ( hgl_iter != highlights.end() )
+        highlight = hgl_iter->second;
+
+      cache.erase(n);
+      return cache.emplace(n, FTextViewLine{std::move(line), std::move(highlight)})
+                  .first->second;
+    }
+
+    void addHighlight (std::size_t n, const FTextHighlight& hgl)
+    {
+      highlights[n].emplace_back(hgl);
+      auto line = find(n);
+
+      if ( line )
+        line->highlight.emplace_back(hgl);
+    }
+
+    void resetHighlight (std::size_t n)
+    {
+      highlights.erase(n);
+      auto line = find(n);
+
+      if ( line )
+        line->highlight.clear();
+    }
+
+    void trimCache (std::size_t first, std::size_t page_size)
+    {
+      trimPageCache (cache, first, page_size);
+    }
+
+  private:
+    // Accessor
+    auto getLineRange (std::size_t n) const -> std::pair<std::size_t, std::size_t>
+    {
+      std::size_t pos{};
+
+      {
+        std::lock_guard<std::mutex> lock_guard(checkpoint_mutex);
+        pos = checkpoints[n / LINES_PER_CHECKPOINT];
+      }
+
+      for (auto i = n % LINES_PER_CHECKPOINT; i > 0; i--)
+      {
+        const auto* newline = std::memchr(text + pos, '\n', size - pos);
+        pos = std::size_t(static_cast<const char*>(newline) - text) + 1;
+      }
+
+      const auto* newline = std::memchr(text + pos, '\n', size - pos);
+      const auto end = newline ? std::size_t(static_cast<const char*>(newline) - text)
+                               : size;
+      return {pos, end};
+    }
+
+    // Methods
+    void buildIndex()
+    {
+      // Runs in the indexer thread
+
+      std::vector<std::size_t> new_checkpoints{};
+      std::size_t count{0};
+      std::size_t pos{0};
+
+      while ( pos < size && running )
+      {
+        const auto chunk_end = std::min(pos + INDEX_CHUNK_SIZE, size);
+
+        while ( pos < chunk_end )
+        {
+          const auto* newline = std::memchr(text + pos, '\n', chunk_end - pos);
+
+          if ( ! newline )
+          {
+            pos = chunk_end;
+            break;
+          }
+
+          pos = std::size_t(static_cast<const char*>(newline) - text) + 1;
+          count++;
+
+          if ( count % LINES_PER_CHECKPOINT == 0 && pos < size )
+            new_checkpoints.push_back(pos);
+        }
+
+        if ( pos == size && size > 0 && text[size - 1] != '\n' )
+          count++;  // Last line without line ending
+
+        std::lock_guard<std::mutex> lock_guard(checkpoint_mutex);
+        checkpoints.insert ( checkpoints.end()
+                           , new_checkpoints.begin()
+                           , new_checkpoints.end() );
+        new_checkpoints.clear();
+        line_count = count;
+      }
+
+      indexing = false;
+    }
+
+    static auto decode (const char* str, std::size_t length) -> std::wstring
+    {
+      // Multibyte to wide character conversion that
+      // replaces invalid byte sequences
+
+      std::wstring wide_string{};
+      wide_string.reserve(length);
+      auto state = std::mbstate_t();
+      std::size_t pos{0};
+
+      while ( pos < length )
+      {
+        wchar_t wch{};
+        const auto n = std::mbrtowc(&wch, str + pos, length - pos, &state);
+
+        if ( n == std::size_t(-1) || n == std::size_t(-2) )
+        {
+          wide_string.push_back(L'\uFFFD');  // Replacement character
+          state = std::mbstate_t();
+          pos++;
+          continue;
+        }
+
+        wide_string.push_back(wch);
+        pos += std::max(n, std::size_t(1));  // n = 0 for a null character
+      }
+
+      return wide_string;
+    }
+
+    // Data members
+    const char*                       text;
+    const std::size_t                 size;
+    const int                         tabstop;
+    std::vector<std::size_t>          checkpoints{};
+    mutable std::mutex                checkpoint_mutex{};
+    std::atomic<std::size_t>          line_count{0};
+    std::atomic<bool>                 indexing{true};
+    std::atomic<bool>                 running{true};
+    std::thread                       indexer{};
+    std::unordered_map<std::size_t, FTextViewLine>  cache{};
+    std::unordered_map<std::size_t, std::vector<FTextHighlight>>  highlights{};
+};
+
+
 //----------------------------------------------------------------------
 // class FTextView
 //----------------------------------------------------------------------
@@ -53,12 +325,26 @@ FTextView::~FTextView() noexcept = default;  // destructor
 
 
 // public methods of FTextView
+//----------------------------------------------------------------------
+auto FTextView::getRows() const -> std::size_t
+{
+  if ( mapped_text )
+    return mapped_text->getLineCount();
+
+  return std::size_t(data.size());
+}
+
 //----------------------------------------------------------------------
 auto FTextView::getText() const -> FString
 {
+  if ( mapped_text )
+    return mapped_text->getText();
+
   if ( data.empty() )
     return {""};
 
+  normalizeLines();
+
   std::size_t len{0};
 
   for (auto&& line : data)
@@ -85,6 +371,19 @@ auto FTextView::getText() const -> FString
   return s;
 }
 
+//----------------------------------------------------------------------
+auto FTextView::getLine (FTextViewList::size_type line) -> FTextViewLine&
+{
+  if ( line >= getRows() )
+    throw std::out_of_range{"Line index out of range"};
+
+  if ( ! mapped_text )
+    return data[getDataIndex(line)];
+
+  // The reference is valid until the next drawing
+  return getMappedLine(line);
+}
+
 //----------------------------------------------------------------------
 void FTextView::setSize (const FSize& size, bool adjust)
 {
@@ -120,22 +419,66 @@ void FTextView::setText (const FString& str)
   insert(str, -1);
 }
 
+//----------------------------------------------------------------------
+void FTextView::setLineLimit (std::size_t limit)
+{
+  // Limits the number of lines (0 = unlimited). When the limit
+  // is reached, every new line replaces the oldest line.
+
+  normalizeLines();
+  line_limit = limit;
+  line_widths.clear();
+
+  if ( limit == 0 )
+    return;
+
+  if ( data.size() > limit )
+  {
+    const auto dropped = data.size() - limit;
+    data.erase (data.cbegin(), data.cbegin() + std::ptrdiff_t(dropped));
+    yoffset = std::max(0, yoffset - int(dropped));
+  }
+
+  // The width of each line is counted to keep
+  // max_line_width valid when old lines are removed
+  for (const auto& line : data)
+    line_widths[getColumnWidth(line.text)]++;
+
+  max_line_width = line_widths.empty() ? 0 : line_widths.crbegin()->first;
+  yoffset = std::min(yoffset, getScrollBarMaxVertical());
+  recalculateHorizontalScrollBar();
+  updateVerticalScrollBar();
+  vbar->setValue (yoffset);
+}
+
 //----------------------------------------------------------------------
 void FTextView::addHighlight (std::size_t line, const FTextHighlight& hgl)
 {
-  if ( line >= data.size() )
+  if ( line >= getRows() )
     return;
 
-  data[line].highlight.emplace_back(hgl);
+  if ( mapped_text )
+  {
+    mapped_text->addHighlight (line, hgl);
+    return;
+  }
+
+  data[getDataIndex(line)].highlight.emplace_back(hgl);
 }
 
 //----------------------------------------------------------------------
 void FTextView::resetHighlight (std::size_t line)
 {
-  if ( line >= data.size() )
+  if ( line >= getRows() )
+    return;
+
+  if ( mapped_text )
+  {
+    mapped_text->resetHighlight (line);
     return;
+  }
 
-  data[line].highlight.clear();
+  data[getDataIndex(line)].highlight.clear();
 }
 
 //----------------------------------------------------------------------
@@ -207,8 +550,16 @@ void FTextView::hide()
 //----------------------------------------------------------------------
 void FTextView::clear()
 {
+  if ( mapped_text )
+  {
+    stopIndexTimer();
+    mapped_text.reset();
+  }
+
   data.clear();
   data.shrink_to_fit();
+  line_widths.clear();
+  first_line = 0;
   xoffset = 0;
   yoffset = 0;
   max_line_width = 0;
@@ -257,9 +608,18 @@ void FTextView::append (const FString& str)
 //----------------------------------------------------------------------
 void FTextView::insert (const FString& str, int pos)
 {
+  if ( mapped_text )  // A mapped file is read-only
+    return;
+
   if ( pos < 0 || pos >= int(getRows()) )
     pos = int(getRows());
 
+  if ( hasLineLimit() )
+  {
+    insertBounded (str, pos);
+    return;
+  }
+
   for (auto&& line : splitTextLines(str))  // Line loop
   {
     processLine(std::move(line), pos);
@@ -288,13 +648,64 @@ void FTextView::replaceRange (const FString& str, int from, int to)
 //----------------------------------------------------------------------
 void FTextView::deleteRange (int from, int to)
 {
+  if ( mapped_text )  // A mapped file is read-only
+    return;
+
   if ( from > to || from >= int(getRows()) || to >= int(getRows()) )
     throw std::out_of_range("");  // Invalid range
 
+  normalizeLines();
   auto iter = data.cbegin();
+
+  if ( hasLineLimit() )
+  {
+    for (auto i{from}; i <= to; i++)
+      removeLineWidth (getColumnWidth(data[std::size_t(i)].text));
+
+    recalculateHorizontalScrollBar();
+  }
+
   data.erase (iter + from, iter + to + 1);
 }
 
+//----------------------------------------------------------------------
+auto FTextView::mapFile (const FString& filename) -> bool
+{
+  // Shows a file without reading it into the line list
+
+  auto text = MappedText::map (filename.toString(), getFOutput()->getTabstop());
+
+  if ( ! text )
+    return false;
+
+  clear();
+  mapped_text = std::move(text);
+  const bool indexed = mapped_text->isIndexed();
+  updateVerticalScrollBar();
+
+  if ( ! indexed )
+    index_timer_id = addTimer(INDEX_POLL_TIME);  // Shows the indexing progress
+
+  if ( isShown() )
+    drawText();
+
+  processChanged();
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTextView::unmapFile()
+{
+  if ( mapped_text )
+    clear();
+}
+
+//----------------------------------------------------------------------
+auto FTextView::isFileIndexed() const -> bool
+{
+  return mapped_text && mapped_text->isIndexed();
+}
+
 //----------------------------------------------------------------------
 void FTextView::onKeyPress (FKeyEvent* ev)
 {
@@ -307,6 +718,25 @@ void FTextView::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FTextView::onPaste (FPasteEvent* ev)
+{
+  // Appends the pasted text in one step and draws the view only once
+
+  if ( mapped_text )  // A mapped file is read-only
+    return;
+
+  const auto old_yoffset = yoffset;
+  append (ev->getText());
+  scrollToEnd();
+
+  if ( isShown() && yoffset == old_yoffset )
+    drawText();
+
+  ev->accept();
+  forceTerminalUpdate();
+}
+
 //----------------------------------------------------------------------
 void FTextView::onMouseDown (FMouseEvent* ev)
 {
@@ -354,6 +784,38 @@ void FTextView::onWheel (FWheelEvent* ev)
     drawText();
 }
 
+//----------------------------------------------------------------------
+void FTextView::onTimer (FTimerEvent* ev)
+{
+  // Updates the view while the line index of a mapped file grows
+
+  if ( ev->getTimerId() != index_timer_id )
+    return;
+
+  if ( ! mapped_text )
+  {
+    stopIndexTimer();
+    return;
+  }
+
+  const bool indexed = mapped_text->isIndexed();
+  updateVerticalScrollBar();
+
+  if ( isShown() )
+  {
+    if ( vbar->isShown() )
+      vbar->redraw();
+
+    drawText();
+  }
+
+  if ( indexed )
+  {
+    stopIndexTimer();
+    processChanged();
+  }
+}
+
 
 // protected methods of FTextView
 //----------------------------------------------------------------------
@@ -433,6 +895,19 @@ auto FTextView::getTextWidth() const -> std::size_t
   return getWidth() - 2 - std::size_t(nf_offset);
 }
 
+//----------------------------------------------------------------------
+auto FTextView::getMappedLine (std::size_t n) -> FTextViewLine&
+{
+  auto line = mapped_text->find(n);
+
+  if ( line )
+    return *line;
+
+  auto& new_line = mapped_text->fetch(n);
+  updateHorizontalScrollBar (getColumnWidth(new_line.text));
+  return new_line;
+}
+
 //----------------------------------------------------------------------
 void FTextView::init()
 {
@@ -515,6 +990,9 @@ void FTextView::drawText()
   for (std::size_t y{0}; y < num; y++)  // Line loop
     printLine (y);
 
+  if ( mapped_text )
+    mapped_text->trimCache (std::size_t(yoffset), getTextHeight());
+
   if ( FVTerm::getFOutput()->isMonochron() )
     setReverse(false);
 }
@@ -522,7 +1000,7 @@ void FTextView::drawText()
 //----------------------------------------------------------------------
 inline auto FTextView::canSkipDrawing() const -> bool
 {
-  return data.empty()
+  return getRows() == 0
       || getHeight() < 3
       || getWidth() < 3;
 }
@@ -533,7 +1011,9 @@ inline void FTextView::printLine (std::size_t y)
   const std::size_t n = std::size_t(yoffset) + y;
   const std::size_t pos = std::size_t(xoffset) + 1;
   const auto text_width = getTextWidth();
-  const FString line(getColumnSubString(data[n].text, pos, text_width));
+  const auto& text_line = mapped_text ? getMappedLine(n)
+                                      : data[getDataIndex(n)];
+  const FString line(getColumnSubString(text_line.text, pos, text_width));
   print() << FPoint{2, 2 - nf_offset + int(y)};
   FVTermBuffer line_buffer{};
   line_buffer.print(line);
@@ -550,7 +1030,7 @@ inline void FTextView::printLine (std::size_t y)
     line_buffer.print() << FString{trailing_whitespace, L' '};
   }
 
-  printHighlighted (line_buffer, data[n].highlight);
+  printHighlighted (line_buffer, text_line.highlight);
 }
 
 //----------------------------------------------------------------------
@@ -634,6 +1114,108 @@ inline void FTextView::processLine (FString&& line, int pos)
   data.emplace (data.cbegin() + pos, std::move(line));
 }
 
+//----------------------------------------------------------------------
+void FTextView::insertBounded (const FString& str, int pos)
+{
+  // Inserts lines in tail mode. Appended lines overwrite the oldest
+  // line in the ring buffer when the line limit is reached.
+
+  const bool at_bottom = yoffset >= getScrollBarMaxVertical();
+  auto index = std::size_t(pos);
+  std::size_t dropped{0};
+
+  if ( index < data.size() )
+    normalizeLines();  // Insertion before the last line
+
+  for (auto&& line : splitTextLines(str))  // Line loop
+  {
+    line = line.removeBackspaces()
+               .removeDel()
+               .replaceControlCodes()
+               .rtrim();
+    addLineWidth (getColumnWidth(line));
+
+    if ( index == data.size() && data.size() >= line_limit )
+    {
+      auto& oldest = data[first_line];
+      removeLineWidth (getColumnWidth(oldest.text));
+      oldest = FTextViewLine(std::move(line));
+      first_line = ( first_line + 1 < data.size() ) ? first_line + 1 : 0;
+      dropped++;
+      continue;
+    }
+
+    data.emplace (data.cbegin() + std::ptrdiff_t(index), std::move(line));
+    index++;
+
+    if ( data.size() > line_limit )  // Inserted before the last line
+    {
+      removeLineWidth (getColumnWidth(data.front().text));
+      data.erase (data.cbegin());
+      index--;
+      dropped++;
+    }
+  }
+
+  if ( dropped > 0 )
+    recalculateHorizontalScrollBar();
+
+  // Follows the new lines at the bottom, otherwise
+  // the visible lines stay in place
+  yoffset = at_bottom ? getScrollBarMaxVertical()
+                      : std::max(0, yoffset - int(dropped));
+  updateVerticalScrollBar();
+  vbar->setValue (yoffset);
+
+  if ( isShown() && (at_bottom || dropped > 0) )
+  {
+    if ( vbar->isShown() )
+      vbar->drawBar();
+
+    drawText();
+  }
+
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::normalizeLines() const
+{
+  // Rotates the ring buffer so that the oldest line comes first
+
+  if ( first_line == 0 )
+    return;
+
+  std::rotate ( data.begin()
+              , data.begin() + std::ptrdiff_t(first_line)
+              , data.end() );
+  first_line = 0;
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::addLineWidth (std::size_t column_width)
+{
+  line_widths[column_width]++;
+  updateHorizontalScrollBar (column_width);
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::removeLineWidth (std::size_t column_width)
+{
+  auto iter = line_widths.find(column_width);
+
+  if ( iter == line_widths.end() )
+    return;
+
+  if ( --iter->second > 0 )
+    return;
+
+  line_widths.erase(iter);
+
+  if ( column_width == max_line_width )
+    max_line_width = line_widths.empty() ? 0 : line_widths.crbegin()->first;
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::getScrollBarMaxHorizontal() const noexcept -> int
 {
@@ -687,6 +1269,22 @@ inline void FTextView::updateHorizontalScrollBar (std::size_t column_width)
     hbar->show();
 }
 
+//----------------------------------------------------------------------
+void FTextView::recalculateHorizontalScrollBar()
+{
+  // Adapts the horizontal scrollbar after max_line_width has shrunk
+
+  const auto xoffset_end = std::max(0, getScrollBarMaxHorizontal());
+  xoffset = std::min(xoffset, xoffset_end);
+  hbar->setMaximum (getScrollBarMaxHorizontal());
+  hbar->setPageSize (int(max_line_width), int(getTextWidth()));
+  hbar->setValue (xoffset);
+  hbar->calculateSliderValues();
+
+  if ( isShown() && hbar->isShown() && ! isHorizontallyScrollable() )
+    hbar->hide();
+}
+
 //----------------------------------------------------------------------
 void FTextView::processChanged() const
 {
@@ -714,6 +1312,19 @@ void FTextView::changeOnResize() const
   hbar->resize();
 }
 
+//----------------------------------------------------------------------
+void FTextView::stopIndexTimer()
+{
+  // Only the own index timer is deleted, timers that were
+  // added to the text view from outside are kept
+
+  if ( index_timer_id == 0 )
+    return;
+
+  delTimer (index_timer_id);
+  index_timer_id = 0;
+}
+
 //----------------------------------------------------------------------
 void FTextView::cb_vbarChange (const FWidget*)
 {
@@ -40,6 +40,20 @@
  *      ▕▁▁▁▁▁▁▁▁▁▁▁▏
  */
 
+// mapFile() shows a file without reading it into the line list.
+// The file is mapped read-only, a background thread builds the line
+// index, and only the lines that scroll into view are decoded (the
+// decoded lines are kept in a bounded cache). The text cannot be
+// edited while a file is mapped. The file must not be truncated
+// while it is mapped, because reading a page behind the new end of
+// the file raises SIGBUS. Replace a shown file by renaming a new
+// file over it, or call unmapFile() before changing it.
+//
+// setLineLimit() switches to a tail mode for log streaming: the lines
+// are kept in a ring buffer, and when the limit is reached, each new
+// line replaces the oldest one. The view follows new lines as long as
+// it is scrolled to the bottom.
+
 #ifndef FTEXTVIEW_H
 #define FTEXTVIEW_H
 
@@ -49,6 +63,7 @@
 
 #include <limits>
 #include <limits>
+#include <map>
 #include <memory>
 #include <memory>
 #include <string>
@@ -178,12 +193,14 @@ class FTextView : public FWidget
     auto getText() const -> FString;
     auto getLine (FTextViewList::size_type) -> FTextViewLine&;
     auto getLines() const & -> const FTextViewList&;
+    auto getLineLimit() const noexcept -> std::size_t;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
     void setGeometry (const FPoint&, const FSize&, bool = true) override;
     void resetColors() override;
     void setText (const FString&);
+    void setLineLimit (std::size_t);
     void addHighlight (std::size_t, const FTextHighlight&);
     void resetHighlight (std::size_t);
     void scrollToX (int);
@@ -194,6 +211,11 @@ class FTextView : public FWidget
     void scrollToEnd();
     void scrollBy (int, int);
 
+    // Inquiries
+    auto isFileMapped() const -> bool;
+    auto hasLineLimit() const noexcept -> bool;
+    auto isFileIndexed() const -> bool;
+
     // Methods
     void hide() override;
     void clear();
@@ -206,13 +228,17 @@ class FTextView : public FWidget
     void replaceRange (const FString&, int, int);
     void deleteRange (int, int);
     void deleteLine (int);
+    auto mapFile (const FString&) -> bool;
+    void unmapFile();
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onPaste (FPasteEvent*) override;
     void onMouseDown (FMouseEvent*) override;
     void onMouseUp (FMouseEvent*) override;
     void onMouseMove (FMouseEvent*) override;
     void onWheel (FWheelEvent*) override;
+    void onTimer (FTimerEvent*) override;
 
   protected:
     // Method
@@ -220,12 +246,22 @@ class FTextView : public FWidget
     void adjustSize() override;
 
   private:
-    // Using-declaration
+    // Forward declaration
+    class MappedText;
+
+    // Using-declarations
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
+    using MappedTextPtr = std::unique_ptr<MappedText>;
+    using WidthCount = std::map<std::size_t, std::size_t>;
+
+    // Constants
+    static constexpr int INDEX_POLL_TIME = 100;  // ms
 
     // Accessors
     auto getTextHeight() const -> std::size_t;
     auto getTextWidth() const -> std::size_t;
+    auto getMappedLine (std::size_t) -> FTextViewLine&;
+    auto getDataIndex (std::size_t) const noexcept -> std::size_t;
 
     // Inquiry
     auto isHorizontallyScrollable() const -> bool;
@@ -246,27 +282,38 @@ class FTextView : public FWidget
     auto isPrintable (wchar_t) const -> bool;
     auto splitTextLines (const FString&) const -> FStringList;
     void processLine (FString&&, int);
+    void insertBounded (const FString&, int);
+    void normalizeLines() const;
+    void addLineWidth (std::size_t);
+    void removeLineWidth (std::size_t);
     auto getScrollBarMaxHorizontal() const noexcept -> int;
     auto getScrollBarMaxVertical() const noexcept -> int;
     void updateVerticalScrollBar() const;
     void updateHorizontalScrollBar (std::size_t);
+    void recalculateHorizontalScrollBar();
     void processChanged() const;
     void changeOnResize() const;
+    void stopIndexTimer();
 
     // Callback methods
     void cb_vbarChange (const FWidget*);
     void cb_hbarChange (const FWidget*);
 
     // Data members
-    FTextViewList  data{};
-    FScrollbarPtr  vbar{nullptr};
-    FScrollbarPtr  hbar{nullptr};
-    KeyMap         key_map{};
-    bool           update_scrollbar{true};
-    int            xoffset{0};
-    int            yoffset{0};
-    int            nf_offset{0};
-    std::size_t    max_line_width{0};
+    mutable FTextViewList  data{};  // Ring buffer in tail mode
+    FScrollbarPtr          vbar{nullptr};
+    FScrollbarPtr          hbar{nullptr};
+    KeyMap                 key_map{};
+    MappedTextPtr          mapped_text{};
+    WidthCount             line_widths{};
+    bool                   update_scrollbar{true};
+    int                    xoffset{0};
+    int                    yoffset{0};
+    int                    nf_offset{0};
+    int                    index_timer_id{0};
+    std::size_t            max_line_width{0};
+    std::size_t            line_limit{0};
+    mutable std::size_t    first_line{0};  // Oldest line in tail mode
 };
 
 // FListBox inline functions
@@ -312,10 +359,6 @@ inline auto FTextView::getClassName() const -> FString
 inline auto FTextView::getColumns() const noexcept -> std::size_t
 { return max_line_width; }
 
-//----------------------------------------------------------------------
-inline auto FTextView::getRows() const -> std::size_t
-{ return std::size_t(data.size()); }
-
 //----------------------------------------------------------------------
 inline auto FTextView::getScrollPos() const -> FPoint
 { return {xoffset, yoffset}; }
@@ -325,17 +368,28 @@ inline auto FTextView::getTextVisibleSize() const -> FSize
 { return {getTextWidth(), getTextHeight()}; }
 
 //----------------------------------------------------------------------
-inline auto FTextView::getLine (FTextViewList::size_type line) -> FTextViewLine&
-{ return data.at(line); }
+inline auto FTextView::getLines() const & -> const FTextViewList&
+{
+  normalizeLines();
+  return data;
+}
 
 //----------------------------------------------------------------------
-inline auto FTextView::getLines() const & -> const FTextViewList&
-{ return data; }
+inline auto FTextView::getLineLimit() const noexcept -> std::size_t
+{ return line_limit; }
 
 //----------------------------------------------------------------------
 inline void FTextView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
 
+//----------------------------------------------------------------------
+inline auto FTextView::isFileMapped() const -> bool
+{ return bool(mapped_text); }
+
+//----------------------------------------------------------------------
+inline auto FTextView::hasLineLimit() const noexcept -> bool
+{ return line_limit > 0; }
+
 //----------------------------------------------------------------------
 template <typename T>
 void FTextView::append (const std::initializer_list<T>& list)
@@ -359,6 +413,14 @@ void FTextView::insert (const std::initializer_list<T>& list, int pos)
 inline void FTextView::deleteLine (int pos)
 { deleteRange (pos, pos); }
 
+//----------------------------------------------------------------------
+inline auto FTextView::getDataIndex (std::size_t n) const noexcept -> std::size_t
+{
+  // Maps a line number to its position in the ring buffer
+  const auto index = first_line + n;
+  return index < data.size() ? index : index - data.size();
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::isHorizontallyScrollable() const -> bool
 { return max_line_width > getTextWidth(); }
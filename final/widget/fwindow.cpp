@@ -27,6 +27,7 @@
 #include "final/input/fmouse.h"
 #include "final/menu/fmenubar.h"
 #include "final/menu/fmenu.h"
+#include "final/util/fspatialgrid.h"
 #include "final/widget/fcombobox.h"
 #include "final/widget/fstatusbar.h"
 #include "final/widget/fwindow.h"
@@ -37,12 +38,27 @@ namespace finalcut
 namespace internal
 {
 
+struct WindowHitIndex
+{
+  // Constant
+  static constexpr std::size_t MIN_WINDOWS{8};
+
+  // Data members
+  uInt64        generation{0};
+  std::size_t   size{0};  // Number of windows at build time
+  FSpatialGrid  grid{};   // Terminal geometry of the windows
+};
+
+constexpr std::size_t WindowHitIndex::MIN_WINDOWS;
+
 struct var
 {
   static bool fwindow_init_flag;  // FWindow init state
+  static WindowHitIndex window_hit_index;  // Window index for hit-testing
 };
 
 bool var::fwindow_init_flag{false};
+WindowHitIndex var::window_hit_index{};
 
 }  // namespace internal
 
@@ -451,24 +467,63 @@ auto FWindow::getWindowWidgetAt (int x, int y) -> FWindow*
 {
   // returns the window object to the corresponding coordinates
 
-  if ( ! getWindowList() || getWindowList()->empty() )
+  const auto& window_list = getWindowList();
+
+  if ( ! window_list || window_list->empty() )
     return nullptr;
 
-  auto iter = getWindowList()->cend();
-  const auto begin = getWindowList()->cbegin();
+  if ( window_list->size() < internal::WindowHitIndex::MIN_WINDOWS )
+  {
+    // A linear search is faster for a few windows
+    auto iter = window_list->crbegin();
+
+    while ( iter != window_list->crend() )
+    {
+      if ( isWindowWidgetAt(*iter, x, y) )
+        return static_cast<FWindow*>(*iter);
 
-  do
+      ++iter;
+    }
+
+    return nullptr;
+  }
+
+  // Only the windows in the grid cell of (x, y) are tested
+  auto& index = internal::var::window_hit_index;
+
+  // The generation changes when a window is moved, resized,
+  // added, removed, raised or lowered
+  if ( index.generation != getWindowGeometryGeneration()
+    || index.size != window_list->size() )
   {
-    --iter;
-    auto w = static_cast<FWindow*>(*iter);
+    index.generation = getWindowGeometryGeneration();
+    index.size = window_list->size();
+    std::vector<FRect> geometries{};
+    geometries.reserve(window_list->size());
 
-    if ( *iter && ! w->isWindowHidden()
-      && getVisibleTermGeometry(w).contains(x, y) )
+    for (auto* win : *window_list)
     {
-      return w;
+      if ( win )
+        geometries.push_back(static_cast<FWindow*>(win)->getTermGeometry());
+      else
+        geometries.emplace_back();  // Empty rectangle
     }
+
+    index.grid.build(geometries);
+  }
+
+  const auto candidates = index.grid.getCandidates(FPoint{x, y});
+  auto iter = candidates.end();
+
+  // Search from the top window downwards
+  while ( iter != candidates.begin() )
+  {
+    --iter;
+    const auto win = (*window_list)[*iter];
+
+    if ( isWindowWidgetAt(win, x, y) )
+      return static_cast<FWindow*>(win);
   }
-  while ( iter != begin );
 
   return nullptr;
 }
@@ -480,6 +535,7 @@ void FWindow::addWindow (FWidget* obj)
   if ( getWindowList() )
     getWindowList()->push_back(obj);
 
+  windowGeometryChanged();
   processAlwaysOnTop();
 }
 
@@ -497,6 +553,7 @@ void FWindow::delWindow (const FWidget* obj)
     if ( (*iter) == obj )
     {
       getWindowList()->erase(iter);
+      windowGeometryChanged();
       determineWindowLayers();
       return;
     }
@@ -561,6 +618,7 @@ auto FWindow::raiseWindow (FWidget* obj) -> bool
     {
       getWindowList()->erase (iter);
       getWindowList()->push_back (obj);
+      windowGeometryChanged();
       processAlwaysOnTop();
       FEvent ev(Event::WindowRaised);
       FApplication::sendEvent(obj, &ev);
@@ -593,6 +651,7 @@ auto FWindow::lowerWindow (FWidget* obj) -> bool
     {
       getWindowList()->erase (iter);
       getWindowList()->insert (getWindowList()->cbegin(), obj);
+      windowGeometryChanged();
       determineWindowLayers();
       FEvent ev(Event::WindowLowered);
       FApplication::sendEvent(obj, &ev);
@@ -813,6 +872,17 @@ inline auto FWindow::getVisibleTermGeometry (FWindow* win) -> FRect
   return term_geometry;
 }
 
+//----------------------------------------------------------------------
+inline auto FWindow::isWindowWidgetAt (FVTerm* obj, int x, int y) -> bool
+{
+  if ( ! obj )
+    return false;
+
+  auto win = static_cast<FWindow*>(obj);
+  return ! win->isWindowHidden()
+      && getVisibleTermGeometry(win).contains(x, y);
+}
+
 //----------------------------------------------------------------------
 void FWindow::deleteFromAlwaysOnTopList (const FWidget* obj)
 {
@@ -856,6 +926,7 @@ void FWindow::processAlwaysOnTop()
     ++iter;
   }
 
+  windowGeometryChanged();
   determineWindowLayers();
 }
 
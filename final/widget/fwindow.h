@@ -172,6 +172,7 @@ class FWindow : public FWidget
     // Methods
     void         createVWin() noexcept;
     static auto  getVisibleTermGeometry (FWindow*) -> FRect;
+    static auto  isWindowWidgetAt (FVTerm*, int, int) -> bool;
     static void  deleteFromAlwaysOnTopList (const FWidget*);
     static void  processAlwaysOnTop();
     static auto  getWindowWidgetImpl (FWidget*) -> FWindow*;
@@ -952,6 +952,17 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
       write (fd_master, "\033[25;80R", 8);  // row 25 ; column 80
       i += 4;
     }
+    else if ( i < length - 3  // Kitty keyboard protocol flags
+           && buffer[i] == '\033'
+           && buffer[i + 1] == '['
+           && buffer[i + 2] == '?'
+           && buffer[i + 3] == 'u' )
+    {
+      if ( con == console::kitty )
+        write (fd_master, "\033[?0u", 6);
+
+      i += 4;
+    }
     else if ( i < length - 2  // Device attributes (DA)
            && buffer[i] == '\033'
            && buffer[i + 1] == '['
@@ -0,0 +1,356 @@
+/***********************************************************************
+* fapplication-test.cpp - FApplication unit tests                      *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <sys/select.h>
+
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class Receiver
+//----------------------------------------------------------------------
+
+class Receiver : public finalcut::FObject
+{
+  public:
+    // Using-declaration
+    using finalcut::FObject::FObject;
+
+    // Event handler
+    void onUserEvent (finalcut::FUserEvent* ev) override
+    {
+      received.emplace_back(ev->getUserId(), ev->getData<int>());
+    }
+
+    // Data member
+    std::vector<std::pair<int, int>> received{};
+};
+
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+auto makeUserEvent (int uid, int value) -> std::unique_ptr<finalcut::FEvent>
+{
+  auto ev = std::make_unique<finalcut::FUserEvent>(finalcut::Event::User, uid);
+  ev->setData(std::move(value));  // Stores a copy
+  return ev;
+}
+
+//----------------------------------------------------------------------
+auto isReadable (int fd, int timeout_ms) -> bool
+{
+  fd_set ifds{};
+  FD_ZERO(&ifds);
+  FD_SET(fd, &ifds);
+  struct timeval tv{0, suseconds_t(timeout_ms * 1000)};
+  return select(fd + 1, &ifds, nullptr, nullptr, &tv) > 0;
+}
+
+
+//----------------------------------------------------------------------
+// class FApplicationTest
+//----------------------------------------------------------------------
+
+class FApplicationTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FApplicationTest() = default;
+
+  protected:
+    void classNameTest();
+    void postTest();
+    void queueEventTest();
+    void runAsyncTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FApplicationTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (postTest);
+    CPPUNIT_TEST (queueEventTest);
+    CPPUNIT_TEST (runAsyncTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FApplicationTest::classNameTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  const finalcut::FApplication app(1, parms);
+  const finalcut::FString& classname = app.getClassName();
+  CPPUNIT_ASSERT ( classname == "FApplication" );
+}
+
+//----------------------------------------------------------------------
+void FApplicationTest::postTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  finalcut::FApplication::start();
+  CPPUNIT_ASSERT ( ! finalcut::FApplication::isQuit() );
+
+  const auto& keyboard = finalcut::FKeyboard::getInstance();
+  const int wakeup_fd = keyboard.getWakeupFileDescriptor();
+  CPPUNIT_ASSERT ( wakeup_fd >= 0 );
+  CPPUNIT_ASSERT ( ! isReadable(wakeup_fd, 0) );
+
+  // Events and callbacks from several threads
+  Receiver receiver{};
+  constexpr int threads{4};
+  constexpr int count{5000};
+  std::vector<std::thread> workers{};
+
+  for (int t{0}; t < threads; t++)
+  {
+    workers.emplace_back ( [&app, &receiver, t] ()
+                           {
+                             for (int i{0}; i < count; i++)
+                               app.postEvent (&receiver, makeUserEvent(t, i));
+                           } );
+  }
+
+  int callbacks{0};
+  workers.emplace_back ( [&app, &callbacks] ()
+                         {
+                           for (int i{0}; i < count; i++)
+                             app.postCallback ([&callbacks] () { callbacks++; });
+                         } );
+
+  for (auto& worker : workers)
+    worker.join();
+
+  // The first posting has woken up the waiting loop
+  CPPUNIT_ASSERT ( isReadable(wakeup_fd, 0) );
+  CPPUNIT_ASSERT ( receiver.received.empty() );
+  app.sendQueuedEvents();
+  CPPUNIT_ASSERT ( ! isReadable(wakeup_fd, 0) );
+  CPPUNIT_ASSERT ( callbacks == count );
+  CPPUNIT_ASSERT ( receiver.received.size() == std::size_t(threads * count) );
+
+  // The events of each thread arrive in posting order
+  std::vector<int> next(threads, 0);
+
+  for (const auto& item : receiver.received)
+  {
+    CPPUNIT_ASSERT ( item.second == next[std::size_t(item.first)] );
+    next[std::size_t(item.first)]++;
+  }
+
+  // A posting thread ends the waiting of the main loop
+  std::thread late_worker ( [&app, &callbacks] ()
+                            {
+                              std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                              app.postCallback ([&callbacks] () { callbacks++; });
+                            } );
+  const auto start = std::chrono::steady_clock::now();
+  const bool woken_up = isReadable(wakeup_fd, 5000);  // max. 5 s
+  const auto duration = std::chrono::steady_clock::now() - start;
+  late_worker.join();
+  CPPUNIT_ASSERT ( woken_up );
+  CPPUNIT_ASSERT ( duration < std::chrono::seconds(1) );
+  app.sendQueuedEvents();
+  CPPUNIT_ASSERT ( callbacks == count + 1 );
+
+  // The input wait of the GPM mouse also empties the wakeup pipe
+  app.postCallback ([&callbacks] () { callbacks++; });
+  CPPUNIT_ASSERT ( isReadable(wakeup_fd, 0) );
+  keyboard.drainWakeupFileDescriptor();
+  CPPUNIT_ASSERT ( ! isReadable(wakeup_fd, 0) );
+  app.sendQueuedEvents();
+  CPPUNIT_ASSERT ( callbacks == count + 2 );
+
+  // Posted events of a destroyed receiver are discarded
+  receiver.received.clear();
+  app.postEvent (&receiver, makeUserEvent(0, 1));
+  app.postEvent (&receiver, makeUserEvent(0, 2));
+  CPPUNIT_ASSERT ( app.removeQueuedEvent(&receiver) );
+  app.sendQueuedEvents();
+  CPPUNIT_ASSERT ( receiver.received.empty() );
+}
+
+//----------------------------------------------------------------------
+void FApplicationTest::queueEventTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  finalcut::FApplication::start();
+  Receiver receiver{};
+
+  // Caller-owned event
+  finalcut::FUserEvent user_ev (finalcut::Event::User, 1);
+  user_ev.setData (std::move(10));
+  app.queueEvent (&receiver, &user_ev);
+  CPPUNIT_ASSERT ( user_ev.isQueued() );
+
+  // Application-owned events
+  for (int i{0}; i < 100; i++)
+  {
+    auto ev = app.queueEvent<finalcut::FUserEvent>( &receiver
+                                                  , finalcut::Event::User, 2 );
+    CPPUNIT_ASSERT ( ev != nullptr );
+    CPPUNIT_ASSERT ( ev->isQueued() );
+    ev->setData (std::move(i));
+  }
+
+  CPPUNIT_ASSERT ( ! app.queueEvent<finalcut::FUserEvent>( nullptr
+                                                         , finalcut::Event::User, 3 ) );
+  CPPUNIT_ASSERT ( receiver.received.empty() );
+  app.sendQueuedEvents();
+  CPPUNIT_ASSERT ( ! app.eventInQueue() );
+  CPPUNIT_ASSERT ( receiver.received.size() == 101 );
+  CPPUNIT_ASSERT ( receiver.received[0] == std::make_pair(1, 10) );
+  CPPUNIT_ASSERT ( user_ev.wasSent() );
+  CPPUNIT_ASSERT ( ! user_ev.isQueued() );
+
+  for (int i{0}; i < 100; i++)
+    CPPUNIT_ASSERT ( receiver.received[std::size_t(i + 1)] == std::make_pair(2, i) );
+}
+
+//----------------------------------------------------------------------
+void FApplicationTest::runAsyncTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  finalcut::FApplication::start();
+  const auto main_thread = std::this_thread::get_id();
+
+  // The task runs in a background thread,
+  // the completion callback in the main thread
+  auto requester = std::make_unique<Receiver>();
+  std::thread::id task_thread{};
+  std::thread::id done_thread{};
+  long long result{0};
+  bool done{false};
+  app.runAsync ( requester.get()
+               , [&task_thread, &result] ()
+                 {
+                   task_thread = std::this_thread::get_id();
+
+                   for (int i{1}; i <= 1000; i++)
+                     result += i;
+                 }
+               , [&done_thread, &done] ()
+                 {
+                   done_thread = std::this_thread::get_id();
+                   done = true;
+                 } );
+
+  auto run_loop = [&app] (const bool& finished, std::chrono::milliseconds max)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    while ( ! finished && std::chrono::steady_clock::now() - start < max )
+    {
+      auto& keyboard = finalcut::FKeyboard::getInstance();
+      keyboard.isKeyPressed(100'000);  // Wakes up when the task is done
+      app.sendQueuedEvents();
+    }
+  };
+
+  run_loop(done, std::chrono::seconds(5));
+  CPPUNIT_ASSERT ( done );
+  CPPUNIT_ASSERT ( result == 500500 );
+  CPPUNIT_ASSERT ( task_thread != main_thread );
+  CPPUNIT_ASSERT ( done_thread == main_thread );
+
+  // Destroying the requester cancels the completion callback
+  std::atomic<bool> release{false};
+  std::atomic<bool> finished{false};
+  done = false;
+  app.runAsync ( requester.get()
+               , [&release, &finished] ()
+                 {
+                   while ( ! release )
+                     std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                   finished = true;
+                 }
+               , [&done] () { done = true; } );
+  app.removeQueuedEvent(requester.get());  // As in ~FWidget()
+  requester.reset();
+  release = true;
+
+  while ( ! finished )
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  run_loop(done, std::chrono::milliseconds(200));
+  CPPUNIT_ASSERT ( ! done );
+
+  // Waiting tasks of a cancelled requester do not start
+  const auto threads = std::max(std::thread::hardware_concurrency(), 1U);
+  std::atomic<unsigned> blocked{0};
+  release = false;
+
+  for (unsigned i{0}; i < threads; i++)  // Occupies all worker threads
+  {
+    app.runAsync ( nullptr
+                 , [&release, &blocked] ()
+                   {
+                     blocked++;
+
+                     while ( ! release )
+                       std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                   } );
+  }
+
+  while ( blocked < threads )
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  Receiver receiver{};
+  std::atomic<int> started{0};
+
+  for (int i{0}; i < 100; i++)
+    app.runAsync (&receiver, [&started] () { started++; });
+
+  app.removeQueuedEvent(&receiver);
+  release = true;
+  bool never{false};
+  run_loop(never, std::chrono::milliseconds(200));
+  CPPUNIT_ASSERT ( started == 0 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FApplicationTest);
+
+// The general unit test main part
+#include <main-test.inc>
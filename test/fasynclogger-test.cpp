@@ -0,0 +1,406 @@
+/***********************************************************************
+* fasynclogger-test.cpp - FAsyncLogger unit tests                      *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FAsyncLoggerTest
+//----------------------------------------------------------------------
+
+class FAsyncLoggerTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FAsyncLoggerTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void defaultObjectTest();
+    void lineEndingTest();
+    void timestampTest();
+    void multilineTest();
+    void overflowTest();
+    void multithreadTest();
+    void threadExitTest();
+    void applicationObjectTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FAsyncLoggerTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (defaultObjectTest);
+    CPPUNIT_TEST (lineEndingTest);
+    CPPUNIT_TEST (timestampTest);
+    CPPUNIT_TEST (multilineTest);
+    CPPUNIT_TEST (overflowTest);
+    CPPUNIT_TEST (multithreadTest);
+    CPPUNIT_TEST (threadExitTest);
+    CPPUNIT_TEST (applicationObjectTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::classNameTest()
+{
+  finalcut::FAsyncLogger log;
+  const finalcut::FString& classname = log.getClassName();
+  CPPUNIT_ASSERT ( classname == "FAsyncLogger" );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::noArgumentTest()
+{
+  using OverflowPolicy = finalcut::FAsyncLogger::OverflowPolicy;
+  finalcut::FAsyncLogger log{};
+  CPPUNIT_ASSERT ( log.getBufferSize()
+                   == finalcut::FAsyncLogger::DEFAULT_BUFFER_SIZE );
+  CPPUNIT_ASSERT ( log.getOverflowPolicy() == OverflowPolicy::Drop );
+  CPPUNIT_ASSERT ( log.getDroppedCount() == 0 );
+
+  log.setOverflowPolicy (OverflowPolicy::Block);
+  CPPUNIT_ASSERT ( log.getOverflowPolicy() == OverflowPolicy::Block );
+
+  finalcut::FAsyncLogger log2{0, OverflowPolicy::Block};
+  CPPUNIT_ASSERT ( log2.getBufferSize() == 2 );
+  CPPUNIT_ASSERT ( log2.getOverflowPolicy() == OverflowPolicy::Block );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::defaultObjectTest()
+{
+  finalcut::FAsyncLogger log{};
+  std::ostringstream buf{};
+  log.setOutputStream(buf);
+  log << "Hello, World!" << std::flush;  // Default level is "Info"
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Hello, World!\r\n" );
+  buf.str("");  // Clear buffer
+
+  log << "Hel" << "lo," << " Wor" << "ld!" << std::flush;  // Several parts
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Hello, World!\r\n" );
+  buf.str("");  // Clear buffer
+
+  log << "Hello, World!" << std::endl;  // std::endl
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Hello, World!\n\r\n" );
+  buf.str("");  // Clear buffer
+
+  log << finalcut::FLog::LogLevel::Warn << "Hello, World!" << std::flush;
+  log << finalcut::FLog::LogLevel::Error << "Hello, World!" << std::flush;
+  log << finalcut::FLog::LogLevel::Debug << "Hello, World!" << std::flush;
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[WARNING] Hello, World!\r\n"
+                                "[ERROR] Hello, World!\r\n"
+                                "[DEBUG] Hello, World!\r\n" );
+  buf.str("");  // Clear buffer
+
+  // Without stream
+  log.info("Hello, World!");
+  log.warn("Hello, World!");
+  log.error("Hello, World!");
+  log.debug("Hello, World!");
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Hello, World!\r\n"
+                                "[WARNING] Hello, World!\r\n"
+                                "[ERROR] Hello, World!\r\n"
+                                "[DEBUG] Hello, World!\r\n" );
+  buf.str("");  // Clear buffer
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::lineEndingTest()
+{
+  finalcut::FAsyncLogger log{};
+  std::ostringstream buf{};
+  log.setOutputStream(buf);
+
+  log.info("Line endings");  // Default = CRLF
+  log.setLineEnding(finalcut::FLog::LineEnding::LF);
+  log.warn("Line endings");
+  log.setLineEnding(finalcut::FLog::LineEnding::CR);
+  log.error("Line endings");
+  log.setLineEnding(finalcut::FLog::LineEnding::CRLF);
+  log.debug("Line endings");
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Line endings\r\n"
+                                "[WARNING] Line endings\n"
+                                "[ERROR] Line endings\r"
+                                "[DEBUG] Line endings\r\n" );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::timestampTest()
+{
+  finalcut::FAsyncLogger log{};
+  std::ostringstream buf{};
+  log.setOutputStream(buf);
+
+  log.info("Timestamp");
+  log.waitUntilWritten();
+  std::size_t length = buf.str().length();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Timestamp\r\n" );
+  CPPUNIT_ASSERT ( length == 18 );
+  buf.str("");  // Clear buffer
+
+  log.enableTimestamp();
+  log.info("Timestamp");
+  log.waitUntilWritten();
+  length = buf.str().length();
+  CPPUNIT_ASSERT ( buf.str().substr(length - 18) == "[INFO] Timestamp\r\n" );
+  CPPUNIT_ASSERT ( length > 40 );
+  buf.str("");  // Clear buffer
+
+  log.disableTimestamp();
+  log.info("Timestamp");
+  log.waitUntilWritten();
+  length = buf.str().length();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Timestamp\r\n" );
+  CPPUNIT_ASSERT ( length == 18 );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::multilineTest()
+{
+  // Same output as FLogger
+  finalcut::FLogger sync_log{};
+  finalcut::FAsyncLogger async_log{};
+  std::ostringstream sync_buf{};
+  std::ostringstream async_buf{};
+  sync_log.setOutputStream(sync_buf);
+  async_log.setOutputStream(async_buf);
+
+  const std::vector<std::string> messages
+  {
+    "Line 1\nLine 2\nLine 3",
+    "Trailing newline\n",
+    "\n\nEmpty lines\n\n",
+    ""
+  };
+
+  for (const auto& msg : messages)
+  {
+    sync_log.warn(msg);
+    async_log.warn(msg);
+  }
+
+  async_log.waitUntilWritten();
+  CPPUNIT_ASSERT ( async_buf.str() == sync_buf.str() );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::overflowTest()
+{
+  using OverflowPolicy = finalcut::FAsyncLogger::OverflowPolicy;
+  static constexpr int count = 10000;
+  std::ostringstream buf{};
+
+  {
+    // Block: no message gets lost
+    finalcut::FAsyncLogger log{4, OverflowPolicy::Block};
+    log.setLineEnding(finalcut::FLog::LineEnding::LF);
+    log.setOutputStream(buf);
+
+    for (int i{0}; i < count; i++)
+      log.info(std::to_string(i));
+
+    log.waitUntilWritten();
+    CPPUNIT_ASSERT ( log.getDroppedCount() == 0 );
+  }
+
+  std::istringstream input{buf.str()};
+  std::string line{};
+  int n{0};
+
+  while ( std::getline(input, line) )
+  {
+    CPPUNIT_ASSERT ( line == "[INFO] " + std::to_string(n) );
+    n++;
+  }
+
+  CPPUNIT_ASSERT ( n == count );
+  buf.str("");  // Clear buffer
+
+  {
+    // Drop: the logging thread never waits
+    finalcut::FAsyncLogger log{4, OverflowPolicy::Drop};
+    log.setLineEnding(finalcut::FLog::LineEnding::LF);
+    log.setOutputStream(buf);
+
+    for (int i{0}; i < count; i++)
+      log.info(std::to_string(i));
+
+    log.waitUntilWritten();
+    const auto output = buf.str();
+    const auto lines = std::count(output.begin(), output.end(), '\n');
+    CPPUNIT_ASSERT ( uInt64(lines) + log.getDroppedCount() == count );
+  }
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::multithreadTest()
+{
+  using OverflowPolicy = finalcut::FAsyncLogger::OverflowPolicy;
+  static constexpr int thread_count = 4;
+  static constexpr int count = 2000;
+  std::ostringstream buf{};
+
+  {
+    finalcut::FAsyncLogger log{16, OverflowPolicy::Block};
+    log.setLineEnding(finalcut::FLog::LineEnding::LF);
+    log.setOutputStream(buf);
+    std::vector<std::thread> threads{};
+
+    for (int t{0}; t < thread_count; t++)
+    {
+      threads.emplace_back ( [&log, t] ()
+                             {
+                               for (int i{0}; i < count; i++)
+                                 log.info(std::to_string(t * count + i));
+                             } );
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+  }  // The destructor writes all pending messages
+
+  // Each thread keeps its own message order
+  std::istringstream input{buf.str()};
+  std::string line{};
+  std::vector<int> last(thread_count, -1);
+  int n{0};
+
+  while ( std::getline(input, line) )
+  {
+    CPPUNIT_ASSERT ( line.substr(0, 7) == "[INFO] " );
+    const int value = std::stoi(line.substr(7));
+    const int t = value / count;
+    CPPUNIT_ASSERT ( value % count == last[std::size_t(t)] + 1 );
+    last[std::size_t(t)] = value % count;
+    n++;
+  }
+
+  CPPUNIT_ASSERT ( n == thread_count * count );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::threadExitTest()
+{
+  // The buffers of exited threads are released after draining
+
+  static constexpr int thread_count = 50;
+  std::ostringstream buf{};
+  finalcut::FAsyncLogger log{};
+  log.setLineEnding(finalcut::FLog::LineEnding::LF);
+  log.setOutputStream(buf);
+  log.info("main thread");
+  CPPUNIT_ASSERT ( log.getThreadBufferCount() == 1 );
+
+  for (int t{0}; t < thread_count; t++)
+  {
+    // One short-lived thread after the other
+    std::thread thread ( [&log, t] ()
+                         { log.info("thread " + std::to_string(t)); } );
+    thread.join();
+  }
+
+  log.waitUntilWritten();
+
+  for (int wait{0}; wait < 500 && log.getThreadBufferCount() > 1; wait++)
+  {
+    log.flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // Only the buffer of the main thread is left
+  CPPUNIT_ASSERT ( log.getThreadBufferCount() == 1 );
+  const auto output = buf.str();
+  CPPUNIT_ASSERT ( std::count(output.begin(), output.end(), '\n')
+                   == thread_count + 1 );
+  CPPUNIT_ASSERT ( output.find("[INFO] thread 49\n") != std::string::npos );
+
+  // The main thread keeps its buffer
+  log.info("main thread again");
+  log.waitUntilWritten();
+  CPPUNIT_ASSERT ( log.getThreadBufferCount() == 1 );
+}
+
+//----------------------------------------------------------------------
+void FAsyncLoggerTest::applicationObjectTest()
+{
+  // Save the rdbuf of clog
+  std::streambuf* default_clog_rdbuf = std::clog.rdbuf();
+
+  auto async_log = std::make_shared<finalcut::FAsyncLogger>();
+  finalcut::FApplication::setLog (async_log);
+  std::shared_ptr<finalcut::FLog> log = finalcut::FApplication::getLog();
+
+  std::ostringstream buf{};
+  log->setOutputStream(buf);
+  log->info("test1");
+  *log << finalcut::FLog::LogLevel::Error << "test2" << std::flush;
+
+  // Logging to std::clog
+  std::clog << finalcut::FLog::LogLevel::Warn << "test3" << std::flush;
+
+  // flush() must not block the event loop
+  log->flush();
+  async_log->waitUntilWritten();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] test1\r\n"
+                                "[ERROR] test2\r\n"
+                                "[WARNING] test3\r\n" );
+
+  // Reset to the standard logger
+  finalcut::FApplication::setLog(std::make_shared<finalcut::FLogger>());
+  async_log.reset();
+
+  // Reset to default rdbuf of clog
+  std::clog.rdbuf(default_clog_rdbuf);
+}
+
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FAsyncLoggerTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -122,6 +122,7 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
 
   protected:
     void classNameTest();
+    void signalIdTest();
     void memberFunctionPointerCallbackTest();
     void instanceWithFunctionObjectCallbackTest();
     void functionObjectCallbackTest();
@@ -136,6 +137,7 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
 
     // Add a methods to the test suite
     CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (signalIdTest);
     CPPUNIT_TEST (memberFunctionPointerCallbackTest);
     CPPUNIT_TEST (instanceWithFunctionObjectCallbackTest);
     CPPUNIT_TEST (functionObjectCallbackTest);
@@ -160,6 +162,78 @@ void FCallbackTest::classNameTest()
   const finalcut::FCallback cb;
   const finalcut::FString& classname = cb.getClassName();
   CPPUNIT_ASSERT ( classname == "FCallback" );
+
+  const finalcut::FSignalId id{"clicked"};
+  CPPUNIT_ASSERT ( id.getClassName() == "FSignalId" );
+}
+
+//----------------------------------------------------------------------
+void FCallbackTest::signalIdTest()
+{
+  // String literals are hashed at compile time
+  constexpr finalcut::FSignalId clicked{"clicked"};
+  constexpr finalcut::FSignalId wide_clicked{L"clicked"};
+  static_assert ( clicked == wide_clicked, "Different signal id" );
+  static_assert ( clicked != finalcut::FSignalId{"changed"}, "Same signal id" );
+
+  // All string types result in the same signal id
+  const char* char_ptr = "clicked";
+  char char_array[32] = "clicked";  // Not completely filled
+  const std::string str{"clicked"};
+  const std::wstring wstr{L"clicked"};
+  const finalcut::FString fstr{"clicked"};
+  CPPUNIT_ASSERT ( finalcut::FSignalId{char_ptr} == clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{char_array} == clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{str} == clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{wstr} == clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{fstr} == clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{"clicked"}.get() == clicked.get() );
+
+  // UTF-8 and wide character names
+  const finalcut::FSignalId utf8_id{"größe-geändert"};
+  const finalcut::FSignalId wide_id{L"größe-geändert"};
+  const finalcut::FString fstr_wide{L"größe-geändert"};
+  CPPUNIT_ASSERT ( utf8_id == wide_id );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{fstr_wide} == wide_id );
+
+  // Empty and null strings
+  const char* null_ptr{nullptr};
+  CPPUNIT_ASSERT ( finalcut::FSignalId{""} == finalcut::FSignalId{null_ptr} );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{""} == finalcut::FSignalId{finalcut::FString{}} );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{""} != clicked );
+
+  // Similar names
+  CPPUNIT_ASSERT ( finalcut::FSignalId{"click"} != clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{"clicked "} != clicked );
+  CPPUNIT_ASSERT ( finalcut::FSignalId{"Clicked"} != clicked );
+
+  // Callbacks can be emitted with any string type
+  finalcut::FCallback cb{};
+  int i{0};
+  cb.addCallback (fstr, [&i] () { i++; });
+  cb.addCallback (L"clicked", [&i] () { i += 10; });
+  cb.addCallback ("changed", [&i] () { i += 100; });
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 3 );
+
+  cb.emitCallback ("clicked");
+  CPPUNIT_ASSERT ( i == 11 );
+  cb.emitCallback (str);
+  CPPUNIT_ASSERT ( i == 22 );
+  cb.emitCallback (wstr);
+  CPPUNIT_ASSERT ( i == 33 );
+  cb.emitCallback (char_ptr);
+  CPPUNIT_ASSERT ( i == 44 );
+  cb.emitCallback (clicked);
+  CPPUNIT_ASSERT ( i == 55 );
+  cb.emitCallback (finalcut::FString{"changed"});
+  CPPUNIT_ASSERT ( i == 155 );
+
+  cb.delCallback (str);
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 1 );
+  cb.emitCallback ("clicked");
+  CPPUNIT_ASSERT ( i == 155 );
+  cb.emitCallback ("changed");
+  CPPUNIT_ASSERT ( i == 255 );
 }
 
 //----------------------------------------------------------------------
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <memory>
 #include <utility>
 
 #include <cppunit/BriefTestProgressListener.h>
@@ -73,6 +74,7 @@ class FEventTest : public CPPUNIT_NS::TestFixture
     void fcloseeventTest();
     void ftimereventTest();
     void fusereventTest();
+    void feventarenaTest();
 
   private:
     // Adds code needed to register the test suite
@@ -91,6 +93,7 @@ class FEventTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (fcloseeventTest);
     CPPUNIT_TEST (ftimereventTest);
     CPPUNIT_TEST (fusereventTest);
+    CPPUNIT_TEST (feventarenaTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -478,6 +481,53 @@ void FEventTest::fusereventTest()
   CPPUNIT_ASSERT ( lambda_from_fdata() == 5 );
 }
 
+//----------------------------------------------------------------------
+void FEventTest::feventarenaTest()
+{
+  finalcut::FEventArena arena{};
+  CPPUNIT_ASSERT ( arena.getClassName() == "FEventArena" );
+  CPPUNIT_ASSERT ( arena.isEmpty() );
+  CPPUNIT_ASSERT ( arena.getBlockCount() == 0 );
+
+  auto key_ev = arena.create<finalcut::FKeyEvent>( finalcut::Event::KeyPress
+                                                 , finalcut::FKey('a') );
+  CPPUNIT_ASSERT ( key_ev->getType() == finalcut::Event::KeyPress );
+  CPPUNIT_ASSERT ( key_ev->key() == finalcut::FKey('a') );
+  CPPUNIT_ASSERT ( ! arena.isEmpty() );
+
+  // The arena calls the destructor of the derived event class
+  auto data = std::make_shared<int>(42);
+  auto user_ev = arena.create<finalcut::FUserEvent>(finalcut::Event::User, 7);
+  auto data_copy = data;
+  user_ev->setData (std::move(data_copy));
+  CPPUNIT_ASSERT ( *user_ev->getData<std::shared_ptr<int>>() == 42 );
+  CPPUNIT_ASSERT ( data.use_count() == 2 );
+  CPPUNIT_ASSERT ( arena.getEventCount() == 2 );
+  CPPUNIT_ASSERT ( arena.getBlockCount() == 1 );
+  arena.clear();
+  CPPUNIT_ASSERT ( arena.isEmpty() );
+  CPPUNIT_ASSERT ( data.use_count() == 1 );
+
+  // Many events fill several blocks
+  for (int i{0}; i < 1000; i++)
+  {
+    auto ev = arena.create<finalcut::FTimerEvent>(finalcut::Event::Timer, i);
+    CPPUNIT_ASSERT ( ev->getTimerId() == i );
+  }
+
+  const auto blocks = arena.getBlockCount();
+  CPPUNIT_ASSERT ( blocks > 1 );
+  CPPUNIT_ASSERT ( arena.getEventCount() == 1000 );
+
+  // After clear() the memory blocks are reused
+  arena.clear();
+
+  for (int i{0}; i < 1000; i++)
+    arena.create<finalcut::FTimerEvent>(finalcut::Event::Timer, i);
+
+  CPPUNIT_ASSERT ( arena.getBlockCount() == blocks );
+}
+
 //----------------------------------------------------------------------
 
 // Put the test suite in the registry
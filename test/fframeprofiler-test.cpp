@@ -0,0 +1,258 @@
+/***********************************************************************
+* fframeprofiler-test.cpp - FFrameProfiler unit tests                  *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FFrameProfilerTest
+//----------------------------------------------------------------------
+
+class FFrameProfilerTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FFrameProfilerTest() = default;
+
+  protected:
+    void classNameTest();
+    void disabledTest();
+    void recordTest();
+    void ringTest();
+    void averageTest();
+    void concurrentReadTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FFrameProfilerTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (disabledTest);
+    CPPUNIT_TEST (recordTest);
+    CPPUNIT_TEST (ringTest);
+    CPPUNIT_TEST (averageTest);
+    CPPUNIT_TEST (concurrentReadTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::classNameTest()
+{
+  const finalcut::FFrameProfiler profiler{};
+  const finalcut::FString& classname = profiler.getClassName();
+  CPPUNIT_ASSERT ( classname == "FFrameProfiler" );
+  CPPUNIT_ASSERT ( &finalcut::FFrameProfiler::getInstance()
+                   == &finalcut::FFrameProfiler::getInstance() );
+  using Phase = finalcut::FFrameProfiler::Phase;
+  CPPUNIT_ASSERT ( std::string(finalcut::FFrameProfiler::getPhaseName(Phase::Timer)) == "timer" );
+  CPPUNIT_ASSERT ( std::string(finalcut::FFrameProfiler::getPhaseName(Phase::TerminalUpdate)) == "update" );
+  CPPUNIT_ASSERT ( std::string(finalcut::FFrameProfiler::getPhaseName(Phase::Logger)) == "logger" );
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::disabledTest()
+{
+  // Without enabling, no frames are recorded
+
+  finalcut::FFrameProfiler profiler{};
+  CPPUNIT_ASSERT ( ! profiler.isEnabled() );
+  profiler.beginFrame();
+  CPPUNIT_ASSERT ( ! profiler.isRecording() );
+  profiler.endPhase (finalcut::FFrameProfiler::Phase::Input);
+  profiler.addCells (100);
+  profiler.endFrame();
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == 0 );
+  CPPUNIT_ASSERT ( profiler.getFrames().empty() );
+  CPPUNIT_ASSERT ( profiler.getAverage().total_time == 0 );
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::recordTest()
+{
+  using Phase = finalcut::FFrameProfiler::Phase;
+  finalcut::FFrameProfiler profiler{};
+  profiler.setEnable();
+  CPPUNIT_ASSERT ( profiler.isEnabled() );
+  profiler.beginFrame();
+  CPPUNIT_ASSERT ( profiler.isRecording() );
+  profiler.endPhase (Phase::Timer);
+  profiler.addEvents (3);
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  profiler.endPhase (Phase::Input);
+  profiler.addCells (80);
+  profiler.addCells (20);
+  profiler.endPhase (Phase::TerminalUpdate);
+  profiler.addBytes (512);
+  profiler.endPhase (Phase::Flush);
+  profiler.endFrame();
+  CPPUNIT_ASSERT ( ! profiler.isRecording() );
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == 1 );
+
+  const auto frames = profiler.getFrames();
+  CPPUNIT_ASSERT ( frames.size() == 1 );
+  const auto& frame = frames.front();
+  CPPUNIT_ASSERT ( frame.number == 0 );
+  CPPUNIT_ASSERT ( frame.phase_time[std::size_t(Phase::Input)] >= 2'000'000 );
+  CPPUNIT_ASSERT ( frame.phase_time[std::size_t(Phase::Resize)] == 0 );
+  CPPUNIT_ASSERT ( frame.total_time >= frame.phase_time[std::size_t(Phase::Input)] );
+  CPPUNIT_ASSERT ( frame.cell_count == 100 );
+  CPPUNIT_ASSERT ( frame.byte_count == 512 );
+  CPPUNIT_ASSERT ( frame.event_count == 3 );
+
+  // Disabling takes effect with the next frame
+  profiler.unsetEnable();
+  CPPUNIT_ASSERT ( ! profiler.isEnabled() );
+  profiler.beginFrame();
+  profiler.endFrame();
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == 1 );
+
+  profiler.clear();
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == 0 );
+  CPPUNIT_ASSERT ( profiler.getFrames().empty() );
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::ringTest()
+{
+  // The ring keeps the last RING_SIZE frames
+
+  constexpr auto ring_size = finalcut::FFrameProfiler::RING_SIZE;
+  finalcut::FFrameProfiler profiler{};
+  profiler.setEnable();
+
+  for (std::size_t n{0}; n < ring_size + 10; n++)
+  {
+    profiler.beginFrame();
+    profiler.addEvents (n);
+    profiler.endFrame();
+  }
+
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == ring_size + 10 );
+  auto frames = profiler.getFrames();
+  CPPUNIT_ASSERT ( frames.size() == ring_size );
+  CPPUNIT_ASSERT ( frames.front().number == 10 );
+  CPPUNIT_ASSERT ( frames.front().event_count == 10 );
+  CPPUNIT_ASSERT ( frames.back().number == ring_size + 9 );
+  CPPUNIT_ASSERT ( frames.back().event_count == ring_size + 9 );
+
+  frames = profiler.getFrames(5);
+  CPPUNIT_ASSERT ( frames.size() == 5 );
+  CPPUNIT_ASSERT ( frames.front().number == ring_size + 5 );
+
+  for (std::size_t i{1}; i < frames.size(); i++)
+    CPPUNIT_ASSERT ( frames[i].number == frames[i - 1].number + 1 );
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::averageTest()
+{
+  finalcut::FFrameProfiler profiler{};
+  profiler.setEnable();
+
+  for (std::size_t n{1}; n <= 4; n++)
+  {
+    profiler.beginFrame();
+    profiler.addCells (n * 100);
+    profiler.addBytes (n * 10);
+    profiler.addEvents (n);
+    profiler.endFrame();
+  }
+
+  auto average = profiler.getAverage();
+  CPPUNIT_ASSERT ( average.number == 3 );
+  CPPUNIT_ASSERT ( average.cell_count == 250 );
+  CPPUNIT_ASSERT ( average.byte_count == 25 );
+  CPPUNIT_ASSERT ( average.event_count == 2 );
+
+  // Average of the last two frames
+  average = profiler.getAverage(2);
+  CPPUNIT_ASSERT ( average.cell_count == 350 );
+  CPPUNIT_ASSERT ( average.byte_count == 35 );
+  CPPUNIT_ASSERT ( average.event_count == 3 );
+}
+
+//----------------------------------------------------------------------
+void FFrameProfilerTest::concurrentReadTest()
+{
+  // Another thread reads complete frames while the frames are recorded
+
+  finalcut::FFrameProfiler profiler{};
+  profiler.setEnable();
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> torn_frames{0};
+  std::atomic<std::size_t> reads{0};
+
+  std::thread reader ( [&profiler, &done, &torn_frames, &reads] ()
+                       {
+                         do
+                         {
+                           for (const auto& frame : profiler.getFrames())
+                           {
+                             if ( frame.event_count != frame.number
+                               || frame.cell_count != frame.number
+                               || frame.byte_count != frame.number )
+                               torn_frames++;
+                           }
+
+                           reads++;
+                         }
+                         while ( ! done );
+                       } );
+
+  for (std::size_t n{0}; n < 20000; n++)
+  {
+    profiler.beginFrame();
+    profiler.addEvents (n);
+    profiler.addCells (n);
+    profiler.addBytes (n);
+    profiler.endFrame();
+
+    if ( n % 1000 == 0 )
+      std::this_thread::yield();
+  }
+
+  done = true;
+  reader.join();
+  CPPUNIT_ASSERT ( torn_frames == 0 );
+  CPPUNIT_ASSERT ( reads > 0 );
+  CPPUNIT_ASSERT ( profiler.getFrameCount() == 20000 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FFrameProfilerTest);
+
+// The general unit test main part
+#include <main-test.inc>
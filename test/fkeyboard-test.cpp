@@ -304,9 +304,12 @@ class FKeyboardTest : public CPPUNIT_NS::TestFixture
     void metaKeyTest();
     void sequencesTest();
     void hashmapTest();
+    void keyTrieTest();
     void mouseTest();
     void utf8Test();
     void unknownKeyTest();
+    void kittyKeyboardTest();
+    void bracketedPasteTest();
 
   private:
     // Adds code needed to register the test suite
@@ -323,9 +326,12 @@ class FKeyboardTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (metaKeyTest);
     CPPUNIT_TEST (sequencesTest);
     CPPUNIT_TEST (hashmapTest);
+    CPPUNIT_TEST (keyTrieTest);
     CPPUNIT_TEST (mouseTest);
     CPPUNIT_TEST (utf8Test);
     CPPUNIT_TEST (unknownKeyTest);
+    CPPUNIT_TEST (kittyKeyboardTest);
+    CPPUNIT_TEST (bracketedPasteTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -341,6 +347,7 @@ class FKeyboardTest : public CPPUNIT_NS::TestFixture
     // Data members
     finalcut::FKey key_pressed{finalcut::FKey::None};
     finalcut::FKey key_released{finalcut::FKey::None};
+    std::string pasted_text{};
     int number_of_keys{0};
     finalcut::FKeyboard* keyboard{nullptr};
 };
@@ -3034,6 +3041,72 @@ void FKeyboardTest::hashmapTest()
   char_rbuf.pop(char_rbuf.getSize());
 }
 
+//----------------------------------------------------------------------
+void FKeyboardTest::keyTrieTest()
+{
+  using Match = finalcut::FKeyTrie::Match;
+  finalcut::FKeyTrie trie{};
+  CPPUNIT_ASSERT ( trie.getClassName() == "FKeyTrie" );
+  CPPUNIT_ASSERT ( trie.getNodeCount() == 1 );  // Root node
+
+  trie.insert ("\033[", 2, finalcut::FKey::Meta_left_square_bracket);
+  trie.insert ("\033[2~", 4, finalcut::FKey::Insert);
+  trie.insert ("\033[2;3~", 6, finalcut::FKey::Meta_insert);
+  trie.insert (nullptr, 2, finalcut::FKey::Escape);  // Ignored
+  trie.insert ("\033", 0, finalcut::FKey::Escape);  // Ignored
+  CPPUNIT_ASSERT ( trie.getNodeCount() == 8 );
+
+  const auto find = [&trie] (const std::string& seq)
+  {
+    return trie.find(seq.cbegin(), seq.cend());
+  };
+
+  auto result = find("\033");
+  CPPUNIT_ASSERT ( result.match == Match::Prefix );
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::None );
+  CPPUNIT_ASSERT ( result.has_continuation );
+
+  result = find("\033[");
+  CPPUNIT_ASSERT ( result.match == Match::Key );
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::Meta_left_square_bracket );
+  CPPUNIT_ASSERT ( result.has_continuation );
+
+  result = find("\033[2");
+  CPPUNIT_ASSERT ( result.match == Match::Prefix );
+
+  result = find("\033[2~");
+  CPPUNIT_ASSERT ( result.match == Match::Key );
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::Insert );
+  CPPUNIT_ASSERT ( ! result.has_continuation );
+
+  result = find("\033[2;3~");
+  CPPUNIT_ASSERT ( result.match == Match::Key );
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::Meta_insert );
+
+  result = find("\033[2x");
+  CPPUNIT_ASSERT ( result.match == Match::None );
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::None );
+  CPPUNIT_ASSERT ( ! result.has_continuation );
+
+  // A later entry replaces the key of the same sequence
+  trie.insert ("\033[2~", 4, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( trie.getNodeCount() == 8 );
+  CPPUNIT_ASSERT ( find("\033[2~").key == finalcut::FKey::Home );
+
+  // Works with the ring buffer iterators as well
+  finalcut::CharRingBuffer<8> char_rbuf;
+  char_rbuf.push('\033');
+  char_rbuf.push('[');
+  char_rbuf.push('2');
+  char_rbuf.push('~');
+  result = trie.find(std::begin(char_rbuf), std::end(char_rbuf));
+  CPPUNIT_ASSERT ( result.key == finalcut::FKey::Home );
+
+  trie.clear();
+  CPPUNIT_ASSERT ( trie.getNodeCount() == 1 );
+  CPPUNIT_ASSERT ( find("\033[").match == Match::None );
+}
+
 //----------------------------------------------------------------------
 void FKeyboardTest::mouseTest()
 {
@@ -3136,11 +3209,257 @@ void FKeyboardTest::unknownKeyTest()
   // Unknown key code
   CPPUNIT_ASSERT ( keyboard->getKeyName(finalcut::FKey(0xf8d0)) == "" );
 
-  // Unknown input
+  // A high timeout shows that unknown input does not wait for it
+  keyboard->setKeypressTimeout(1000000);  // 1 s
+
+  // An escape sequence that cannot match any key is
+  // delivered at once as single characters
   input("\033[_.");
   processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 4 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('.') );
+  CPPUNIT_ASSERT ( ! keyboard->hasUnprocessedInput() );
+  clear();
+
+  // An unfinished control sequence waits for further characters
+  input("\033[1;");
+  processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 0 );
+  CPPUNIT_ASSERT ( keyboard->hasUnprocessedInput() );
+  clear();
+}
+
+//----------------------------------------------------------------------
+void FKeyboardTest::kittyKeyboardTest()
+{
+  // A high timeout shows that no key has to wait for it
+  keyboard->setKeypressTimeout(1000000);  // 1 s
+  std::cout << std::endl;
+
+  // Without the kitty keyboard protocol, the unknown
+  // sequence is delivered as single characters
+  CPPUNIT_ASSERT ( ! keyboard->hasKittyKeyboard() );
+  input("\033[27u");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('u') );
+  CPPUNIT_ASSERT ( number_of_keys == 5 );
+  clear();
+
+  keyboard->enableKittyKeyboard();
+  CPPUNIT_ASSERT ( keyboard->hasKittyKeyboard() );
+
+  // Before the first CSI u sequence, a single escape
+  // character is still an Esc key after the timeout
+  keyboard->setKeypressTimeout(100000);  // 100 ms
+  input("\033");
+  processInput();
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  keyboard->escapeKeyHandling();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Escape );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  clear();
+  keyboard->setKeypressTimeout(1000000);  // 1 s
+
+  // Esc
+  input("\033[27u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Escape );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  clear();
+
+  // Meta-a
+  input("\033[97;3u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Meta_a );
+  clear();
+
+  // Meta-A (shift + alt with the shifted key as alternate key)
+  input("\033[97:65;4u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Meta_A );
+  clear();
+
+  // Meta-[ (no longer a prefix of other keys)
+  input("\033[91;3u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Meta_left_square_bracket );
+  clear();
+
+  // Meta-Enter
+  input("\033[13;3u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Meta_enter );
+  clear();
+
+  // Shift-Tab
+  input("\033[9;2u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Back_tab );
+  clear();
+
+  // Ctrl-c (with num lock)
+  input("\033[99;133u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Ctrl_c );
+  clear();
+
+  // Ctrl-Space
+  input("\033[32;5u");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Ctrl_space );
+  clear();
+
+  // Unicode character
+  input("\033[252u");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey(0xfc) );
+  clear();
+
+  // Ctrl-Meta-a has no key code
+  input("\033[97;7u");
+  processInput();
   CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::None );
-  CPPUNIT_ASSERT ( keyboard->getKeyName(key_pressed) == "" );
+  CPPUNIT_ASSERT ( number_of_keys == 0 );
+  CPPUNIT_ASSERT ( ! keyboard->hasUnprocessedInput() );
+  clear();
+
+  // Legacy key sequences remain valid
+  input("\033[2;3~");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Meta_insert );
+  clear();
+
+  // After a received CSI u sequence, a single
+  // escape character is no longer an Esc key
+  input("\033");
+  processInput();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  keyboard->escapeKeyHandling();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::None );
+  clear();
+
+  keyboard->disableKittyKeyboard();
+  CPPUNIT_ASSERT ( ! keyboard->hasKittyKeyboard() );
+}
+
+//----------------------------------------------------------------------
+void FKeyboardTest::bracketedPasteTest()
+{
+  keyboard->setKeypressTimeout(250000);  // 250 ms
+  std::cout << std::endl;
+
+  // The whole text arrives as a single key
+  input("\033[200~Hello\nWorld\033[201~");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Term_Paste );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( keyboard->getPasteText() == "Hello\nWorld" );
+  CPPUNIT_ASSERT ( ! keyboard->isPasting() );
+  clear();
+
+  // Key input after the pasted text
+  input("\033[200~abc\033[201~x");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('x') );
+  CPPUNIT_ASSERT ( number_of_keys == 2 );
+  CPPUNIT_ASSERT ( pasted_text == "abc" );
+  clear();
+
+  // Escape sequences in the pasted text are not interpreted
+  input("\033[200~\033[A\033[11~\033[201~");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Term_Paste );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( keyboard->getPasteText() == "\033[A\033[11~" );
+  clear();
+
+  // Two pastes in a row
+  input("\033[200~one\033[201~\033[200~two\033[201~");
+  processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 2 );
+  CPPUNIT_ASSERT ( pasted_text == "onetwo" );
+  clear();
+
+  // Empty paste
+  input("\033[200~\033[201~");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Term_Paste );
+  CPPUNIT_ASSERT ( keyboard->getPasteText().empty() );
+  clear();
+
+  // Larger text
+  std::string text{};
+
+  for (int i{0}; i < 30; i++)
+    text += std::string(79, char('a' + i % 26)) + '\n';
+
+  input("\033[200~" + text + "\033[201~");
+  processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( keyboard->getPasteText() == text );
+  clear();
+
+  // An incomplete paste is discarded with the key buffer
+  input("\033[200~abc");
+  processInput();
+  CPPUNIT_ASSERT ( keyboard->isPasting() );
+  CPPUNIT_ASSERT ( number_of_keys == 0 );
+  clear();
+  CPPUNIT_ASSERT ( ! keyboard->isPasting() );
+
+  // Without an end marker, the text is handed over after the paste timeout
+  const auto paste_timeout = finalcut::FKeyboard::getPasteTimeout();
+  CPPUNIT_ASSERT ( paste_timeout == 1'000'000 );
+  finalcut::FKeyboard::setPasteTimeout (300'000);  // 300 ms
+  CPPUNIT_ASSERT ( finalcut::FKeyboard::getPasteTimeout() == 300'000 );
+  input("\033[200~abc");
+  processInput();
+  CPPUNIT_ASSERT ( keyboard->isPasting() );
+  CPPUNIT_ASSERT ( number_of_keys == 0 );
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  processInput();
+  CPPUNIT_ASSERT ( ! keyboard->isPasting() );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Term_Paste );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( pasted_text == "abc" );
+
+  // The following input is regular key input again
+  input("x");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('x') );
+  CPPUNIT_ASSERT ( number_of_keys == 2 );
+  finalcut::FKeyboard::setPasteTimeout (paste_timeout);
+  clear();
+
+  // Text above the maximum size is handed over in several parts
+  const auto max_paste_size = finalcut::FKeyboard::getMaxPasteSize();
+  CPPUNIT_ASSERT ( max_paste_size == 4 * 1024 * 1024 );
+  finalcut::FKeyboard::setMaxPasteSize (64);
+  CPPUNIT_ASSERT ( finalcut::FKeyboard::getMaxPasteSize() == 64 );
+  text.clear();
+
+  for (int i{0}; i < 10; i++)
+    text += std::string(19, char('A' + i)) + "\xc3\xa4";  // "ä"
+
+  input("\033[200~" + text + "\033[201~");
+  processInput();
+  CPPUNIT_ASSERT ( ! keyboard->isPasting() );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Term_Paste );
+  CPPUNIT_ASSERT ( number_of_keys > 1 );
+  CPPUNIT_ASSERT ( pasted_text == text );
+  CPPUNIT_ASSERT ( keyboard->getPasteText().size() <= 64 );
+  finalcut::FKeyboard::setMaxPasteSize (max_paste_size);
+  clear();
 }
 
 //----------------------------------------------------------------------
@@ -3215,6 +3534,7 @@ void FKeyboardTest::processInput()
 {
   keyboard->escapeKeyHandling();  // special case: Esc key
   keyboard->clearKeyBufferOnTimeout();
+  keyboard->pasteTimeoutHandling();
 
   if ( keyboard->isKeyPressed() )
     keyboard->fetchKeyCode();
@@ -3229,6 +3549,7 @@ void FKeyboardTest::clear()
 {
   keyboard->clearKeyBuffer();
   number_of_keys = 0;
+  pasted_text.clear();
   key_pressed = finalcut::FKey::None;
   key_released = finalcut::FKey::None;
 }
@@ -3238,6 +3559,9 @@ void FKeyboardTest::keyPressed()
 {
   key_pressed = keyboard->getKey();
   number_of_keys++;
+
+  if ( key_pressed == finalcut::FKey::Term_Paste )
+    pasted_text += keyboard->getPasteText();
 }
 
 //----------------------------------------------------------------------
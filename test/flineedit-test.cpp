@@ -0,0 +1,301 @@
+/***********************************************************************
+* flineedit-test.cpp - FLineEdit unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <chrono>
+#include <regex>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+void typeText (finalcut::FLineEdit& line_edit, const finalcut::FString& str)
+{
+  // Sends every character of str as a key press to the line edit
+
+  line_edit.setCursorPosition (line_edit.getText().getLength() + 1);
+
+  for (const auto& ch : str)
+  {
+    finalcut::FKeyEvent ev (finalcut::Event::KeyPress, finalcut::FKey(ch));
+    line_edit.onKeyPress(&ev);
+  }
+}
+
+
+//----------------------------------------------------------------------
+// class FLineEditTest
+//----------------------------------------------------------------------
+
+class FLineEditTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FLineEditTest() = default;
+
+  protected:
+    void classNameTest();
+    void noFilterTest();
+    void regexFilterTest();
+    void charClassFilterTest();
+    void invalidRegexTest();
+    void pasteTest();
+    void pasteEventTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FLineEditTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noFilterTest);
+    CPPUNIT_TEST (regexFilterTest);
+    CPPUNIT_TEST (charClassFilterTest);
+    CPPUNIT_TEST (invalidRegexTest);
+    CPPUNIT_TEST (pasteTest);
+    CPPUNIT_TEST (pasteEventTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data member
+    finalcut::FWidget root{nullptr};
+};
+
+//----------------------------------------------------------------------
+void FLineEditTest::classNameTest()
+{
+  const finalcut::FLineEdit line_edit{&root};
+  const finalcut::FString& classname = line_edit.getClassName();
+  CPPUNIT_ASSERT ( classname == "FLineEdit" );
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::noFilterTest()
+{
+  finalcut::FLineEdit line_edit{&root};
+  typeText (line_edit, L"a1-B ä€");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"a1-B ä€" );
+
+  line_edit.setInputFilter (finalcut::FLineEdit::CharClass::Digit);
+  line_edit.clearInputFilter();
+  line_edit.clear();
+  typeText (line_edit, L"x7");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"x7" );
+
+  // An empty regular expression does not filter
+  line_edit.setInputFilter (L"");
+  line_edit.clear();
+  typeText (line_edit, L"y8");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"y8" );
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::regexFilterTest()
+{
+  finalcut::FLineEdit line_edit{&root};
+  line_edit.setInputFilter (L"[-[:digit:]]");
+  typeText (line_edit, L"-12a.3b45ä6€");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"-123456" );
+
+  // Non-ASCII characters go through the regular expression
+  line_edit.clear();
+  line_edit.setInputFilter (L"[äöü]");
+  typeText (line_edit, L"aäoöuüß");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"äöü" );
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::charClassFilterTest()
+{
+  using CharClass = finalcut::FLineEdit::CharClass;
+  finalcut::FLineEdit line_edit{&root};
+
+  // Same result as the regular expression "[-[:digit:]]"
+  line_edit.setInputFilter (CharClass::Digit, L"-");
+  typeText (line_edit, L"-12a.3b45ä6€");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"-123456" );
+
+  line_edit.clear();
+  line_edit.setInputFilter (CharClass::XDigit);
+  typeText (line_edit, L"0x1fG-Ab9z");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"01fAb9" );
+
+  line_edit.clear();
+  line_edit.setInputFilter (CharClass::Upper, L"_");
+  typeText (line_edit, L"aB_cD e");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"B_D" );
+
+  line_edit.clear();
+  line_edit.setInputFilter (CharClass::Space, L"€");
+  typeText (line_edit, L"a b€c");
+  CPPUNIT_ASSERT ( line_edit.getText() == L" €" );
+
+  // Character classes and regular expressions agree in the ASCII range
+  const std::wregex regex{L"[[:alnum:]]"};
+  finalcut::FString ascii{};
+
+  for (wchar_t c{0x20}; c < 0x7f; c++)
+    ascii += c;
+
+  finalcut::FString expected{};
+
+  for (const auto& c : ascii)
+    if ( std::regex_match(std::wstring(1, c), regex) )
+      expected += c;
+
+  line_edit.clear();
+  line_edit.setInputFilter (CharClass::Alnum);
+  typeText (line_edit, ascii);
+  CPPUNIT_ASSERT ( line_edit.getText() == expected );
+
+  line_edit.clear();
+  line_edit.setInputFilter (L"[[:alnum:]]");
+  typeText (line_edit, ascii);
+  CPPUNIT_ASSERT ( line_edit.getText() == expected );
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::invalidRegexTest()
+{
+  finalcut::FLineEdit line_edit{&root};
+  line_edit.setInputFilter (finalcut::FLineEdit::CharClass::Digit);
+
+  // An invalid expression is reported when the filter is set,
+  // the previous filter stays active
+  CPPUNIT_ASSERT_THROW ( line_edit.setInputFilter (L"[0-9")
+                       , std::regex_error );
+  typeText (line_edit, L"1a2");
+  CPPUNIT_ASSERT ( line_edit.getText() == L"12" );
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::pasteTest()
+{
+  // Pastes a long string character by character through the
+  // precompiled filter. Only every hundredth character is a digit,
+  // so the time is spent in the filter. The times are only printed.
+
+  constexpr std::size_t length{100000};
+  finalcut::FString paste{};
+  finalcut::FString digits{};
+
+  for (std::size_t i{0}; i < length; i++)
+  {
+    if ( i % 100 == 0 )
+    {
+      paste += wchar_t(L'0' + i / 100 % 10);
+      digits += wchar_t(L'0' + i / 100 % 10);
+    }
+    else
+      paste += wchar_t(L'a' + i % 26);
+  }
+
+  finalcut::FLineEdit line_edit{&root};
+  line_edit.setInputFilter (L"[-[:digit:]]");
+  auto start = std::chrono::steady_clock::now();
+  typeText (line_edit, paste);
+  const auto regex_duration = std::chrono::steady_clock::now() - start;
+  CPPUNIT_ASSERT ( line_edit.getText().getLength() == length / 100 );
+  CPPUNIT_ASSERT ( line_edit.getText() == digits );
+
+  // The same result with the regex-free character class filter
+  line_edit.setInputFilter (finalcut::FLineEdit::CharClass::Digit, L"-");
+  line_edit.clear();
+  start = std::chrono::steady_clock::now();
+  typeText (line_edit, paste);
+  const auto class_duration = std::chrono::steady_clock::now() - start;
+  CPPUNIT_ASSERT ( line_edit.getText() == digits );
+
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+  std::cout << "\n  paste of " << length << " characters: "
+            << duration_cast<milliseconds>(regex_duration).count()
+            << " ms (regex), "
+            << duration_cast<milliseconds>(class_duration).count()
+            << " ms (character class) ";
+}
+
+//----------------------------------------------------------------------
+void FLineEditTest::pasteEventTest()
+{
+  // A paste event inserts the whole text at once
+
+  finalcut::FLineEdit line_edit{&root};
+  int changed{0};
+  line_edit.addCallback ("changed", [&changed] () { changed++; });
+  line_edit.setText (L"ad");
+  line_edit.setCursorPosition (2);
+
+  finalcut::FPasteEvent ev1 (finalcut::Event::Paste, L"bc");
+  line_edit.onPaste(&ev1);
+  CPPUNIT_ASSERT ( ev1.isAccepted() );
+  CPPUNIT_ASSERT ( line_edit.getText() == L"abcd" );
+  CPPUNIT_ASSERT ( changed == 1 );
+
+  // Line breaks and other control characters are dropped,
+  // the input filter is applied to every character
+  line_edit.clear();
+  changed = 0;
+  line_edit.setInputFilter (L"[-[:digit:]]");
+  finalcut::FPasteEvent ev2 (finalcut::Event::Paste, L"12\n3a-4\t5");
+  line_edit.onPaste(&ev2);
+  CPPUNIT_ASSERT ( line_edit.getText() == L"123-45" );
+  CPPUNIT_ASSERT ( changed == 1 );
+
+  // The text is cut at the maximum length
+  line_edit.clearInputFilter();
+  line_edit.clear();
+  line_edit.setMaxLength (5);
+  finalcut::FPasteEvent ev3 (finalcut::Event::Paste, L"abcdefgh");
+  line_edit.onPaste(&ev3);
+  CPPUNIT_ASSERT ( line_edit.getText() == L"abcde" );
+
+  // Nothing to insert
+  changed = 0;
+  finalcut::FPasteEvent ev4 (finalcut::Event::Paste, L"xyz");
+  line_edit.onPaste(&ev4);
+  CPPUNIT_ASSERT ( ev4.isAccepted() );
+  CPPUNIT_ASSERT ( line_edit.getText() == L"abcde" );
+  CPPUNIT_ASSERT ( changed == 0 );
+
+  // A read-only line edit ignores the event
+  line_edit.clear();
+  line_edit.setReadOnly();
+  finalcut::FPasteEvent ev5 (finalcut::Event::Paste, L"abc");
+  line_edit.onPaste(&ev5);
+  CPPUNIT_ASSERT ( ! ev5.isAccepted() );
+  CPPUNIT_ASSERT ( line_edit.getText().isEmpty() );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FLineEditTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,619 @@
+/***********************************************************************
+* flistview-test.cpp - FListView unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+auto previousNumberFromString (const finalcut::FString& str) -> uInt64
+{
+  // The number conversion of the former sort comparator
+
+  auto iter = str.cbegin();
+
+  while ( iter != str.cend() )
+  {
+    if ( wchar_t(*iter) >= L'0' && wchar_t(*iter) <= L'9' )
+    {
+      if ( iter != str.cbegin() && wchar_t(*(iter - 1)) == L'-' )
+        --iter;
+
+      break;
+    }
+
+    ++iter;
+  }
+
+  auto first_pos = iter;
+
+  if ( first_pos == str.cend() )
+    return 0;
+
+  while ( iter != str.cend() )
+  {
+    if ( wchar_t(*iter) < L'0' || wchar_t(*iter) > L'9' )
+      break;
+
+    ++iter;
+  }
+
+  auto last_pos = iter;
+
+  if ( last_pos == str.cend() )
+    return 0;
+
+  const auto pos = std::size_t(std::distance(str.cbegin(), first_pos)) + 1;
+  const auto length = std::size_t(std::distance(first_pos, last_pos));
+
+  try
+  {
+    return uInt64(str.mid(pos, length).toLong());
+  }
+  catch (const std::invalid_argument&)
+  {
+    return 0;
+  }
+  catch (const std::underflow_error&)
+  {
+    return std::numeric_limits<uInt64>::min();
+  }
+  catch (const std::overflow_error&)
+  {
+    return std::numeric_limits<uInt64>::max();
+  }
+}
+
+//----------------------------------------------------------------------
+auto getTexts (const finalcut::FListView& list_view) -> std::vector<finalcut::FString>
+{
+  std::vector<finalcut::FString> texts{};
+
+  for (const auto& item : list_view.getData())
+    texts.push_back(item->getText(1));
+
+  return texts;
+}
+
+//----------------------------------------------------------------------
+void insertTexts ( finalcut::FListView& list_view
+                 , const std::vector<finalcut::FString>& texts )
+{
+  for (const auto& text : texts)
+    list_view.insert (finalcut::FStringList{text});
+}
+
+//----------------------------------------------------------------------
+void pressKey (finalcut::FListView& list_view, finalcut::FKey key)
+{
+  finalcut::FKeyEvent ev{finalcut::Event::KeyPress, key};
+  list_view.onKeyPress(&ev);
+}
+
+
+//----------------------------------------------------------------------
+// class TreeModel
+//----------------------------------------------------------------------
+
+// 1000 top-level nodes (1 ... 1000) with 3 children each
+// (100000 + 10 * parent + n), and 2 leaf nodes below each child
+// (10 * parent + n)
+
+class TreeModel : public finalcut::FListViewModel
+{
+  public:
+    // Accessors
+    auto getChildCount (Node node) const -> std::size_t override
+    {
+      if ( node == ROOT )
+        return 1000;
+
+      if ( node < 100000 )
+        return 3;
+
+      if ( node < 1000000 )
+        return 2;
+
+      return 0;
+    }
+
+    auto getChild (Node node, std::size_t index) const -> Node override
+    {
+      if ( node == ROOT )
+        return index + 1;
+
+      if ( node < 100000 )
+        return 100000 + 10 * node + index + 1;
+
+      return 10 * node + index + 1;
+    }
+
+    auto getText (Node node, int column) const -> finalcut::FString override
+    {
+      text_requests[node]++;
+      return finalcut::FString() << node << "/" << column;
+    }
+
+    // Data members
+    std::vector<Node> expanded{};
+    std::vector<Node> collapsed{};
+    mutable std::unordered_map<Node, int> text_requests{};
+
+  private:
+    // Methods
+    void expand (Node node) override
+    {
+      expanded.push_back(node);
+    }
+
+    void collapse (Node node) override
+    {
+      collapsed.push_back(node);
+    }
+};
+
+
+//----------------------------------------------------------------------
+// class FListViewTest
+//----------------------------------------------------------------------
+
+class FListViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FListViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void sortByNameTest();
+    void sortByNumberTest();
+    void parallelSortTest();
+    void modelTest();
+    void modelExpandTest();
+    void modelCacheTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FListViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (sortByNameTest);
+    CPPUNIT_TEST (sortByNumberTest);
+    CPPUNIT_TEST (parallelSortTest);
+    CPPUNIT_TEST (modelTest);
+    CPPUNIT_TEST (modelExpandTest);
+    CPPUNIT_TEST (modelCacheTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data member
+    finalcut::FWidget root{nullptr};
+};
+
+//----------------------------------------------------------------------
+void FListViewTest::classNameTest()
+{
+  const finalcut::FListView list_view{&root};
+  const finalcut::FString& classname = list_view.getClassName();
+  CPPUNIT_ASSERT ( classname == "FListView" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::sortByNameTest()
+{
+  // Alphabetical order without regard to upper and lower case
+
+  finalcut::FListView list_view{&root};
+  list_view.addColumn ("Name");
+  insertTexts (list_view, { L"delta", L"Alpha", L"charlie", L"Bravo"
+                          , L"ALPHABET", L"echo 2", L"Echo 10"
+                          , L"_tmp", L"zulu", L"", L"Zeta" } );
+  list_view.setColumnSortType (1, finalcut::SortType::Name);
+  list_view.setColumnSort (1, finalcut::SortOrder::Ascending);
+  list_view.sort();
+  auto texts = getTexts(list_view);
+  const std::vector<finalcut::FString> ascending
+  {
+    L"", L"_tmp", L"Alpha", L"ALPHABET", L"Bravo", L"charlie"
+  , L"delta", L"Echo 10", L"echo 2", L"Zeta", L"zulu"
+  };
+  CPPUNIT_ASSERT ( texts == ascending );
+
+  // The same order as with the previous comparator
+  const auto previous_less = [] ( const finalcut::FString& lhs
+                                , const finalcut::FString& rhs )
+  {
+    return finalcut::FStringCaseCompare(lhs, rhs) < 0;
+  };
+  CPPUNIT_ASSERT ( std::is_sorted(texts.cbegin(), texts.cend(), previous_less) );
+
+  list_view.setColumnSort (1, finalcut::SortOrder::Descending);
+  list_view.sort();
+  texts = getTexts(list_view);
+  CPPUNIT_ASSERT ( std::equal(texts.cbegin(), texts.cend(), ascending.crbegin()) );
+
+  // The case-folded order of equal words keeps both words together
+  list_view.clear();
+  insertTexts (list_view, { L"b", L"A", L"B", L"a", L"c" } );
+  list_view.setColumnSort (1, finalcut::SortOrder::Ascending);
+  list_view.sort();
+  texts = getTexts(list_view);
+  CPPUNIT_ASSERT ( std::is_sorted(texts.cbegin(), texts.cend(), previous_less) );
+  CPPUNIT_ASSERT ( texts[0].toLower() == L"a" );
+  CPPUNIT_ASSERT ( texts[1].toLower() == L"a" );
+  CPPUNIT_ASSERT ( texts[2].toLower() == L"b" );
+  CPPUNIT_ASSERT ( texts[3].toLower() == L"b" );
+  CPPUNIT_ASSERT ( texts[4] == L"c" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::sortByNumberTest()
+{
+  // Sorting by the first number in the text
+
+  finalcut::FListView list_view{&root};
+  list_view.addColumn ("Size");
+  insertTexts (list_view, { L"10 kB", L"2 kB", L"size 300 kB", L"-5 kB"
+                          , L"-40 kB", L"0 kB", L"none", L"123"
+                          , L"99999999999999999999 kB", L"7.5 kB" } );
+  list_view.setColumnSortType (1, finalcut::SortType::Number);
+  list_view.setColumnSort (1, finalcut::SortOrder::Ascending);
+  list_view.sort();
+  auto texts = getTexts(list_view);
+  CPPUNIT_ASSERT ( texts.size() == 10 );
+
+  // Texts without a number, with a number at the end of the text
+  // or with a negative number are sorted like zero
+  const std::vector<finalcut::FString> zero_texts
+  {
+    L"0 kB", L"none", L"123", L"-5 kB", L"-40 kB"
+  };
+
+  for (std::size_t i{0}; i < 5; i++)
+    CPPUNIT_ASSERT ( std::find(zero_texts.cbegin(), zero_texts.cend(), texts[i])
+                     != zero_texts.cend() );
+
+  CPPUNIT_ASSERT ( texts[5] == L"2 kB" );
+  CPPUNIT_ASSERT ( texts[6] == L"7.5 kB" );
+  CPPUNIT_ASSERT ( texts[7] == L"10 kB" );
+  CPPUNIT_ASSERT ( texts[8] == L"size 300 kB" );
+  CPPUNIT_ASSERT ( texts[9] == L"99999999999999999999 kB" );  // Overflow
+
+  // The same order as with the previous comparator
+  const auto previous_less = [] ( const finalcut::FString& lhs
+                                , const finalcut::FString& rhs )
+  {
+    return previousNumberFromString(lhs) < previousNumberFromString(rhs);
+  };
+  CPPUNIT_ASSERT ( std::is_sorted(texts.cbegin(), texts.cend(), previous_less) );
+
+  list_view.setColumnSort (1, finalcut::SortOrder::Descending);
+  list_view.sort();
+  texts = getTexts(list_view);
+  CPPUNIT_ASSERT ( std::is_sorted(texts.crbegin(), texts.crend(), previous_less) );
+  CPPUNIT_ASSERT ( texts[0] == L"99999999999999999999 kB" );
+  CPPUNIT_ASSERT ( texts[1] == L"size 300 kB" );
+  CPPUNIT_ASSERT ( texts[4] == L"2 kB" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::parallelSortTest()
+{
+  // Large lists are sorted in blocks by the worker threads
+
+  const auto thread_count = finalcut::FListView::getSortThreadCount();
+  const auto threshold = finalcut::FListView::getParallelSortThreshold();
+  CPPUNIT_ASSERT ( thread_count == 0 );  // Automatic
+  CPPUNIT_ASSERT ( threshold == 16384 );
+
+  constexpr int count{40000};
+  std::vector<finalcut::FString> texts{};
+  uInt32 value{12345};
+
+  for (int i{0}; i < count; i++)
+  {
+    value = value * 1103515245U + 12345U;  // Pseudo-random numbers
+    const auto number = int(value >> 16) % 100000 - 50000;
+    texts.emplace_back(std::to_wstring(number) + (i % 2 ? L" Item " : L" item ")
+                     + std::to_wstring(i));
+  }
+
+  const auto sortTexts = [this, &texts] ( finalcut::SortType type
+                                        , finalcut::SortOrder order )
+  {
+    finalcut::FListView list_view{&root};
+    list_view.addColumn ("Text");
+    insertTexts (list_view, texts);
+    list_view.setColumnSortType (1, type);
+    list_view.setColumnSort (1, order);
+    list_view.sort();
+    return getTexts(list_view);
+  };
+
+  const auto previous_number_less = [] ( const finalcut::FString& lhs
+                                       , const finalcut::FString& rhs )
+  {
+    return previousNumberFromString(lhs) < previousNumberFromString(rhs);
+  };
+
+  // The serial sort as reference
+  finalcut::FListView::setParallelSortThreshold (std::numeric_limits<std::size_t>::max());
+  const auto serial_names = sortTexts (finalcut::SortType::Name, finalcut::SortOrder::Descending);
+  const auto serial_numbers = sortTexts (finalcut::SortType::Number, finalcut::SortOrder::Ascending);
+  CPPUNIT_ASSERT ( serial_names.size() == std::size_t(count) );
+  CPPUNIT_ASSERT ( std::is_sorted(serial_numbers.cbegin(), serial_numbers.cend(), previous_number_less) );
+
+  // Sorting with 2 to 8 blocks (1 to 7 worker threads)
+  finalcut::FListView::setParallelSortThreshold (16);
+
+  for (const std::size_t threads : {1U, 2U, 3U, 7U, 2U})
+  {
+    finalcut::FListView::setSortThreadCount (threads);
+    CPPUNIT_ASSERT ( finalcut::FListView::getSortThreadCount() == threads );
+
+    // All names are different, so the order is the same
+    CPPUNIT_ASSERT ( sortTexts (finalcut::SortType::Name, finalcut::SortOrder::Descending)
+                     == serial_names );
+
+    // Equal numbers can be in a different order
+    auto numbers = sortTexts (finalcut::SortType::Number, finalcut::SortOrder::Ascending);
+    CPPUNIT_ASSERT ( std::is_sorted(numbers.cbegin(), numbers.cend(), previous_number_less) );
+    CPPUNIT_ASSERT ( std::is_permutation ( numbers.cbegin(), numbers.cend()
+                                         , serial_numbers.cbegin() ) );
+  }
+
+  // A short list with more blocks than items
+  finalcut::FListView::setSortThreadCount (7);
+  finalcut::FListView list_view{&root};
+  list_view.addColumn ("Name");
+  insertTexts (list_view, { L"d", L"b", L"e", L"a", L"c" } );
+  finalcut::FListView::setParallelSortThreshold (2);
+  list_view.setColumnSortType (1, finalcut::SortType::Name);
+  list_view.setColumnSort (1, finalcut::SortOrder::Ascending);
+  list_view.sort();
+  const std::vector<finalcut::FString> sorted{L"a", L"b", L"c", L"d", L"e"};
+  CPPUNIT_ASSERT ( getTexts(list_view) == sorted );
+
+  finalcut::FListView::setSortThreadCount (thread_count);
+  finalcut::FListView::setParallelSortThreshold (threshold);
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::modelTest()
+{
+  finalcut::FListView list_view{&root};
+  list_view.addColumn ("Name");
+  list_view.addColumn ("Value");
+  insertTexts (list_view, { L"one", L"two", L"three" } );
+  CPPUNIT_ASSERT ( list_view.getCount() == 3 );
+  CPPUNIT_ASSERT ( list_view.numOfChildren() > 3 );
+  const auto children_before = list_view.numOfChildren();
+  CPPUNIT_ASSERT ( ! list_view.hasModel() );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == finalcut::FListViewModel::ROOT );
+
+  // The model rows replace the inserted items
+  auto model = std::make_shared<TreeModel>();
+  list_view.setModel (model);
+  CPPUNIT_ASSERT ( list_view.hasModel() );
+  CPPUNIT_ASSERT ( list_view.getModel() == model );
+  CPPUNIT_ASSERT ( list_view.getData().empty() );
+  CPPUNIT_ASSERT ( list_view.numOfChildren() == children_before - 3 );
+  CPPUNIT_ASSERT ( list_view.getCount() == 1000 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  CPPUNIT_ASSERT ( list_view.getCurrentItem() == nullptr );
+
+  // No items can be inserted
+  list_view.insert (finalcut::FStringList{L"four"});
+  CPPUNIT_ASSERT ( list_view.getData().empty() );
+  finalcut::FListView other_list_view{&root};
+  other_list_view.addColumn ("Name");
+  insertTexts (other_list_view, { L"five" } );
+  auto item = static_cast<finalcut::FListViewItem*>(other_list_view.getData().front());
+  list_view.insert (item);
+  CPPUNIT_ASSERT ( item->getParent() == &other_list_view );
+  CPPUNIT_ASSERT ( other_list_view.getCount() == 1 );
+  CPPUNIT_ASSERT ( list_view.getData().empty() );
+  CPPUNIT_ASSERT ( list_view.numOfChildren() == children_before - 3 );
+  CPPUNIT_ASSERT ( list_view.getCount() == 1000 );
+
+  // Without a tree view, the rows cannot be expanded
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1000 );
+  CPPUNIT_ASSERT ( model->expanded.empty() );
+
+  pressKey (list_view, finalcut::FKey::Down);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 2 );
+  pressKey (list_view, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1000 );
+  pressKey (list_view, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+
+  // Back to the item mode
+  list_view.unsetModel();
+  CPPUNIT_ASSERT ( ! list_view.hasModel() );
+  CPPUNIT_ASSERT ( list_view.getCount() == 0 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == finalcut::FListViewModel::ROOT );
+  insertTexts (list_view, { L"six" } );
+  CPPUNIT_ASSERT ( list_view.getCount() == 1 );
+  CPPUNIT_ASSERT ( list_view.getCurrentItem()->getText(1) == L"six" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::modelExpandTest()
+{
+  // The row numbers are mapped to the model nodes
+  // after expanding and collapsing
+
+  finalcut::FListView list_view{&root};
+  list_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{40, 12});
+  list_view.addColumn ("Node");
+  list_view.setTreeView();
+  auto model = std::make_shared<TreeModel>();
+  list_view.setModel (model);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1000 );
+
+  const auto nextNodes = [&list_view] (std::size_t n)
+  {
+    std::vector<finalcut::FListViewModel::Node> nodes{};
+
+    for (std::size_t i{0}; i < n; i++)
+    {
+      pressKey (list_view, finalcut::FKey::Down);
+      nodes.push_back(list_view.getCurrentNode());
+    }
+
+    return nodes;
+  };
+
+  // Expand row 0 and its first child
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1003 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  pressKey (list_view, finalcut::FKey::Down);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 100011 );
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1005 );
+  CPPUNIT_ASSERT ( model->expanded.size() == 2 );
+  CPPUNIT_ASSERT ( model->expanded[0] == 1 );
+  CPPUNIT_ASSERT ( model->expanded[1] == 100011 );
+
+  // Expanding an expanded row or a leaf does nothing
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1005 );
+  CPPUNIT_ASSERT ( nextNodes(1)[0] == 1000111 );
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1005 );
+  CPPUNIT_ASSERT ( model->expanded.size() == 2 );
+
+  using Nodes = std::vector<finalcut::FListViewModel::Node>;
+  CPPUNIT_ASSERT ( nextNodes(4) == Nodes({1000112, 100012, 100013, 2}) );
+
+  // Expand row 6 (node 2) and the last child of node 2
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1008 );
+  CPPUNIT_ASSERT ( nextNodes(3) == Nodes({100021, 100022, 100023}) );
+  pressKey (list_view, finalcut::FKey::Right);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1010 );
+  CPPUNIT_ASSERT ( nextNodes(4) == Nodes({1000231, 1000232, 3, 4}) );
+
+  // The last row
+  pressKey (list_view, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1000 );
+
+  // Collapsing node 1 also collapses its expanded child
+  pressKey (list_view, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  pressKey (list_view, finalcut::FKey::Left);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1005 );
+  CPPUNIT_ASSERT ( model->collapsed.size() == 2 );
+  CPPUNIT_ASSERT ( model->collapsed[0] == 100011 );
+  CPPUNIT_ASSERT ( model->collapsed[1] == 1 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  CPPUNIT_ASSERT ( nextNodes(6) == Nodes({2, 100021, 100022, 100023, 1000231, 1000232}) );
+
+  // Left on a child row jumps to the parent row
+  pressKey (list_view, finalcut::FKey::Left);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 100023 );
+  pressKey (list_view, finalcut::FKey::Left);
+  CPPUNIT_ASSERT ( list_view.getCount() == 1003 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 100023 );
+  pressKey (list_view, finalcut::FKey::Left);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 2 );
+  CPPUNIT_ASSERT ( nextNodes(4) == Nodes({100021, 100022, 100023, 3}) );
+
+  // A reset collapses all rows
+  list_view.resetModel();
+  CPPUNIT_ASSERT ( list_view.getCount() == 1000 );
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  CPPUNIT_ASSERT ( nextNodes(2) == Nodes({2, 3}) );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::modelCacheTest()
+{
+  // The cache keeps the previous, the current and the next page
+
+  std::unordered_map<std::size_t, int> cache{};
+
+  for (std::size_t i{0}; i < 40; i++)
+    cache[i] = int(i);
+
+  finalcut::trimPageCache (cache, 0, 10);  // Not more than 4 pages
+  CPPUNIT_ASSERT ( cache.size() == 40 );
+  cache[40] = 40;
+  finalcut::trimPageCache (cache, 20, 10);
+  CPPUNIT_ASSERT ( cache.size() == 30 );
+  CPPUNIT_ASSERT ( cache.count(9) == 0 );
+  CPPUNIT_ASSERT ( cache.count(10) == 1 );
+  CPPUNIT_ASSERT ( cache.count(39) == 1 );
+  CPPUNIT_ASSERT ( cache.count(40) == 0 );
+
+  // The list view trims the cache while drawing the visible rows
+  finalcut::FListView list_view{&root};
+  list_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{40, 12});
+  list_view.addColumn ("Node");
+  auto model = std::make_shared<TreeModel>();
+  list_view.setModel (model);
+  list_view.setFlags().visibility.shown = true;
+  pressKey (list_view, finalcut::FKey::Down);
+  CPPUNIT_ASSERT ( model->text_requests[1] == 1 );
+  CPPUNIT_ASSERT ( model->text_requests[2] == 1 );
+
+  // Row 0 is still cached after the next page
+  pressKey (list_view, finalcut::FKey::Page_down);
+  pressKey (list_view, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  CPPUNIT_ASSERT ( model->text_requests[1] == 1 );
+
+  // Far away rows are removed from the cache
+  for (int i{0}; i < 10; i++)
+    pressKey (list_view, finalcut::FKey::Page_down);
+
+  CPPUNIT_ASSERT ( model->text_requests[1] == 1 );
+  pressKey (list_view, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( list_view.getCurrentNode() == 1 );
+  CPPUNIT_ASSERT ( model->text_requests[1] == 2 );
+  CPPUNIT_ASSERT ( model->text_requests[1000] == 0 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FListViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -28,6 +28,8 @@
 #include <cppunit/TestResultCollector.h>
 #include <cppunit/TestRunner.h>
 
+#include <vector>
+
 #include <final/final.h>
 
 namespace test
@@ -113,6 +115,7 @@ class FMouseTest : public CPPUNIT_NS::TestFixture
     void sgrMouseTest();
     void urxvtMouseTest();
     void mouseControlTest();
+    void mouseQueueTest();
 
   private:
     auto insertData (std::initializer_list<char>) -> finalcut::FKeyboard::keybuffer;
@@ -132,6 +135,7 @@ class FMouseTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (sgrMouseTest);
     CPPUNIT_TEST (urxvtMouseTest);
     CPPUNIT_TEST (mouseControlTest);
+    CPPUNIT_TEST (mouseQueueTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -1661,6 +1665,64 @@ void FMouseTest::mouseControlTest()
   mouse_control.disable();
 }
 
+//----------------------------------------------------------------------
+void FMouseTest::mouseQueueTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  CPPUNIT_ASSERT ( ! finalcut::FApplication::isQuit() );  // Need in processQueuedInput()
+
+  finalcut::FMouseControl mouse_control;
+  std::vector<finalcut::FPoint> positions{};
+  std::vector<finalcut::FMouseControl::FMouseDataPtr> kept_events{};
+  auto cmd = [&positions, &kept_events] (const finalcut::FMouseData& md)
+             {
+               positions.push_back(md.getPos());
+
+               if ( positions.size() == 1 )  // Hold the first event
+                 kept_events.push_back(finalcut::FMouseControl::getCurrentMouseEvent());
+             };
+  finalcut::FMouseCommand mouse_cmd (cmd);
+  mouse_control.setEventCommand (mouse_cmd);
+  mouse_control.setMaxWidth(100);
+  mouse_control.setMaxHeight(40);
+  mouse_control.useXtermMouse(true);
+
+  // All reports of a read batch are decoded in one pass
+  auto rawdata = insertData ({ 0x1b, '[', '<', '0', ';', '1', ';', '2', 'M'
+                             , 0x1b, '[', '<', '3', '2', ';', '2', ';', '2', 'M'
+                             , 0x1b, '[', '<', '3', '2', ';', '3', ';', '2', 'M'
+                             , 0x1b, '[', '<', '3', '2', ';', '4', ';', '3', 'M'
+                             , 0x1b, '[', '<', '0', ';', '4', ';', '3', 'm' });
+  auto tv = finalcut::FObjectTimer::getCurrentTime();
+
+  while ( rawdata.hasData() )
+  {
+    mouse_control.setRawData (finalcut::FMouse::MouseType::Sgr, rawdata);
+    mouse_control.processEvent (tv);
+  }
+
+  CPPUNIT_ASSERT ( ! mouse_control.hasData() );
+  CPPUNIT_ASSERT ( mouse_control.hasDataInQueue() );
+  CPPUNIT_ASSERT ( positions.empty() );
+
+  mouse_control.processQueuedInput();
+  CPPUNIT_ASSERT ( ! mouse_control.hasDataInQueue() );
+  CPPUNIT_ASSERT ( positions.size() == 5 );
+  CPPUNIT_ASSERT ( positions[0] == finalcut::FPoint(1, 2) );
+  CPPUNIT_ASSERT ( positions[1] == finalcut::FPoint(2, 2) );
+  CPPUNIT_ASSERT ( positions[2] == finalcut::FPoint(3, 2) );
+  CPPUNIT_ASSERT ( positions[3] == finalcut::FPoint(4, 3) );
+  CPPUNIT_ASSERT ( positions[4] == finalcut::FPoint(4, 3) );
+  CPPUNIT_ASSERT ( ! mouse_control.getCurrentMouseEvent() );
+
+  // An event held by a handler is not overwritten by later events
+  CPPUNIT_ASSERT ( kept_events.size() == 1 );
+  CPPUNIT_ASSERT ( kept_events[0]->getPos() == finalcut::FPoint(1, 2) );
+  CPPUNIT_ASSERT ( kept_events[0]->isLeftButtonPressed() );
+}
+
 //----------------------------------------------------------------------
 auto FMouseTest::insertData (std::initializer_list<char> list) -> finalcut::FKeyboard::keybuffer
 {
@@ -109,6 +109,32 @@ class FObject_timer : public finalcut::FObject
 
 //----------------------------------------------------------------------
 
+class FObject_child : public finalcut::FObject
+{
+  public:
+    // Constructor
+    FObject_child (FObject* parent, std::size_t& counter)
+      : finalcut::FObject{parent}
+      , destroyed{counter}
+    { }
+
+    // Destructor
+    ~FObject_child() override
+    {
+      // The parent link exists until the end of the destructor, and
+      // the parent has already detached its children list, so the
+      // delChild() call does not have to search the list
+      if ( getParent() && ! getParent()->hasChildren() )
+        destroyed++;
+    }
+
+  private:
+    // Data member
+    std::size_t& destroyed;
+};
+
+//----------------------------------------------------------------------
+
 class FObject_userEvent : public finalcut::FObject
 {
   public:
@@ -157,6 +183,7 @@ class FObjectTest : public CPPUNIT_NS::TestFixture
     void setParentTest();
     void addTest();
     void delTest();
+    void teardownTest();
     void elementAccessTest();
     void iteratorTest();
     void userEventTest();
@@ -174,6 +201,7 @@ class FObjectTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (setParentTest);
     CPPUNIT_TEST (addTest);
     CPPUNIT_TEST (delTest);
+    CPPUNIT_TEST (teardownTest);
     CPPUNIT_TEST (elementAccessTest);
     CPPUNIT_TEST (iteratorTest);
     CPPUNIT_TEST (userEventTest);
@@ -449,6 +477,41 @@ void FObjectTest::delTest()
   delete obj;
 }
 
+//----------------------------------------------------------------------
+void FObjectTest::teardownTest()
+{
+  // obj -> 200000 children -> 1 grandchild each
+
+  constexpr std::size_t count{200'000};
+  std::size_t destroyed{0};
+  auto obj = new finalcut::FObject();
+
+  for (std::size_t i{0}; i < count; i++)
+  {
+    auto child = new test::FObject_child(obj, destroyed);
+    new test::FObject_child(child, destroyed);
+  }
+
+  CPPUNIT_ASSERT ( obj->numOfChildren() == count );
+
+  // Objects without own timers leave the timer list untouched
+  test::FObject_protected t;
+  CPPUNIT_ASSERT ( t.getTimerList()->empty() );
+  t.finalcut::FObject::addTimer(300'000);
+  CPPUNIT_ASSERT ( t.getTimerList()->size() == 1 );
+  auto timer_child = new test::FObject_timer();
+  timer_child->setParent(obj);
+  timer_child->addTimer(300'000);
+  CPPUNIT_ASSERT ( t.getTimerList()->size() == 2 );
+
+  // The children are detached before they are deleted
+  delete obj;
+  CPPUNIT_ASSERT ( destroyed == 2 * count );
+  CPPUNIT_ASSERT ( t.getTimerList()->size() == 1 );
+  t.finalcut::FObject::delOwnTimers();
+  CPPUNIT_ASSERT ( t.getTimerList()->empty() );
+}
+
 //----------------------------------------------------------------------
 void FObjectTest::elementAccessTest()
 {
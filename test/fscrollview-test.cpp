@@ -0,0 +1,169 @@
+/***********************************************************************
+* fscrollview-test.cpp - FScrollView unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class ScrollView
+//----------------------------------------------------------------------
+
+class ScrollView : public finalcut::FScrollView
+{
+  public:
+    // Using-declaration
+    using finalcut::FScrollView::FScrollView;
+
+    // Accessor
+    auto getViewport() -> const FTermArea*
+    {
+      return getPrintArea();
+    }
+
+    // Method
+    void printAt (const finalcut::FPoint& pos, const finalcut::FString& str)
+    {
+      print() << pos << str;
+    }
+};
+
+
+//----------------------------------------------------------------------
+// class FScrollViewTest
+//----------------------------------------------------------------------
+
+class FScrollViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FScrollViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void tiledViewportTest();
+    void resizeTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FScrollViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (tiledViewportTest);
+    CPPUNIT_TEST (resizeTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data member
+    finalcut::FWidget root{nullptr};
+};
+
+//----------------------------------------------------------------------
+void FScrollViewTest::classNameTest()
+{
+  const finalcut::FScrollView scroll_view{&root};
+  const finalcut::FString& classname = scroll_view.getClassName();
+  CPPUNIT_ASSERT ( classname == "FScrollView" );
+}
+
+//----------------------------------------------------------------------
+void FScrollViewTest::tiledViewportTest()
+{
+  // A large scroll area uses memory only for the drawn lines
+
+  ScrollView scroll_view{&root};
+  scroll_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{40, 20});
+  scroll_view.setScrollSize (finalcut::FSize{5000, 2000});
+  const auto viewport = scroll_view.getViewport();
+  CPPUNIT_ASSERT ( viewport != nullptr );
+  CPPUNIT_ASSERT ( viewport->tiled );
+  CPPUNIT_ASSERT ( viewport->data.empty() );
+  CPPUNIT_ASSERT ( viewport->size.width == 5000 );
+  CPPUNIT_ASSERT ( viewport->size.height == 2000 );
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 0 );
+
+  // Unallocated tiles read as blank characters
+  CPPUNIT_ASSERT ( viewport->getFChar(4999, 1999).ch[0] == L' ' );
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 0 );
+
+  // Writing allocates only the tile of the written line
+  scroll_view.printAt (finalcut::FPoint{4990, 1000}, "Hello");
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 1 );
+  CPPUNIT_ASSERT ( viewport->getFChar(4989, 999).ch[0] == L'H' );
+  CPPUNIT_ASSERT ( viewport->getFChar(4993, 999).ch[0] == L'o' );
+  CPPUNIT_ASSERT ( viewport->getFChar(4994, 999).ch[0] == L' ' );
+  CPPUNIT_ASSERT ( viewport->getFChar(0, 998).ch[0] == L' ' );
+
+  // The last column of a line in another tile
+  scroll_view.printAt (finalcut::FPoint{4999, 16}, "ab");
+  CPPUNIT_ASSERT ( viewport->getFChar(4998, 15).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( viewport->getFChar(4999, 15).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 2 );
+
+  // The full-size area would have needed 10 million characters
+  const auto tile_chars = std::size_t(viewport->size.width)
+                        * finalcut::FVTerm::FTermArea::TILE_HEIGHT;
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() * tile_chars
+                   < std::size_t(5000 * 2000) / 50 );
+
+  // Clearing releases the tiles
+  scroll_view.clearArea (L'.');
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 0 );
+  CPPUNIT_ASSERT ( viewport->getFChar(4989, 999).ch[0] == L'.' );
+}
+
+//----------------------------------------------------------------------
+void FScrollViewTest::resizeTest()
+{
+  ScrollView scroll_view{&root};
+  scroll_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{40, 20});
+  scroll_view.setScrollSize (finalcut::FSize{100, 100});
+  const auto viewport = scroll_view.getViewport();
+  scroll_view.printAt (finalcut::FPoint{1, 1}, "top");
+  scroll_view.printAt (finalcut::FPoint{1, 100}, "bottom");
+  CPPUNIT_ASSERT ( viewport->tiles.size() == 7 );
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 2 );
+  CPPUNIT_ASSERT ( viewport->getFChar(0, 99).ch[0] == L'b' );
+
+  // A new scroll size starts with an empty area
+  scroll_view.setScrollSize (finalcut::FSize{200, 17});
+  CPPUNIT_ASSERT ( viewport->size.width == 200 );
+  CPPUNIT_ASSERT ( viewport->size.height == 18 );  // Viewport height
+  CPPUNIT_ASSERT ( viewport->tiles.size() == 2 );
+  CPPUNIT_ASSERT ( viewport->getAllocatedTileCount() == 0 );
+  CPPUNIT_ASSERT ( viewport->getFChar(0, 0).ch[0] == L' ' );
+  scroll_view.printAt (finalcut::FPoint{200, 18}, "z");
+  CPPUNIT_ASSERT ( viewport->getFChar(199, 17).ch[0] == L'z' );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FScrollViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,277 @@
+/***********************************************************************
+* fsessionrecorder-test.cpp - FSessionRecorder unit tests              *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+auto createTempFileName() -> std::string
+{
+  char name[] = "/tmp/fsessionrecorder-test-XXXXXX";
+  const int fd = mkstemp(name);
+
+  if ( fd < 0 )
+    return {};
+
+  close(fd);
+  return name;
+}
+
+//----------------------------------------------------------------------
+auto makeRecord ( finalcut::FSessionRecorder::RecordType type
+                , uInt64 time
+                , const std::string& data )
+  -> finalcut::FSessionRecorder::Record
+{
+  finalcut::FSessionRecorder::Record record{};
+  record.type = type;
+  record.time = time;
+  record.data = data;
+  return record;
+}
+
+
+//----------------------------------------------------------------------
+// class FSessionRecorderTest
+//----------------------------------------------------------------------
+
+class FSessionRecorderTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FSessionRecorderTest() = default;
+
+  protected:
+    void classNameTest();
+    void recordTest();
+    void loadTest();
+    void frameBytesTest();
+    void replayTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FSessionRecorderTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (recordTest);
+    CPPUNIT_TEST (loadTest);
+    CPPUNIT_TEST (frameBytesTest);
+    CPPUNIT_TEST (replayTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FSessionRecorderTest::classNameTest()
+{
+  const finalcut::FSessionRecorder recorder{};
+  const finalcut::FString& classname1 = recorder.getClassName();
+  CPPUNIT_ASSERT ( classname1 == "FSessionRecorder" );
+
+  const finalcut::FSessionReplay replay{{}};
+  const finalcut::FString& classname2 = replay.getClassName();
+  CPPUNIT_ASSERT ( classname2 == "FSessionReplay" );
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorderTest::recordTest()
+{
+  using RecordType = finalcut::FSessionRecorder::RecordType;
+  const auto filename = createTempFileName();
+  CPPUNIT_ASSERT ( ! filename.empty() );
+
+  finalcut::FSessionRecorder recorder{};
+  CPPUNIT_ASSERT ( ! recorder.isRecording() );
+  recorder.recordInput ("ignored", 7);  // Not recording yet
+  CPPUNIT_ASSERT ( ! recorder.start("/nonexistent/dir/session") );
+  CPPUNIT_ASSERT ( ! recorder.isRecording() );
+
+  CPPUNIT_ASSERT ( recorder.start(filename) );
+  CPPUNIT_ASSERT ( recorder.isRecording() );
+  recorder.recordResize (132, 43);
+  recorder.recordOutput ("\033[H", 3);
+  recorder.recordOutput ("abc", 3);  // Joined with the previous output
+  recorder.recordFrame();
+  recorder.recordFrame();  // Empty frames are not recorded
+  recorder.recordInput ("x", 1);
+  recorder.recordInput ("\0y", 2);
+  recorder.recordOutput ("X", 1);
+  recorder.recordOutput (nullptr, 1);  // Ignored
+  recorder.recordFrame();
+  recorder.recordOutput ("end", 3);  // Written by stop()
+  recorder.stop();
+  CPPUNIT_ASSERT ( ! recorder.isRecording() );
+  recorder.recordOutput ("ignored", 7);
+
+  const auto records = finalcut::FSessionRecorder::load(filename);
+  std::remove(filename.c_str());
+  CPPUNIT_ASSERT ( records.size() == 7 );
+  CPPUNIT_ASSERT ( records[0].type == RecordType::Resize );
+  CPPUNIT_ASSERT ( records[1].type == RecordType::Output );
+  CPPUNIT_ASSERT ( records[1].data == "\033[Habc" );
+  CPPUNIT_ASSERT ( records[2].type == RecordType::Frame );
+  CPPUNIT_ASSERT ( records[2].data.empty() );
+  CPPUNIT_ASSERT ( records[3].type == RecordType::Input );
+  CPPUNIT_ASSERT ( records[3].data == std::string("x\0y", 3) );
+  CPPUNIT_ASSERT ( records[4].type == RecordType::Output );
+  CPPUNIT_ASSERT ( records[4].data == "X" );
+  CPPUNIT_ASSERT ( records[5].type == RecordType::Frame );
+  CPPUNIT_ASSERT ( records[6].type == RecordType::Output );
+  CPPUNIT_ASSERT ( records[6].data == "end" );
+
+  // The timestamps are in chronological order
+  for (std::size_t n{1}; n < records.size(); n++)
+    CPPUNIT_ASSERT ( records[n - 1].time <= records[n].time );
+
+  const auto size = finalcut::FSessionRecorder::getTerminalSize(records[0]);
+  CPPUNIT_ASSERT ( size.first == 132 );
+  CPPUNIT_ASSERT ( size.second == 43 );
+  const auto no_size = finalcut::FSessionRecorder::getTerminalSize(records[1]);
+  CPPUNIT_ASSERT ( no_size.first == 0 );
+  CPPUNIT_ASSERT ( no_size.second == 0 );
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorderTest::loadTest()
+{
+  using FSessionRecorder = finalcut::FSessionRecorder;
+  CPPUNIT_ASSERT ( FSessionRecorder::load("/nonexistent/session").empty() );
+
+  const auto filename = createTempFileName();
+  CPPUNIT_ASSERT ( ! filename.empty() );
+
+  // Wrong file header
+  {
+    std::ofstream file(filename, std::ios::binary);
+    file << "FINALCUT-SESSION 2\n";
+  }
+
+  CPPUNIT_ASSERT ( FSessionRecorder::load(filename).empty() );
+
+  // A truncated record ends the list
+  {
+    std::ofstream file(filename, std::ios::binary);
+    file << "FINALCUT-SESSION 1\n";
+    file.write ("I\x01\0\0\0\0\0\0\0\x02\0\0\0ab", 15);
+    file.write ("O\x02\0\0\0\0\0\0\0\x09\0\0\0abc", 16);
+  }
+
+  const auto records = FSessionRecorder::load(filename);
+  std::remove(filename.c_str());
+  CPPUNIT_ASSERT ( records.size() == 1 );
+  CPPUNIT_ASSERT ( records[0].type == FSessionRecorder::RecordType::Input );
+  CPPUNIT_ASSERT ( records[0].time == 1 );
+  CPPUNIT_ASSERT ( records[0].data == "ab" );
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorderTest::frameBytesTest()
+{
+  using RecordType = finalcut::FSessionRecorder::RecordType;
+  const finalcut::FSessionReplay replay
+  {{
+    makeRecord (RecordType::Resize, 0, std::string(8, '\0')),
+    makeRecord (RecordType::Output, 1, "abcd"),
+    makeRecord (RecordType::Output, 2, "ef"),
+    makeRecord (RecordType::Frame, 3, ""),
+    makeRecord (RecordType::Input, 4, "q"),
+    makeRecord (RecordType::Frame, 5, ""),
+    makeRecord (RecordType::Output, 6, "ghi"),
+    makeRecord (RecordType::Frame, 7, ""),
+    makeRecord (RecordType::Output, 8, "jk")
+  }};
+
+  CPPUNIT_ASSERT ( replay.getRecordList().size() == 9 );
+  const auto frame_bytes = replay.getRecordedFrameBytes();
+  CPPUNIT_ASSERT ( frame_bytes.size() == 4 );
+  CPPUNIT_ASSERT ( frame_bytes[0] == 6 );
+  CPPUNIT_ASSERT ( frame_bytes[1] == 0 );
+  CPPUNIT_ASSERT ( frame_bytes[2] == 3 );
+  CPPUNIT_ASSERT ( frame_bytes[3] == 2 );
+}
+
+//----------------------------------------------------------------------
+void FSessionRecorderTest::replayTest()
+{
+  // Replays two inputs with "cat" on a pseudo terminal
+
+  using RecordType = finalcut::FSessionRecorder::RecordType;
+  finalcut::FSessionReplay replay
+  {{
+    makeRecord (RecordType::Input, 1000, "hello\n"),
+    makeRecord (RecordType::Output, 2000, "hello\r\nhello\r\n"),
+    makeRecord (RecordType::Frame, 2000, ""),
+    makeRecord (RecordType::Input, 30000, "world\n")
+  }};
+
+  replay.setSettleTime (50'000);  // 50 ms
+  replay.setTimeout (2'000'000);  // 2 s
+  replay.setTiming (finalcut::FSessionReplay::Timing::Recorded);
+  const auto result = replay.run({"cat"});
+  CPPUNIT_ASSERT ( result.startup_bytes == 0 );
+  CPPUNIT_ASSERT ( result.inputs.size() == 2 );
+
+  for (const auto& input : result.inputs)
+  {
+    CPPUNIT_ASSERT ( input.type == RecordType::Input );
+    CPPUNIT_ASSERT ( input.input_bytes == 6 );
+    // Terminal echo and output of cat: "hello\r\nhello\r\n"
+    CPPUNIT_ASSERT ( input.output_bytes == 14 );
+    CPPUNIT_ASSERT ( input.latency <= input.settle_time );
+    CPPUNIT_ASSERT ( input.settle_time < 2'000'000 );
+  }
+
+  CPPUNIT_ASSERT ( result.exit_status != -1 );
+
+  std::ostringstream report{};
+  finalcut::FSessionReplay::printReport (result, report);
+  CPPUNIT_ASSERT ( report.str().find("Inputs: 2") != std::string::npos );
+
+  // An empty command and an unknown program
+  CPPUNIT_ASSERT ( replay.run({}).exit_status == -1 );
+  const auto failed = replay.run({"/nonexistent/program"});
+  CPPUNIT_ASSERT ( failed.inputs.empty() );
+  CPPUNIT_ASSERT ( failed.exit_status == 127 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FSessionRecorderTest);
+
+// The general unit test main part
+#include <main-test.inc>
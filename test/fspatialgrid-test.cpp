@@ -0,0 +1,257 @@
+/***********************************************************************
+* fspatialgrid-test.cpp - FSpatialGrid unit tests                      *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <random>
+#include <vector>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+auto firstHit ( const finalcut::FSpatialGrid& grid
+              , const std::vector<finalcut::FRect>& rects
+              , const finalcut::FPoint& pos ) -> int
+{
+  // Returns the first rectangle that contains pos or -1
+
+  for (auto i : grid.getCandidates(pos))
+    if ( rects[i].contains(pos) )
+      return int(i);
+
+  return -1;
+}
+
+//----------------------------------------------------------------------
+auto firstHitLinear ( const std::vector<finalcut::FRect>& rects
+                    , const finalcut::FPoint& pos ) -> int
+{
+  for (std::size_t i{0}; i < rects.size(); i++)
+    if ( rects[i].contains(pos) )
+      return int(i);
+
+  return -1;
+}
+
+//----------------------------------------------------------------------
+// class FSpatialGridTest
+//----------------------------------------------------------------------
+
+class FSpatialGridTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FSpatialGridTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void buildTest();
+    void orderTest();
+    void invalidRectTest();
+    void largeAreaTest();
+    void randomTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FSpatialGridTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (buildTest);
+    CPPUNIT_TEST (orderTest);
+    CPPUNIT_TEST (invalidRectTest);
+    CPPUNIT_TEST (largeAreaTest);
+    CPPUNIT_TEST (randomTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::classNameTest()
+{
+  const finalcut::FSpatialGrid grid;
+  const finalcut::FString& classname = grid.getClassName();
+  CPPUNIT_ASSERT ( classname == "FSpatialGrid" );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::noArgumentTest()
+{
+  const finalcut::FSpatialGrid grid{};
+  CPPUNIT_ASSERT ( grid.isEmpty() );
+  CPPUNIT_ASSERT ( grid.getCount() == 0 );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{0, 0}).empty() );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{1, 1}).empty() );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::buildTest()
+{
+  const std::vector<finalcut::FRect> rects
+  {
+    { 1, 1, 10, 5 },
+    { 20, 3, 5, 5 },
+    { 5, 10, 30, 2 }
+  };
+
+  finalcut::FSpatialGrid grid{};
+  grid.build(rects);
+  CPPUNIT_ASSERT ( ! grid.isEmpty() );
+  CPPUNIT_ASSERT ( grid.getCount() == 3 );
+  CPPUNIT_ASSERT ( grid.getBounds() == finalcut::FRect(1, 1, 34, 11) );
+
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {1, 1}) == 0 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {10, 5}) == 0 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {11, 5}) == -1 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {22, 4}) == 1 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {34, 11}) == 2 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {15, 8}) == -1 );
+
+  // Outside the bounds
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{0, 1}).empty() );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{35, 11}).empty() );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{1, 12}).empty() );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{-5, -5}).empty() );
+
+  grid.clear();
+  CPPUNIT_ASSERT ( grid.isEmpty() );
+  CPPUNIT_ASSERT ( grid.getCount() == 0 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {1, 1}) == -1 );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::orderTest()
+{
+  // Overlapping rectangles keep their order within a cell
+  const std::vector<finalcut::FRect> rects
+  {
+    { 5, 5, 10, 10 },
+    { 1, 1, 40, 20 },
+    { 6, 6, 2, 2 }
+  };
+
+  finalcut::FSpatialGrid grid{};
+  grid.build(rects);
+  const auto candidates = grid.getCandidates(finalcut::FPoint{6, 6});
+  CPPUNIT_ASSERT ( candidates.size() == 3 );
+  std::vector<std::size_t> list(candidates.begin(), candidates.end());
+  CPPUNIT_ASSERT ( list[0] == 0 );
+  CPPUNIT_ASSERT ( list[1] == 1 );
+  CPPUNIT_ASSERT ( list[2] == 2 );
+
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {6, 6}) == 0 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {2, 2}) == 1 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {40, 20}) == 1 );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::invalidRectTest()
+{
+  const std::vector<finalcut::FRect> rects
+  {
+    { },                                                 // Empty
+    { finalcut::FPoint{5, 5}, finalcut::FPoint{4, 5} },  // Zero width
+    { 3, 3, 2, 2 }
+  };
+
+  finalcut::FSpatialGrid grid{};
+  grid.build(rects);
+  CPPUNIT_ASSERT ( grid.getCount() == 3 );
+  CPPUNIT_ASSERT ( grid.getBounds() == finalcut::FRect(3, 3, 2, 2) );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {3, 3}) == 2 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {5, 5}) == -1 );
+
+  // Only invalid rectangles
+  grid.build({ finalcut::FRect{} });
+  CPPUNIT_ASSERT ( grid.isEmpty() );
+  CPPUNIT_ASSERT ( grid.getCount() == 1 );
+  CPPUNIT_ASSERT ( grid.getCandidates(finalcut::FPoint{0, 0}).empty() );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::largeAreaTest()
+{
+  // The number of cells is limited
+  std::vector<finalcut::FRect> rects{};
+
+  for (int y{0}; y < 50; y++)
+    for (int x{0}; x < 50; x++)
+      rects.emplace_back (x * 200, y * 100, 200, 100);
+
+  finalcut::FSpatialGrid grid{};
+  grid.build(rects);
+  CPPUNIT_ASSERT ( grid.getBounds() == finalcut::FRect(0, 0, 10000, 5000) );
+
+  // A cell covers only a small part of the rectangles
+  const auto candidates = grid.getCandidates(finalcut::FPoint{5050, 2550});
+  CPPUNIT_ASSERT ( candidates.size() < 16 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {5050, 2550}) == 25 * 50 + 25 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {0, 0}) == 0 );
+  CPPUNIT_ASSERT ( firstHit(grid, rects, {9999, 4999}) == 50 * 50 - 1 );
+}
+
+//----------------------------------------------------------------------
+void FSpatialGridTest::randomTest()
+{
+  // Same results as a linear search
+  std::mt19937 gen(0xf1c);
+  std::uniform_int_distribution<int> pos_dist(-10, 150);
+  std::uniform_int_distribution<int> size_dist(1, 30);
+  std::vector<finalcut::FRect> rects{};
+
+  for (int i{0}; i < 300; i++)
+  {
+    rects.emplace_back ( pos_dist(gen), pos_dist(gen)
+                       , std::size_t(size_dist(gen))
+                       , std::size_t(size_dist(gen)) );
+  }
+
+  finalcut::FSpatialGrid grid{};
+  grid.build(rects);
+
+  for (int y{-15}; y < 185; y++)
+  {
+    for (int x{-15}; x < 185; x++)
+    {
+      const finalcut::FPoint pos{x, y};
+      CPPUNIT_ASSERT ( firstHit(grid, rects, pos)
+                       == firstHitLinear(rects, pos) );
+    }
+  }
+}
+
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FSpatialGridTest);
+
+// The general unit test main part
+#include <main-test.inc>
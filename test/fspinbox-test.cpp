@@ -0,0 +1,113 @@
+/***********************************************************************
+* fspinbox-test.cpp - FSpinBox unit tests                              *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FSpinBoxTest
+//----------------------------------------------------------------------
+
+class FSpinBoxTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FSpinBoxTest() = default;
+
+  protected:
+    void classNameTest();
+    void pasteEventTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FSpinBoxTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (pasteEventTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data member
+    finalcut::FWidget root{nullptr};
+};
+
+//----------------------------------------------------------------------
+void FSpinBoxTest::classNameTest()
+{
+  const finalcut::FSpinBox spin_box{&root};
+  const finalcut::FString& classname = spin_box.getClassName();
+  CPPUNIT_ASSERT ( classname == "FSpinBox" );
+}
+
+//----------------------------------------------------------------------
+void FSpinBoxTest::pasteEventTest()
+{
+  // The pasted text goes through the number filter of the input field
+
+  finalcut::FSpinBox spin_box{&root};
+  spin_box.setRange (-1000, 1000);
+  spin_box.setValue (0);
+  int changed{0};
+  spin_box.addCallback ("changed", [&changed] () { changed++; });
+
+  // The text is inserted in front of the "0" at the cursor position
+  finalcut::FPasteEvent ev1 (finalcut::Event::Paste, L"4a2\n");
+  spin_box.onPaste(&ev1);
+  CPPUNIT_ASSERT ( ev1.isAccepted() );
+  CPPUNIT_ASSERT ( spin_box.getValue() == 420 );
+  CPPUNIT_ASSERT ( changed == 1 );
+
+  // The value is limited to the range
+  spin_box.setValue (0);
+  finalcut::FPasteEvent ev2 (finalcut::Event::Paste, L"123456");
+  spin_box.onPaste(&ev2);
+  CPPUNIT_ASSERT ( spin_box.getValue() == 1000 );
+
+  // Text without digits
+  spin_box.setValue (0);
+  changed = 0;
+  finalcut::FPasteEvent ev3 (finalcut::Event::Paste, L"abc");
+  spin_box.onPaste(&ev3);
+  CPPUNIT_ASSERT ( spin_box.getValue() == 0 );
+  CPPUNIT_ASSERT ( changed == 0 );
+
+  // A disabled spin box ignores the event
+  spin_box.setDisable();
+  finalcut::FPasteEvent ev4 (finalcut::Event::Paste, L"7");
+  spin_box.onPaste(&ev4);
+  CPPUNIT_ASSERT ( ! ev4.isAccepted() );
+  CPPUNIT_ASSERT ( spin_box.getValue() == 0 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FSpinBoxTest);
+
+// The general unit test main part
+#include <main-test.inc>
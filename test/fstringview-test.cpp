@@ -0,0 +1,337 @@
+/***********************************************************************
+* fstringview-test.cpp - FStringView unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FStringViewTest
+//----------------------------------------------------------------------
+
+class FStringViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FStringViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void constructorTest();
+    void compareTest();
+    void subscriptOperatorTest();
+    void subStringTest();
+    void trimTest();
+    void findTest();
+    void prefixSuffixTest();
+    void caseCompareTest();
+    void tokenizerTest();
+    void fstringTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FStringViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (constructorTest);
+    CPPUNIT_TEST (compareTest);
+    CPPUNIT_TEST (subscriptOperatorTest);
+    CPPUNIT_TEST (subStringTest);
+    CPPUNIT_TEST (trimTest);
+    CPPUNIT_TEST (findTest);
+    CPPUNIT_TEST (prefixSuffixTest);
+    CPPUNIT_TEST (caseCompareTest);
+    CPPUNIT_TEST (tokenizerTest);
+    CPPUNIT_TEST (fstringTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+
+//----------------------------------------------------------------------
+void FStringViewTest::classNameTest()
+{
+  const finalcut::FStringView view;
+  const finalcut::FString& classname = view.getClassName();
+  CPPUNIT_ASSERT ( classname == "FStringView" );
+
+  const finalcut::FStringTokenizer tokenizer{L"a b", L" "};
+  CPPUNIT_ASSERT ( tokenizer.getClassName() == "FStringTokenizer" );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::noArgumentTest()
+{
+  const finalcut::FStringView view{};
+  CPPUNIT_ASSERT ( view.isEmpty() );
+  CPPUNIT_ASSERT ( view.getLength() == 0 );
+  CPPUNIT_ASSERT ( view.data() != nullptr );
+  CPPUNIT_ASSERT ( view.begin() == view.end() );
+  CPPUNIT_ASSERT ( view.toFString().isEmpty() );
+  CPPUNIT_ASSERT ( view == L"" );
+
+  const wchar_t* null_ptr{nullptr};
+  const finalcut::FStringView null_view{null_ptr};
+  CPPUNIT_ASSERT ( null_view.isEmpty() );
+  CPPUNIT_ASSERT ( null_view == view );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::constructorTest()
+{
+  const finalcut::FString fstr{L"FINAL CUT"};
+  const finalcut::FStringView v1{fstr};
+  CPPUNIT_ASSERT ( v1.getLength() == 9 );
+  CPPUNIT_ASSERT ( v1.data() == fstr.wc_str() );  // No copy
+
+  const std::wstring wstr{L"widget toolkit"};
+  const finalcut::FStringView v2{wstr};
+  CPPUNIT_ASSERT ( v2.getLength() == 14 );
+  CPPUNIT_ASSERT ( v2.data() == wstr.data() );  // No copy
+
+  const finalcut::FStringView v3{L"text"};
+  CPPUNIT_ASSERT ( v3.getLength() == 4 );
+  CPPUNIT_ASSERT ( v3.toWString() == L"text" );
+
+  const finalcut::FStringView v4{L"text user interface", 4};
+  CPPUNIT_ASSERT ( v4.getLength() == 4 );
+  CPPUNIT_ASSERT ( v4 == v3 );
+
+  // Copies share the same characters
+  const finalcut::FStringView v5{v1};
+  CPPUNIT_ASSERT ( v5.data() == v1.data() );
+
+  // Explicit conversion back to an owning string
+  const finalcut::FString fstr2{v4};
+  CPPUNIT_ASSERT ( fstr2 == L"text" );
+  CPPUNIT_ASSERT ( fstr2.wc_str() != v4.data() );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::compareTest()
+{
+  const finalcut::FString s1{L"apple"};
+  const finalcut::FStringView v1{s1};
+  CPPUNIT_ASSERT ( v1 == L"apple" );
+  CPPUNIT_ASSERT ( v1 != L"Apple" );
+  CPPUNIT_ASSERT ( v1 != L"app" );
+  CPPUNIT_ASSERT ( v1 != L"apples" );
+  CPPUNIT_ASSERT ( v1 < L"apples" );
+  CPPUNIT_ASSERT ( v1 < L"banana" );
+  CPPUNIT_ASSERT ( v1 > L"app" );
+  CPPUNIT_ASSERT ( v1 > L"Apple" );
+  CPPUNIT_ASSERT ( v1.compare(L"apple") == 0 );
+  CPPUNIT_ASSERT ( v1.compare(L"apricot") < 0 );
+  CPPUNIT_ASSERT ( v1.compare(L"") > 0 );
+  CPPUNIT_ASSERT ( finalcut::FStringView{}.compare(L"") == 0 );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::subscriptOperatorTest()
+{
+  const finalcut::FStringView view{L"abc"};
+  CPPUNIT_ASSERT ( view[0] == L'a' );
+  CPPUNIT_ASSERT ( view[1] == L'b' );
+  CPPUNIT_ASSERT ( view[2] == L'c' );
+  CPPUNIT_ASSERT ( view.front() == L'a' );
+  CPPUNIT_ASSERT ( view.back() == L'c' );
+  CPPUNIT_ASSERT_THROW ( view[3], std::out_of_range );
+  CPPUNIT_ASSERT_THROW ( view[-1], std::out_of_range );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::subStringTest()
+{
+  // Same results as FString::left(), right() and mid()
+  const finalcut::FString string{L"Look behind you, a three-headed monkey!"};
+  const finalcut::FStringView view{string};
+
+  for (std::size_t n{0}; n <= string.getLength() + 1; n++)
+  {
+    CPPUNIT_ASSERT ( view.left(n) == string.left(n) );
+    CPPUNIT_ASSERT ( view.right(n) == string.right(n) );
+  }
+
+  for (std::size_t pos{0}; pos <= string.getLength() + 1; pos++)
+  {
+    for (std::size_t len{0}; len <= string.getLength() + 1; len++)
+      CPPUNIT_ASSERT ( view.mid(pos, len) == string.mid(pos, len) );
+  }
+
+  // Substrings are windows into the original characters
+  CPPUNIT_ASSERT ( view.mid(6, 6) == L"behind" );
+  CPPUNIT_ASSERT ( view.mid(6, 6).data() == string.wc_str() + 5 );
+  CPPUNIT_ASSERT ( view.right(7).data() == string.wc_str() + 32 );
+  CPPUNIT_ASSERT ( finalcut::FStringView{}.left(3).isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FStringView{}.mid(1, 3).isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::trimTest()
+{
+  const finalcut::FStringView view{L"  \t Whitespace \n "};
+  CPPUNIT_ASSERT ( view.ltrim() == L"Whitespace \n " );
+  CPPUNIT_ASSERT ( view.rtrim() == L"  \t Whitespace" );
+  CPPUNIT_ASSERT ( view.trim() == L"Whitespace" );
+  CPPUNIT_ASSERT ( finalcut::FStringView{L"   "}.trim().isEmpty() );
+  CPPUNIT_ASSERT ( finalcut::FStringView{}.trim().isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::findTest()
+{
+  constexpr auto npos = finalcut::FStringView::npos;
+  const finalcut::FStringView view{L"one;two;three"};
+  CPPUNIT_ASSERT ( view.find(L';') == 3 );
+  CPPUNIT_ASSERT ( view.find(L';', 4) == 7 );
+  CPPUNIT_ASSERT ( view.find(L';', 8) == npos );
+  CPPUNIT_ASSERT ( view.find(L'x') == npos );
+  CPPUNIT_ASSERT ( view.find(L"two") == 4 );
+  CPPUNIT_ASSERT ( view.find(L"two", 5) == npos );
+  CPPUNIT_ASSERT ( view.find(L"three") == 8 );
+  CPPUNIT_ASSERT ( view.find(L"threes") == npos );
+  CPPUNIT_ASSERT ( view.find(L"", 2) == 2 );
+  CPPUNIT_ASSERT ( view.find(L"e", 100) == npos );
+  CPPUNIT_ASSERT ( view.includes(L"o;t") );
+  CPPUNIT_ASSERT ( ! view.includes(L"four") );
+  CPPUNIT_ASSERT ( ! view.includes(L"") );  // Same as FString::includes()
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::prefixSuffixTest()
+{
+  const finalcut::FString string{L"/usr/local/lib"};
+  CPPUNIT_ASSERT ( string.startsWith(L"/usr") );
+  CPPUNIT_ASSERT ( string.startsWith(L"") );
+  CPPUNIT_ASSERT ( string.startsWith(string) );
+  CPPUNIT_ASSERT ( ! string.startsWith(L"/USR") );
+  CPPUNIT_ASSERT ( ! string.startsWith(L"/usr/local/lib/") );
+  CPPUNIT_ASSERT ( string.endsWith(L"/lib") );
+  CPPUNIT_ASSERT ( string.endsWith(L"") );
+  CPPUNIT_ASSERT ( ! string.endsWith(L"/LIB") );
+  CPPUNIT_ASSERT ( ! string.endsWith(L"//usr/local/lib") );
+
+  const finalcut::FStringView view{string};
+  CPPUNIT_ASSERT ( view.startsWith(L"/usr/local") );
+  CPPUNIT_ASSERT ( view.endsWith(L"local/lib") );
+  CPPUNIT_ASSERT ( ! finalcut::FStringView{}.startsWith(L"/") );
+  CPPUNIT_ASSERT ( ! finalcut::FStringView{}.endsWith(L"/") );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::caseCompareTest()
+{
+  const finalcut::FStringView v1{L"Appel"};
+  const finalcut::FStringView v2{L"apartment"};
+  const finalcut::FStringView v3{L"ball"};
+
+  CPPUNIT_ASSERT ( v1.caseCompare(v1) == 0 );
+  CPPUNIT_ASSERT ( v1.caseCompare(L"aPPEL") == 0 );
+  CPPUNIT_ASSERT ( v1.caseCompare(v2) > 0 );
+  CPPUNIT_ASSERT ( v2.caseCompare(v1) < 0 );
+  CPPUNIT_ASSERT ( v1.caseCompare(v3) < 0 );
+  CPPUNIT_ASSERT ( v1.left(3).caseCompare(v1) < 0 );
+  CPPUNIT_ASSERT ( v1.caseCompare(v1.left(3)) > 0 );
+  CPPUNIT_ASSERT ( finalcut::FStringView{}.caseCompare(L"") == 0 );
+
+  CPPUNIT_ASSERT ( v1.caseStartsWith(L"aPp") );
+  CPPUNIT_ASSERT ( v1.caseStartsWith(L"APPEL") );
+  CPPUNIT_ASSERT ( v1.caseStartsWith(L"") );
+  CPPUNIT_ASSERT ( ! v1.caseStartsWith(L"Appels") );
+  CPPUNIT_ASSERT ( ! v1.caseStartsWith(L"Apf") );
+  CPPUNIT_ASSERT ( ! finalcut::FStringView{}.caseStartsWith(L"a") );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::tokenizerTest()
+{
+  // The tokenizer must produce the same tokens as FString::split()
+  const std::vector<finalcut::FString> samples
+  {
+    L"", L";", L"a", L"a;", L";a", L"a;b;c", L";;", L"1;4000;13",
+    L"first;;third;"
+  };
+
+  for (const auto& sample : samples)
+  {
+    const auto& list = sample.split(L";");
+    std::size_t n{0};
+
+    for (const auto& token : sample.tokenize(L";"))
+    {
+      CPPUNIT_ASSERT ( n < list.size() );
+      CPPUNIT_ASSERT ( token == list[n] );
+      n++;
+    }
+
+    CPPUNIT_ASSERT ( n == list.size() );
+  }
+
+  // Multi-character delimiter
+  const finalcut::FStringTokenizer tokenizer{L"one, two, three", L", "};
+  auto iter = tokenizer.begin();
+  CPPUNIT_ASSERT ( *iter == L"one" );
+  CPPUNIT_ASSERT ( (iter++)->getLength() == 3 );
+  CPPUNIT_ASSERT ( *iter == L"two" );
+  ++iter;
+  CPPUNIT_ASSERT ( *iter == L"three" );
+  CPPUNIT_ASSERT ( iter != tokenizer.end() );
+  ++iter;
+  CPPUNIT_ASSERT ( iter == tokenizer.end() );
+
+  // An empty delimiter returns the whole string as a single token
+  const finalcut::FStringTokenizer whole{L"abc", L""};
+  auto iter2 = whole.begin();
+  CPPUNIT_ASSERT ( *iter2 == L"abc" );
+  CPPUNIT_ASSERT ( ++iter2 == whole.end() );
+}
+
+//----------------------------------------------------------------------
+void FStringViewTest::fstringTest()
+{
+  // FString functions that accept views
+  const finalcut::FString s1{L"Data"};
+  const finalcut::FString s2{L"data"};
+  CPPUNIT_ASSERT ( finalcut::FStringCaseCompare(s1, s2) == 0 );
+  CPPUNIT_ASSERT ( finalcut::FStringCaseCompare(s1, L"Date") < 0 );
+  CPPUNIT_ASSERT ( finalcut::FStringView{s1}.left(2).caseCompare(s2) < 0 );
+  CPPUNIT_ASSERT ( finalcut::FString{finalcut::FStringView{s1}.mid(2, 2)} == L"at" );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FStringViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,245 @@
+/***********************************************************************
+* ftaskexecutor-test.cpp - FTaskExecutor unit tests                    *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FTaskExecutorTest
+//----------------------------------------------------------------------
+
+class FTaskExecutorTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTaskExecutorTest() = default;
+
+  protected:
+    void classNameTest();
+    void threadCountTest();
+    void submitTest();
+    void nestedTaskTest();
+    void stealTest();
+    void pendingCountTest();
+    void destructorTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTaskExecutorTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (threadCountTest);
+    CPPUNIT_TEST (submitTest);
+    CPPUNIT_TEST (nestedTaskTest);
+    CPPUNIT_TEST (stealTest);
+    CPPUNIT_TEST (pendingCountTest);
+    CPPUNIT_TEST (destructorTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::classNameTest()
+{
+  const finalcut::FTaskExecutor executor{1};
+  const finalcut::FString& classname = executor.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTaskExecutor" );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::threadCountTest()
+{
+  const finalcut::FTaskExecutor executor1{3};
+  CPPUNIT_ASSERT ( executor1.getThreadCount() == 3 );
+  CPPUNIT_ASSERT ( executor1.getPendingCount() == 0 );
+
+  // One thread per CPU core
+  const finalcut::FTaskExecutor executor2{};
+  CPPUNIT_ASSERT ( executor2.getThreadCount()
+                   == std::max(std::thread::hardware_concurrency(), 1U) );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::submitTest()
+{
+  finalcut::FTaskExecutor executor{4};
+  std::atomic<int> sum{0};
+  std::mutex mutex{};
+  std::set<std::thread::id> thread_ids{};
+
+  for (int i{1}; i <= 1000; i++)
+  {
+    executor.submit ( [&sum, &mutex, &thread_ids, i] ()
+                      {
+                        sum += i;
+                        std::lock_guard<std::mutex> lock_guard(mutex);
+                        thread_ids.insert(std::this_thread::get_id());
+                      } );
+  }
+
+  executor.waitUntilIdle();
+  CPPUNIT_ASSERT ( sum == 500500 );
+  CPPUNIT_ASSERT ( executor.getPendingCount() == 0 );
+  CPPUNIT_ASSERT ( thread_ids.count(std::this_thread::get_id()) == 0 );
+  CPPUNIT_ASSERT ( thread_ids.size() <= 4 );
+
+  // An empty task is ignored
+  executor.submit (nullptr);
+  CPPUNIT_ASSERT ( executor.getPendingCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::nestedTaskTest()
+{
+  // Tasks can submit further tasks
+
+  finalcut::FTaskExecutor executor{2};
+  std::atomic<int> count{0};
+
+  for (int i{0}; i < 10; i++)
+  {
+    executor.submit ( [&executor, &count] ()
+                      {
+                        for (int n{0}; n < 10; n++)
+                          executor.submit ([&count] () { count++; });
+
+                        count++;
+                      } );
+  }
+
+  executor.waitUntilIdle();
+  CPPUNIT_ASSERT ( count == 110 );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::stealTest()
+{
+  // A blocked worker's queued tasks are taken over by the other worker
+
+  finalcut::FTaskExecutor executor{2};
+  std::atomic<bool> release{false};
+  std::atomic<int> count{0};
+
+  executor.submit ( [&executor, &release, &count] ()
+                    {
+                      // These tasks go into the queue of this worker
+                      for (int n{0}; n < 20; n++)
+                        executor.submit ([&count] () { count++; });
+
+                      while ( ! release )
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    } );
+
+  const auto start = std::chrono::steady_clock::now();
+
+  while ( count < 20
+       && std::chrono::steady_clock::now() - start < std::chrono::seconds(5) )
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  CPPUNIT_ASSERT ( count == 20 );
+  release = true;
+  executor.waitUntilIdle();
+  CPPUNIT_ASSERT ( executor.getPendingCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::pendingCountTest()
+{
+  // A running task is always included in the pending count,
+  // even if another worker takes it directly after the submit
+
+  finalcut::FTaskExecutor executor{4};
+  std::atomic<int> count{0};
+  std::atomic<int> uncounted{0};
+
+  const auto check = [&executor, &count, &uncounted] ()
+  {
+    if ( executor.getPendingCount() == 0 )
+      uncounted++;
+
+    count++;
+  };
+
+  for (int i{0}; i < 200; i++)
+  {
+    executor.submit ( [&executor, &check] ()
+                      {
+                        for (int n{0}; n < 50; n++)
+                          executor.submit (check);
+
+                        check();
+                      } );
+  }
+
+  executor.waitUntilIdle();
+  CPPUNIT_ASSERT ( count == 10200 );
+  CPPUNIT_ASSERT ( uncounted == 0 );
+  CPPUNIT_ASSERT ( executor.getPendingCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTaskExecutorTest::destructorTest()
+{
+  // The destructor waits for running tasks and discards waiting tasks
+
+  std::atomic<bool> started{false};
+  std::atomic<int> count{0};
+
+  {
+    finalcut::FTaskExecutor executor{1};
+
+    executor.submit ( [&started, &count] ()
+                      {
+                        started = true;
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                        count++;
+                      } );
+
+    while ( ! started )
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    for (int i{0}; i < 100; i++)
+      executor.submit ([&count] () { count++; });
+  }
+
+  CPPUNIT_ASSERT ( count == 1 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTaskExecutorTest);
+
+// The general unit test main part
+#include <main-test.inc>
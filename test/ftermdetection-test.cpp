@@ -250,6 +250,7 @@ void FTermDetectionTest::xtermTest()
     CPPUNIT_ASSERT ( detect.canDisplay256Colors() );
     CPPUNIT_ASSERT ( detect.hasTerminalDetection() );
     CPPUNIT_ASSERT ( detect.hasSetCursorStyleSupport() );
+    CPPUNIT_ASSERT ( ! detect.hasKittyKeyboardSupport() );
     CPPUNIT_ASSERT ( detect.getTermType() == "xterm-256color" );
     CPPUNIT_ASSERT ( detect.getTermType_256color() == "xterm-256color" );
     CPPUNIT_ASSERT ( detect.getTermType_Answerback() == "xterm-256color" );
@@ -1961,6 +1962,7 @@ void FTermDetectionTest::kittyTest()
     CPPUNIT_ASSERT ( detect.canDisplay256Colors() );
     CPPUNIT_ASSERT ( detect.hasTerminalDetection() );
     CPPUNIT_ASSERT ( ! detect.hasSetCursorStyleSupport() );
+    CPPUNIT_ASSERT ( detect.hasKittyKeyboardSupport() );
     CPPUNIT_ASSERT ( detect.getTermType() == "xterm-kitty" );
     CPPUNIT_ASSERT ( detect.getTermType_256color() == "xterm-256color" );
     CPPUNIT_ASSERT ( detect.getTermType_Answerback() == "xterm-256color" );
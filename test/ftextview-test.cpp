@@ -0,0 +1,462 @@
+/***********************************************************************
+* ftextview-test.cpp - FTextView unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <unistd.h>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <chrono>
+#include <clocale>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------
+auto createTempFile (const std::string& content) -> std::string
+{
+  char name[] = "/tmp/ftextview-test-XXXXXX";
+  const int fd = mkstemp(name);
+
+  if ( fd < 0 )
+    return {};
+
+  close(fd);
+  std::ofstream file(name, std::ios::binary);
+  file << content;
+  return name;
+}
+
+//----------------------------------------------------------------------
+void waitForIndex (const finalcut::FTextView& text_view)
+{
+  while ( ! text_view.isFileIndexed() )
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+
+//----------------------------------------------------------------------
+// class FTextViewTest
+//----------------------------------------------------------------------
+
+class FTextViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTextViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void mapFileTest();
+    void decodeTest();
+    void largeFileTest();
+    void readOnlyTest();
+    void highlightTest();
+    void lineLimitTest();
+    void tailScrollTest();
+    void tailStreamTest();
+    void pasteEventTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTextViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (mapFileTest);
+    CPPUNIT_TEST (decodeTest);
+    CPPUNIT_TEST (largeFileTest);
+    CPPUNIT_TEST (readOnlyTest);
+    CPPUNIT_TEST (highlightTest);
+    CPPUNIT_TEST (lineLimitTest);
+    CPPUNIT_TEST (tailScrollTest);
+    CPPUNIT_TEST (tailStreamTest);
+    CPPUNIT_TEST (pasteEventTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Data member
+    finalcut::FWidget root{nullptr};
+};
+
+//----------------------------------------------------------------------
+void FTextViewTest::classNameTest()
+{
+  const finalcut::FTextView text_view{&root};
+  const finalcut::FString& classname = text_view.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTextView" );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::mapFileTest()
+{
+  const std::string content = "first line\n"
+                              "\tindented\n"
+                              "\n"
+                              "trailing space   \n"
+                              "control\x01" "char\n"
+                              "last line without newline";
+  const auto filename = createTempFile(content);
+  CPPUNIT_ASSERT ( ! filename.empty() );
+
+  // Mapped lines are processed like appended lines
+  finalcut::FTextView text_view{&root};
+
+  for (const auto& line : finalcut::FString(content).split("\n"))
+    text_view.append(line);
+
+  finalcut::FTextView mapped_view{&root};
+  CPPUNIT_ASSERT ( ! mapped_view.isFileMapped() );
+  CPPUNIT_ASSERT ( mapped_view.mapFile(filename) );
+  CPPUNIT_ASSERT ( mapped_view.isFileMapped() );
+  waitForIndex (mapped_view);
+  CPPUNIT_ASSERT ( mapped_view.isFileIndexed() );
+  CPPUNIT_ASSERT ( mapped_view.getLines().empty() );
+  CPPUNIT_ASSERT ( mapped_view.getRows() == 6 );
+  CPPUNIT_ASSERT ( mapped_view.getRows() == text_view.getRows() );
+
+  for (std::size_t n{0}; n < text_view.getRows(); n++)
+    CPPUNIT_ASSERT ( mapped_view.getLine(n).text == text_view.getLine(n).text );
+
+  CPPUNIT_ASSERT ( mapped_view.getLine(1).text == "        indented" );
+  CPPUNIT_ASSERT_THROW ( mapped_view.getLine(6), std::out_of_range );
+
+  // Files ending with a newline have no additional empty line
+  const auto filename2 = createTempFile("one\ntwo\n");
+  CPPUNIT_ASSERT ( mapped_view.mapFile(filename2) );
+  waitForIndex (mapped_view);
+  CPPUNIT_ASSERT ( mapped_view.getRows() == 2 );
+  CPPUNIT_ASSERT ( mapped_view.getLine(1).text == "two" );
+
+  // Empty file
+  const auto filename3 = createTempFile("");
+  CPPUNIT_ASSERT ( mapped_view.mapFile(filename3) );
+  waitForIndex (mapped_view);
+  CPPUNIT_ASSERT ( mapped_view.getRows() == 0 );
+  CPPUNIT_ASSERT ( mapped_view.getText().isEmpty() );
+
+  // A file that cannot be opened keeps the current content
+  CPPUNIT_ASSERT ( ! mapped_view.mapFile(filename + ".does-not-exist") );
+  CPPUNIT_ASSERT ( mapped_view.isFileMapped() );
+  CPPUNIT_ASSERT ( ! mapped_view.mapFile("/tmp") );
+
+  mapped_view.unmapFile();
+  CPPUNIT_ASSERT ( ! mapped_view.isFileMapped() );
+  CPPUNIT_ASSERT ( ! mapped_view.isFileIndexed() );
+  CPPUNIT_ASSERT ( mapped_view.getRows() == 0 );
+
+  std::remove(filename.c_str());
+  std::remove(filename2.c_str());
+  std::remove(filename3.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::decodeTest()
+{
+  const auto locale = std::setlocale(LC_CTYPE, nullptr);
+  const std::string saved_locale{locale ? locale : "C"};
+
+  if ( ! std::setlocale(LC_CTYPE, "C.UTF-8") )
+    return;
+
+  const std::string content = "caf\xc3\xa9\r\n"         // UTF-8 + CR LF
+                              "bad \xff byte\n"          // Invalid byte
+                              "\xe2\x82\xac 5";          // Euro sign
+  const auto filename = createTempFile(content);
+  finalcut::FTextView text_view{&root};
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  waitForIndex (text_view);
+  CPPUNIT_ASSERT ( text_view.getRows() == 3 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == L"café" );
+  CPPUNIT_ASSERT ( text_view.getLine(1).text == L"bad � byte" );
+  CPPUNIT_ASSERT ( text_view.getLine(2).text == L"€ 5" );
+
+  text_view.unmapFile();
+  std::remove(filename.c_str());
+  std::setlocale(LC_CTYPE, saved_locale.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::largeFileTest()
+{
+  // The line index has a checkpoint every 64 lines
+  constexpr std::size_t lines{500000};
+  std::string content{};
+
+  for (std::size_t n{0}; n < lines; n++)
+    content += "line " + std::to_string(n) + std::string(n % 7, '.') + '\n';
+
+  const auto filename = createTempFile(content);
+  finalcut::FTextView text_view{&root};
+  const auto start = std::chrono::steady_clock::now();
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  const auto map_duration = std::chrono::steady_clock::now() - start;
+  waitForIndex (text_view);
+  const auto index_duration = std::chrono::steady_clock::now() - start;
+  CPPUNIT_ASSERT ( text_view.getRows() == lines );
+
+  for (std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(63)
+                       , std::size_t(64), std::size_t(65), std::size_t(127)
+                       , std::size_t(128), std::size_t(4711)
+                       , lines - 65, lines - 64, lines - 1 })
+  {
+    const auto expected = "line " + std::to_string(n) + std::string(n % 7, '.');
+    CPPUNIT_ASSERT ( text_view.getLine(n).text == expected );
+  }
+
+  // The mapping does not depend on the file size
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+  std::cout << "\n  map: " << duration_cast<milliseconds>(map_duration).count()
+            << " ms, index of " << lines << " lines: "
+            << duration_cast<milliseconds>(index_duration).count() << " ms ";
+
+  // Unmapping deletes only the index timer
+  const auto timer_id = text_view.addTimer(60000);
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  text_view.clear();
+  CPPUNIT_ASSERT ( ! text_view.isFileMapped() );
+  CPPUNIT_ASSERT ( text_view.delTimer(timer_id) );
+  std::remove(filename.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::readOnlyTest()
+{
+  const auto filename = createTempFile("a\nb\nc\n");
+  finalcut::FTextView text_view{&root};
+  text_view.append ("in memory");
+  CPPUNIT_ASSERT ( text_view.getRows() == 1 );
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  waitForIndex (text_view);
+  CPPUNIT_ASSERT ( text_view.getLines().empty() );
+  CPPUNIT_ASSERT ( text_view.getRows() == 3 );
+
+  // The mapped text cannot be changed
+  text_view.append ("d");
+  text_view.insert ("x", 0);
+  text_view.deleteLine (1);
+  CPPUNIT_ASSERT ( text_view.getRows() == 3 );
+  CPPUNIT_ASSERT ( text_view.getText() == "a\nb\nc\n" );
+
+  // setText() replaces the mapped file
+  text_view.setText ("new");
+  CPPUNIT_ASSERT ( ! text_view.isFileMapped() );
+  CPPUNIT_ASSERT ( text_view.getRows() == 1 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "new" );
+  std::remove(filename.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::highlightTest()
+{
+  const auto filename = createTempFile("red\ngreen\nblue\n");
+  finalcut::FTextView text_view{&root};
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  waitForIndex (text_view);
+
+  // Highlights are kept for lines that are not decoded yet
+  text_view.addHighlight (2, {0, finalcut::FColor::Blue});
+  text_view.addHighlight (3, {0, finalcut::FColor::Red});  // Out of range
+  CPPUNIT_ASSERT ( text_view.getLine(0).highlight.empty() );
+  CPPUNIT_ASSERT ( text_view.getLine(2).highlight.size() == 1 );
+  CPPUNIT_ASSERT ( text_view.getLine(2).highlight[0].attributes.fg_color
+                   == finalcut::FColor::Blue );
+
+  // Highlights of decoded lines
+  text_view.addHighlight (0, {0, 1, finalcut::FColor::Red});
+  CPPUNIT_ASSERT ( text_view.getLine(0).highlight.size() == 1 );
+  text_view.resetHighlight (2);
+  CPPUNIT_ASSERT ( text_view.getLine(2).highlight.empty() );
+
+  text_view.unmapFile();
+  std::remove(filename.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::lineLimitTest()
+{
+  finalcut::FTextView text_view{&root};
+  CPPUNIT_ASSERT ( ! text_view.hasLineLimit() );
+  CPPUNIT_ASSERT ( text_view.getLineLimit() == 0 );
+
+  for (int n{0}; n < 10; n++)
+    text_view.append ("line " + std::to_string(n));
+
+  // Reducing the limit removes the oldest lines
+  text_view.setLineLimit (4);
+  CPPUNIT_ASSERT ( text_view.hasLineLimit() );
+  CPPUNIT_ASSERT ( text_view.getLineLimit() == 4 );
+  CPPUNIT_ASSERT ( text_view.getRows() == 4 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 6" );
+
+  // New lines replace the oldest lines
+  text_view.append ("line 10");
+  text_view << "line 11\nline 12";
+  CPPUNIT_ASSERT ( text_view.getRows() == 4 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 9" );
+  CPPUNIT_ASSERT ( text_view.getLine(3).text == "line 12" );
+  CPPUNIT_ASSERT_THROW ( text_view.getLine(4), std::out_of_range );
+  CPPUNIT_ASSERT ( text_view.getText() == "line 9\nline 10\nline 11\nline 12" );
+
+  text_view.append ("line 13");
+  const auto& lines = text_view.getLines();
+  CPPUNIT_ASSERT ( lines.size() == 4 );
+  CPPUNIT_ASSERT ( lines[0].text == "line 10" );
+  CPPUNIT_ASSERT ( lines[3].text == "line 13" );
+
+  // Highlights move with their line
+  text_view.addHighlight (1, {0, finalcut::FColor::Red});
+  text_view.append ("line 14");
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 11" );
+  CPPUNIT_ASSERT ( text_view.getLine(0).highlight.size() == 1 );
+  CPPUNIT_ASSERT ( text_view.getLine(1).highlight.empty() );
+
+  // Insert before the last line
+  text_view.insert ("inserted", 2);
+  CPPUNIT_ASSERT ( text_view.getRows() == 4 );
+  CPPUNIT_ASSERT ( text_view.getText() == "line 12\ninserted\nline 13\nline 14" );
+  text_view.insert ("first", 0);  // Oldest line, removed immediately
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 12" );
+
+  text_view.deleteRange (1, 2);
+  CPPUNIT_ASSERT ( text_view.getRows() == 2 );
+  text_view.append ({"a", "b", "c"});
+  CPPUNIT_ASSERT ( text_view.getText() == "line 14\na\nb\nc" );
+
+  // Unlimited again
+  text_view.setLineLimit (0);
+  CPPUNIT_ASSERT ( ! text_view.hasLineLimit() );
+
+  for (int n{0}; n < 10; n++)
+    text_view.append ("x");
+
+  CPPUNIT_ASSERT ( text_view.getRows() == 14 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 14" );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::tailScrollTest()
+{
+  finalcut::FTextView text_view{&root};
+  text_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{20, 10});
+  text_view.setLineLimit (100);
+  const auto text_height = int(text_view.getTextVisibleSize().getHeight());
+
+  // The view follows new lines while it is at the bottom
+  for (int n{0}; n < 50; n++)
+    text_view.append ("line " + std::to_string(n));
+
+  CPPUNIT_ASSERT ( text_view.getScrollPos().getY() == 50 - text_height );
+
+  for (int n{50}; n < 250; n++)
+    text_view.append ("line " + std::to_string(n));
+
+  CPPUNIT_ASSERT ( text_view.getRows() == 100 );
+  CPPUNIT_ASSERT ( text_view.getScrollPos().getY() == 100 - text_height );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == "line 150" );
+
+  // The maximum line width is updated when the widest line is dropped
+  text_view.append (finalcut::FString(60, L'#'));
+  CPPUNIT_ASSERT ( text_view.getColumns() == 60 );
+
+  for (int n{0}; n < 99; n++)
+    text_view.append ("short");
+
+  CPPUNIT_ASSERT ( text_view.getColumns() == 60 );
+  text_view.append ("short");
+  CPPUNIT_ASSERT ( text_view.getColumns() == 5 );
+  CPPUNIT_ASSERT ( text_view.getScrollPos().getX() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::tailStreamTest()
+{
+  // A log stream with a bounded line count. Each new line replaces
+  // the oldest one instead of erasing the front of the line vector.
+
+  constexpr int lines{1000000};
+  constexpr std::size_t limit{10000};
+  finalcut::FTextView text_view{&root};
+  text_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{80, 25});
+  text_view.setLineLimit (limit);
+  const auto start = std::chrono::steady_clock::now();
+
+  for (int n{0}; n < lines; n++)
+    text_view.append ("event " + std::to_string(n) + std::string(n % 13, '*'));
+
+  const auto duration = std::chrono::steady_clock::now() - start;
+  CPPUNIT_ASSERT ( text_view.getRows() == limit );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text.startsWith(L"event 990000") );
+  CPPUNIT_ASSERT ( text_view.getLine(limit - 1).text.startsWith(L"event 999999") );
+  CPPUNIT_ASSERT ( text_view.getColumns() == std::string("event 999999").length() + 12 );
+
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+  std::cout << "\n  append of " << lines << " lines (limit " << limit << "): "
+            << ms.count() << " ms ";
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::pasteEventTest()
+{
+  // A paste event appends the whole text in one step
+
+  finalcut::FTextView text_view{&root};
+  text_view.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{20, 5});
+  text_view.append ("first");
+
+  finalcut::FPasteEvent ev1 (finalcut::Event::Paste, L"a\nb\nc\nd\ne\nf");
+  text_view.onPaste(&ev1);
+  CPPUNIT_ASSERT ( ev1.isAccepted() );
+  CPPUNIT_ASSERT ( text_view.getRows() == 7 );
+  CPPUNIT_ASSERT ( text_view.getLine(0).text == L"first" );
+  CPPUNIT_ASSERT ( text_view.getLine(1).text == L"a" );
+  CPPUNIT_ASSERT ( text_view.getLine(6).text == L"f" );
+
+  // A mapped file ignores the event
+  const auto filename = createTempFile("x\ny\n");
+  CPPUNIT_ASSERT ( text_view.mapFile(filename) );
+  waitForIndex (text_view);
+  finalcut::FPasteEvent ev2 (finalcut::Event::Paste, L"z");
+  text_view.onPaste(&ev2);
+  CPPUNIT_ASSERT ( ! ev2.isAccepted() );
+  CPPUNIT_ASSERT ( text_view.getRows() == 2 );
+  CPPUNIT_ASSERT ( text_view.getText() == "x\ny\n" );
+  text_view.unmapFile();
+  std::remove(filename.c_str());
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTextViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
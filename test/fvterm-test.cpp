@@ -781,10 +781,14 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     void OwnFunctionsTest();
     void FVTermBasesTest();
     void FVTermPrintTest();
+    void FVTermPrintAsciiRunTest();
     void FVTermChildAreaPrintTest();
     void FVTermScrollTest();
     void FVTermOverlappingWindowsTest();
+    void FVTermParallelCompositingTest();
+    void FVTermTransparencyRunsTest();
     void FVTermReduceUpdatesTest();
+    void FVTermAreaPoolTest();
     void getFVTermAreaTest();
 
   private:
@@ -797,10 +801,14 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (OwnFunctionsTest);
     CPPUNIT_TEST (FVTermBasesTest);
     CPPUNIT_TEST (FVTermPrintTest);
+    CPPUNIT_TEST (FVTermPrintAsciiRunTest);
     CPPUNIT_TEST (FVTermChildAreaPrintTest);
     CPPUNIT_TEST (FVTermScrollTest);
     CPPUNIT_TEST (FVTermOverlappingWindowsTest);
+    CPPUNIT_TEST (FVTermParallelCompositingTest);
+    CPPUNIT_TEST (FVTermTransparencyRunsTest);
     CPPUNIT_TEST (FVTermReduceUpdatesTest);
+    CPPUNIT_TEST (FVTermAreaPoolTest);
     CPPUNIT_TEST (getFVTermAreaTest);
 
     // End of test suite definition
@@ -1417,6 +1425,32 @@ void FVTermTest::FVTermBasesTest()
   CPPUNIT_ASSERT ( vterm->size.width == 75);
   CPPUNIT_ASSERT ( vterm->size.height == 18 );
 
+  // Resizing back and forth keeps the buffer
+  const auto* vterm_data = vterm->data.data();
+  const auto vterm_capacity = vterm->data.capacity();
+  p_fvterm.resizeVTerm ({60, 15});
+  CPPUNIT_ASSERT ( vterm->data.size() == 60 * 15 );
+  CPPUNIT_ASSERT ( vterm->data.data() == vterm_data );
+  p_fvterm.resizeVTerm ({75, 18});
+  CPPUNIT_ASSERT ( vterm->data.data() == vterm_data );
+  CPPUNIT_ASSERT ( vterm->data.capacity() == vterm_capacity );
+
+  // The capacity grows geometrically
+  const auto grown_width = vterm_capacity / 18 + 1;
+  p_fvterm.resizeVTerm ({grown_width, 18});
+  CPPUNIT_ASSERT ( vterm->data.capacity() >= vterm_capacity + vterm_capacity / 2 );
+  const auto* grown_data = vterm->data.data();
+  p_fvterm.resizeVTerm ({grown_width + 2, 19});
+  CPPUNIT_ASSERT ( vterm->data.data() == grown_data );
+
+  // A much smaller size releases the memory
+  const auto grown_capacity = vterm->data.capacity();
+  p_fvterm.resizeVTerm ({10, 5});
+  CPPUNIT_ASSERT ( vterm->data.size() == 10 * 5 );
+  CPPUNIT_ASSERT ( vterm->data.capacity() < grown_capacity );
+  CPPUNIT_ASSERT ( vterm->changes.size() == 5 );
+  p_fvterm.resizeVTerm ({75, 18});
+
   // Deallocate area memory
   CPPUNIT_ASSERT ( test_vwin_area_ptr.get() );
   test_vwin_area_ptr.reset();
@@ -1962,6 +1996,111 @@ void FVTermTest::FVTermPrintTest()
   }  // Encoding loop
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermPrintAsciiRunTest()
+{
+  // Printing an FString writes runs of ASCII characters directly
+  // into the area. The result must be the same as printing the
+  // characters one by one via an FVTermBuffer.
+
+  auto& fterm_data = finalcut::FTermData::getInstance();
+  fterm_data.setTermEncoding (finalcut::Encoding::UTF8);
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  p_fvterm.p_initTerminal();
+  auto ret = std::setlocale (LC_CTYPE, "en_US.UTF-8");
+
+  if ( ! ret )
+    ret = std::setlocale (LC_CTYPE, "C.UTF-8");
+
+  if ( ! ret )
+    return;  // Full-width characters require a UTF-8 locale
+
+  const finalcut::FRect geometry {finalcut::FPoint{0, 0}, finalcut::FSize{15, 4}};
+  const finalcut::FSize shadow{1, 1};
+
+  const auto check = [&p_fvterm, &geometry, &shadow] ( const finalcut::FString& text
+                                                     , const finalcut::FPoint& pos
+                                                     , const finalcut::FString& prefill = L"" )
+  {
+    auto string_area = p_fvterm.p_createArea ({geometry, shadow});
+    auto buffer_area = p_fvterm.p_createArea ({geometry, shadow});
+    finalcut::FVTermBuffer buffer{};
+
+    if ( ! prefill.isEmpty() )
+    {
+      // Unchanged characters must not extend the line changes
+      for (auto area : {string_area.get(), buffer_area.get()})
+      {
+        area->setCursorPos (1, 1);
+        buffer.print(prefill);
+        p_fvterm.print (area, buffer);
+        const finalcut::FVTerm::FLineChanges unchanged {16, 0, area->changes[0].trans_count};
+        std::fill (area->changes.begin(), area->changes.end(), unchanged);
+      }
+    }
+
+    string_area->setCursorPos (pos.getX(), pos.getY());
+    buffer_area->setCursorPos (pos.getX(), pos.getY());
+    const auto string_len = p_fvterm.print (string_area.get(), text);
+    buffer.print(text);
+    const auto buffer_len = p_fvterm.print (buffer_area.get(), buffer);
+    CPPUNIT_ASSERT ( string_len == buffer_len );
+    CPPUNIT_ASSERT ( test::isAreaEqual(string_area.get(), buffer_area.get()) );
+    CPPUNIT_ASSERT ( string_area->cursor.x == buffer_area->cursor.x );
+    CPPUNIT_ASSERT ( string_area->cursor.y == buffer_area->cursor.y );
+    CPPUNIT_ASSERT ( string_area->has_changes == buffer_area->has_changes );
+
+    for (std::size_t y{0}; y < string_area->changes.size(); y++)
+    {
+      const auto& string_changes = string_area->changes[y];
+      const auto& buffer_changes = buffer_area->changes[y];
+      CPPUNIT_ASSERT ( string_changes.xmin == buffer_changes.xmin );
+      CPPUNIT_ASSERT ( string_changes.xmax == buffer_changes.xmax );
+      CPPUNIT_ASSERT ( string_changes.trans_count == buffer_changes.trans_count );
+    }
+  };
+
+  // Plain ASCII
+  check (L"Hello", {1, 1});
+  check (L"Hello", {5, 3});
+
+  // Line wrap at the right edge (the shadow column included)
+  check (L"The quick brown fox jumps", {3, 1});
+
+  // Clip at the end of the area without up scrolling
+  check (L"abcdefghijklmnopqrstuvwxyz", {8, 4});
+  check (L"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ", {1, 5});
+
+  // Control characters
+  check (L"ab\ncd\ref", {4, 2});
+  check (L"1\t2\t3\t4", {1, 1});
+  check (L"abc\bd\b\bx", {2, 2});
+  check (L"\t\t\tx", {1, 1});
+
+  // Mixed ASCII and full-width characters
+  check (L"ab\U0001f600cd\u65e5\u672cef", {1, 1});
+  check (L"abcdefghijkl\u65e5\u672c\u65e5", {1, 2});  // Wrap of a wide char
+  check (L"abcdefghijklmno\u65e5x", {1, 3});  // Wide char at the right edge
+  check (L"xyz\u65e5", {14, 5});  // Right edge of the last line
+
+  // Combining characters belong to the preceding ASCII character
+  check (L"cafe\u0301 na\u0308ive", {1, 1});
+
+  // Unchanged characters
+  check (L"Hello world", {1, 1}, L"Hello World");
+  check (L"abc", {1, 1}, L"abc");
+
+  // Attributes and transparency
+  p_fvterm.setColor (finalcut::FColor::Red, finalcut::FColor::Blue);
+  p_fvterm.setBold();
+  check (L"bold red \u00e4", {2, 2});
+  p_fvterm.setTransparent();
+  check (L"trans", {1, 1});
+  p_fvterm.unsetTransparent();
+  check (L"opaque", {1, 1}, L"trans");
+  p_fvterm.setNormal();
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::FVTermChildAreaPrintTest()
 {
@@ -2692,6 +2831,203 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   CPPUNIT_ASSERT ( test::isAreaEqual(test_area, vterm) );
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermParallelCompositingTest()
+{
+  // The band-parallel compositing of a large terminal
+  // gives the same result as the single-threaded compositing
+
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_3(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm.p_getVirtualDesktop();
+  const finalcut::FSize term_size{400, 120};
+  p_fvterm.resizeVTerm (term_size);
+  p_fvterm.p_resizeArea (finalcut::FRect{finalcut::FPoint{0, 0}, term_size}, vdesktop);
+  CPPUNIT_ASSERT ( vterm->size.width == 400 );
+  CPPUNIT_ASSERT ( vterm->size.height == 120 );
+
+  // Three overlapping windows
+  const std::array<FVTerm_protected*, 3> windows{{&p_fvterm_1, &p_fvterm_2, &p_fvterm_3}};
+  const std::array<finalcut::FRect, 3> geometries
+  {{
+    { finalcut::FPoint{10, 5}, finalcut::FSize{200, 80} },
+    { finalcut::FPoint{100, 30}, finalcut::FSize{250, 70} },
+    { finalcut::FPoint{50, 60}, finalcut::FSize{300, 50} }
+  }};
+  const std::array<finalcut::Style, 3> styles
+  {{
+    finalcut::Style::None,
+    finalcut::Style::ColorOverlay,
+    finalcut::Style::InheritBackground
+  }};
+
+  for (std::size_t i{0}; i < windows.size(); i++)
+  {
+    auto vwin_ptr = windows[i]->p_createArea (geometries[i]);
+    vwin_ptr->visible = true;
+    windows[i]->setVWin(std::move(vwin_ptr));
+    finalcut::FVTerm::getWindowList()->push_back(windows[i]);
+  }
+
+  p_fvterm.p_determineWindowLayers();
+
+  auto composite = [&] (std::size_t threads) -> std::vector<finalcut::FChar>
+  {
+    finalcut::FVTerm::setCompositingThreads(threads);
+    p_fvterm.setColor (finalcut::FColor::DarkGray, finalcut::FColor::LightBlue);
+    p_fvterm.p_clearArea (vdesktop, L'.');
+    p_fvterm.p_clearArea (vterm, L'#');
+
+    for (auto& line_changes : vdesktop->changes)  // Redraw the whole desktop
+    {
+      line_changes.xmin = 0;
+      line_changes.xmax = uInt(vdesktop->size.width) - 1;
+      line_changes.trans_count = 0;
+    }
+
+    vdesktop->has_changes = true;
+
+    for (std::size_t i{0}; i < windows.size(); i++)
+    {
+      const auto& geometry = geometries[i];
+      const auto width = geometry.getWidth();
+      const auto height = int(geometry.getHeight());
+      windows[i]->p_clearArea (windows[i]->getVWin(), L' ');
+
+      for (auto y{0}; y < height; y++)
+      {
+        // Every fourth line is transparent
+        const auto style = ( y % 4 == 3 ) ? finalcut::Style::Transparent
+                                          : styles[i];
+        windows[i]->print() << finalcut::FPoint{geometry.getX() + 1, geometry.getY() + y + 1}
+                            << finalcut::FColorPair { finalcut::FColor(i + 1)
+                                                    , finalcut::FColor(y % 16) }
+                            << finalcut::FStyle {style}
+                            << finalcut::FString(width, wchar_t(L'A' + (y + int(i)) % 26))
+                            << finalcut::FStyle {finalcut::Style::None};
+      }
+    }
+
+    p_fvterm.p_processTerminalUpdate();
+    return vterm->data;
+  };
+
+  const auto single_threaded = composite(1);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 1 );
+  const auto multi_threaded = composite(4);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 4 );
+  CPPUNIT_ASSERT ( single_threaded.size() == 400 * 120 );
+  CPPUNIT_ASSERT ( single_threaded == multi_threaded );
+
+  // All layers have been transferred
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'.' );
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 5).ch[0] == L'A' );
+  CPPUNIT_ASSERT ( vterm->getFChar(60, 70).ch[0] == L'M' );
+
+  for (const auto& window : windows)
+  {
+    const auto vwin = window->getVWin();
+
+    for (auto y{0}; y < vwin->size.height; y++)
+      CPPUNIT_ASSERT ( vwin->changes[unsigned(y)].xmin > vwin->changes[unsigned(y)].xmax );
+  }
+
+  finalcut::FVTerm::setCompositingThreads(1);
+  finalcut::FVTerm::getWindowList()->clear();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermTransparencyRunsTest()
+{
+  // Runs of transparent, color overlay and inherit-background
+  // characters are each combined with the covered characters
+
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_win(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm.p_getVirtualTerminal();
+  p_fvterm.setColor (finalcut::FColor::DarkGray, finalcut::FColor::LightBlue);
+  p_fvterm.p_clearArea (vterm, L'#');
+
+  const finalcut::FRect geometry {finalcut::FPoint{2, 3}, finalcut::FSize{30, 2}};
+  auto vwin_ptr = p_fvterm_win.p_createArea (geometry);
+  vwin_ptr->visible = true;
+  auto vwin = vwin_ptr.get();
+  p_fvterm_win.setVWin(std::move(vwin_ptr));
+
+  // N = None, T = Transparent, O = ColorOverlay, I = InheritBackground
+  const std::string pattern{"NNTTTOOIIINTOINNNOOOOTTIIONTIN"};
+  const auto width = int(pattern.size());
+  CPPUNIT_ASSERT ( width == int(geometry.getWidth()) );
+
+  auto getStyle = [] (char kind)
+  {
+    if ( kind == 'T' )
+      return finalcut::Style::Transparent;
+
+    if ( kind == 'O' )
+      return finalcut::Style::ColorOverlay;
+
+    if ( kind == 'I' )
+      return finalcut::Style::InheritBackground;
+
+    return finalcut::Style::None;
+  };
+
+  p_fvterm_win.p_clearArea (vwin, L' ');
+  p_fvterm_win.print() << finalcut::FPoint{geometry.getX() + 1, geometry.getY() + 1};
+
+  for (auto x{0}; x < width; x++)
+  {
+    p_fvterm_win.print() << finalcut::FStyle {getStyle(pattern[unsigned(x)])}
+                         << finalcut::FColorPair {finalcut::FColor::Red, finalcut::FColor::Green}
+                         << wchar_t(L'a' + x)
+                         << finalcut::FStyle {finalcut::Style::None};
+  }
+
+  CPPUNIT_ASSERT ( vwin->changes[0].trans_count > 0 );
+  p_fvterm.p_addLayer (vwin);
+
+  for (auto x{0}; x < width; x++)
+  {
+    const auto kind = pattern[unsigned(x)];
+    const auto& fchar = vterm->getFChar(geometry.getX() + x, geometry.getY());
+    const auto win_char = wchar_t(L'a' + x);
+
+    if ( kind == 'N' )
+    {
+      CPPUNIT_ASSERT ( fchar.ch[0] == win_char );
+      CPPUNIT_ASSERT ( fchar.fg_color == finalcut::FColor::Red );
+      CPPUNIT_ASSERT ( fchar.bg_color == finalcut::FColor::Green );
+    }
+    else if ( kind == 'T' )
+    {
+      CPPUNIT_ASSERT ( fchar.ch[0] == L'#' );
+      CPPUNIT_ASSERT ( fchar.fg_color == finalcut::FColor::DarkGray );
+      CPPUNIT_ASSERT ( fchar.bg_color == finalcut::FColor::LightBlue );
+    }
+    else if ( kind == 'O' )
+    {
+      CPPUNIT_ASSERT ( fchar.ch[0] == L'#' );
+      CPPUNIT_ASSERT ( fchar.fg_color == finalcut::FColor::Red );
+      CPPUNIT_ASSERT ( fchar.bg_color == finalcut::FColor::Green );
+      CPPUNIT_ASSERT ( ! fchar.attr.bit.color_overlay );
+    }
+    else if ( kind == 'I' )
+    {
+      CPPUNIT_ASSERT ( fchar.ch[0] == win_char );
+      CPPUNIT_ASSERT ( fchar.fg_color == finalcut::FColor::Red );
+      CPPUNIT_ASSERT ( fchar.bg_color == finalcut::FColor::LightBlue );
+    }
+  }
+
+  // The second window line covers the terminal completely
+  const auto& covered_char = vterm->getFChar(geometry.getX(), geometry.getY() + 1);
+  CPPUNIT_ASSERT ( covered_char.ch[0] == L' ' );
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::FVTermReduceUpdatesTest()
 {
@@ -2904,6 +3240,116 @@ void FVTermTest::FVTermReduceUpdatesTest()
   }
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermAreaPoolTest()
+{
+  auto& area_pool = finalcut::FTermAreaPool::getInstance();
+  CPPUNIT_ASSERT ( area_pool.getClassName() == "FTermAreaPool" );
+  area_pool.clear();
+
+  {
+    // The initialization reserves 2 areas for tooltips and 4 for menus
+    FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+    CPPUNIT_ASSERT ( area_pool.getAreaCount() == 6 );
+
+    // The first menu (with shadow) opens without allocation
+    const finalcut::FSize shadow{1, 1};
+    FVTerm_protected p_fvterm_menu(finalcut::outputClass<FTermOutputTest>{});
+    finalcut::FRect menu_box {finalcut::FPoint{2, 1}, finalcut::FSize{30, 12}};
+    auto menu_ptr = p_fvterm_menu.p_createArea ({menu_box, shadow});
+    CPPUNIT_ASSERT ( area_pool.getAreaCount() == 5 );
+    CPPUNIT_ASSERT ( menu_ptr->data.size() == 31 * 13 );
+    CPPUNIT_ASSERT ( menu_ptr->data.capacity() == 40 * 20 );
+    CPPUNIT_ASSERT ( menu_ptr->changes.size() == 13 );
+    CPPUNIT_ASSERT ( menu_ptr->changes.capacity() == 20 );
+    CPPUNIT_ASSERT ( menu_ptr->getOwner<finalcut::FVTerm*>() == &p_fvterm_menu );
+
+    // The same applies to the first tooltip
+    FVTerm_protected p_fvterm_tooltip(finalcut::outputClass<FTermOutputTest>{});
+    finalcut::FRect tooltip_box {finalcut::FPoint{5, 5}, finalcut::FSize{25, 3}};
+    auto tooltip_ptr = p_fvterm_tooltip.p_createArea ({tooltip_box, shadow});
+    CPPUNIT_ASSERT ( area_pool.getAreaCount() == 4 );
+    CPPUNIT_ASSERT ( tooltip_ptr->data.size() == 26 * 4 );
+    CPPUNIT_ASSERT ( tooltip_ptr->data.capacity() == 40 * 5 );
+    CPPUNIT_ASSERT ( tooltip_ptr->changes.capacity() == 5 );
+  }
+
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  area_pool.clear();
+  CPPUNIT_ASSERT ( area_pool.isEmpty() );
+  CPPUNIT_ASSERT ( ! area_pool.acquire(100) );
+
+  // Pre-warm the pool
+  area_pool.reserve (2, finalcut::FSize{40, 10});
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == 2 );
+  area_pool.reserve (1, finalcut::FSize{80, 25});
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == 2 );  // Already enough areas
+  area_pool.reserve (100, finalcut::FSize{10, 5});
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == finalcut::FTermAreaPool::MAX_AREAS );
+  area_pool.clear();
+
+  // A new window gets a pooled area with a sufficient buffer
+  area_pool.reserve (1, finalcut::FSize{40, 10});
+  area_pool.reserve (2, finalcut::FSize{80, 25});
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == 2 );
+  const finalcut::FChar* data_ptr{nullptr};
+  const finalcut::FVTerm::FTermArea* area_ptr{nullptr};
+
+  {
+    FVTerm_protected p_fvterm_win(finalcut::outputClass<FTermOutputTest>{});
+    finalcut::FRect geometry {finalcut::FPoint{5, 3}, finalcut::FSize{50, 12}};
+    auto vwin_ptr = p_fvterm_win.p_createArea (geometry);
+    CPPUNIT_ASSERT ( area_pool.getAreaCount() == 1 );
+    CPPUNIT_ASSERT ( vwin_ptr->data.capacity() == 80 * 25 );
+    CPPUNIT_ASSERT ( vwin_ptr->data.size() == 50 * 12 );
+    CPPUNIT_ASSERT ( vwin_ptr->changes.size() == 12 );
+    CPPUNIT_ASSERT ( vwin_ptr->size.width == 50 );
+    CPPUNIT_ASSERT ( vwin_ptr->position.x == 5 );
+    CPPUNIT_ASSERT ( vwin_ptr->getOwner<finalcut::FVTerm*>() == &p_fvterm_win );
+    vwin_ptr->visible = true;
+    vwin_ptr->layer = 3;
+    data_ptr = vwin_ptr->data.data();
+    area_ptr = vwin_ptr.get();
+    p_fvterm_win.setVWin(std::move(vwin_ptr));
+  }
+
+  // Closing the window returns its area into the pool
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == 2 );
+
+  {
+    FVTerm_protected p_fvterm_win(finalcut::outputClass<FTermOutputTest>{});
+    finalcut::FRect geometry {finalcut::FPoint{0, 0}, finalcut::FSize{60, 20}};
+    auto vwin_ptr = p_fvterm_win.p_createArea (geometry);
+    CPPUNIT_ASSERT ( vwin_ptr.get() == area_ptr );
+    CPPUNIT_ASSERT ( vwin_ptr->data.data() == data_ptr );
+    CPPUNIT_ASSERT ( vwin_ptr->getOwner<finalcut::FVTerm*>() == &p_fvterm_win );
+    CPPUNIT_ASSERT ( ! vwin_ptr->visible );
+    CPPUNIT_ASSERT ( vwin_ptr->layer == -1 );
+    CPPUNIT_ASSERT ( vwin_ptr->size.width == 60 );
+    CPPUNIT_ASSERT ( vwin_ptr->size.height == 20 );
+    CPPUNIT_ASSERT ( vwin_ptr->position.x == 0 );
+    CPPUNIT_ASSERT ( vwin_ptr->getFChar(0, 0).ch[0] == L' ' );
+    p_fvterm_win.setVWin(std::move(vwin_ptr));
+
+    // Without a sufficient buffer, the largest area is used
+    finalcut::FRect big_geometry {finalcut::FPoint{0, 0}, finalcut::FSize{100, 30}};
+    auto big_area = p_fvterm_win.p_createArea (big_geometry);
+    CPPUNIT_ASSERT ( area_pool.isEmpty() );
+    CPPUNIT_ASSERT ( big_area->data.size() == 100 * 30 );
+    area_pool.release (std::move(big_area));
+    CPPUNIT_ASSERT ( area_pool.getAreaCount() == 1 );
+    CPPUNIT_ASSERT ( ! big_area );
+  }
+
+  // Tiled areas are not pooled
+  auto tiled_area = std::make_unique<finalcut::FVTerm::FTermArea>();
+  tiled_area->tiled = true;
+  area_pool.release (std::move(tiled_area));
+  CPPUNIT_ASSERT ( area_pool.getAreaCount() == 2 );
+
+  area_pool.clear();
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::getFVTermAreaTest()
 {
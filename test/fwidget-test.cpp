@@ -390,6 +390,7 @@ class FWidgetTest : public CPPUNIT_NS::TestFixture
     void focusableChildrenTest();
     void closeWidgetTest();
     void adjustSizeTest();
+    void childHitIndexTest();
     void callbackTest();
 
   private:
@@ -408,6 +409,7 @@ class FWidgetTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (focusableChildrenTest);
     CPPUNIT_TEST (closeWidgetTest);
     CPPUNIT_TEST (adjustSizeTest);
+    CPPUNIT_TEST (childHitIndexTest);
     CPPUNIT_TEST (callbackTest);
 
     // End of test suite definition
@@ -2910,6 +2912,73 @@ void FWidgetTest::adjustSizeTest()
   CPPUNIT_ASSERT ( child_wdgt.getTermGeometry() == finalcut::FRect(finalcut::FPoint(10, 10), finalcut::FSize(10, 10)) );
 }
 
+//----------------------------------------------------------------------
+void FWidgetTest::childHitIndexTest()
+{
+  // Containers with many children use a grid index for hit-testing
+
+  std::unique_ptr<finalcut::FSystem> fsys = std::make_unique<FSystemTest>();
+  finalcut::FTerm::setFSystem(fsys);
+
+  finalcut::FWidget root_wdgt{};  // Root widget
+  finalcut::FWidget parent_wdgt{&root_wdgt};
+  parent_wdgt.setGeometry (finalcut::FPoint(11, 2), finalcut::FSize(40, 22));
+  parent_wdgt.setFlags().visibility.shown = true;
+  std::vector<std::unique_ptr<finalcut::FWidget>> children{};
+
+  for (int i{0}; i < 20; i++)
+  {
+    children.push_back(std::make_unique<finalcut::FWidget>(&parent_wdgt));
+    auto& child = children.back();
+    child->setGeometry (finalcut::FPoint(2, i + 1), finalcut::FSize(5, 1));
+    child->setFlags().visibility.shown = true;
+  }
+
+  CPPUNIT_ASSERT ( parent_wdgt.numOfChildren() == 20 );
+  CPPUNIT_ASSERT ( root_wdgt.childWidgetAt({11, 2}) == &parent_wdgt );
+  CPPUNIT_ASSERT ( root_wdgt.childWidgetAt({12, 2}) == children[0].get() );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 2}) == children[0].get() );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({16, 21}) == children[19].get() );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({17, 21}) == nullptr );
+
+  // Moving a child
+  children[5]->setPos (finalcut::FPoint(20, 6));
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 7}) == nullptr );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({30, 7}) == children[5].get() );
+
+  // Resizing a child
+  children[6]->setWidth (30);
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({41, 8}) == children[6].get() );
+  children[6]->setSize (finalcut::FSize(5, 2));
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({41, 8}) == nullptr );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 9}) == children[6].get() );
+
+  // Removing a child
+  auto removed = children[0].get();
+  parent_wdgt.delChild(removed);
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 2}) == nullptr );
+  children[1]->setGeometry (finalcut::FPoint(2, 1), finalcut::FSize(5, 2));
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 2}) == children[1].get() );
+
+  // Adding a child behind an overlapping child
+  finalcut::FWidget new_child{&root_wdgt};
+  new_child.setGeometry (finalcut::FPoint(1, 19), finalcut::FSize(40, 1));
+  new_child.setFlags().visibility.shown = true;
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({11, 21}) == nullptr );
+  parent_wdgt.addChild(&new_child);
+  new_child.setPos (finalcut::FPoint(1, 20));
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({11, 21}) == &new_child );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 21}) == children[19].get() );
+  parent_wdgt.delChild(&new_child);
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({11, 21}) == nullptr );
+
+  // Moving the parent widget also moves the children
+  parent_wdgt.setPos (finalcut::FPoint(21, 2));
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({12, 3}) == nullptr );
+  CPPUNIT_ASSERT ( parent_wdgt.childWidgetAt({22, 3}) == children[1].get() );
+  CPPUNIT_ASSERT ( root_wdgt.childWidgetAt({26, 21}) == children[19].get() );
+}
+
 //----------------------------------------------------------------------
 void FWidgetTest::callbackTest()
 {